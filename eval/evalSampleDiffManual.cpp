@@ -33,6 +33,7 @@
 #include "QuadLoco/cast.hpp"
 #include "QuadLoco/imgSpot.hpp"
 #include "QuadLoco/io.hpp"
+#include "QuadLoco/ioBatchReader.hpp"
 #include "QuadLoco/opsAllPeaks2D.hpp"
 #include "QuadLoco/opsSymRing.hpp"
 #include "QuadLoco/rasGrid.hpp"
@@ -541,17 +542,17 @@ namespace eval
 		return bestSpot;
 	}
 
-	//! Result from load/process input files (optn'ly save intermediate data)
+	//! Result from process of input files (optn'ly save intermediate data)
 	inline
 	Outcome
 	processFileSet
 		( FileSet const & fileSet
+		, ras::Grid<std::uint8_t> const & loadGrid
+			//!< Image chip (as loaded from fileSet.thePathPGM)
 		, std::filesystem::path const & saveDir
 		)
 	{
-		// load image chip
-		std::filesystem::path const loadPath{ fileSet.thePathPGM };
-		ras::Grid<std::uint8_t> const loadGrid{ io::readPGM(loadPath) };
+		// convert image chip
 		ras::Grid<float> const srcGrid
 			{ ras::grid::realGridOf<float>(loadGrid, 0u) };
 
@@ -637,10 +638,33 @@ main
 	std::vector<eval::FileSet> const fileSets
 		{ eval::fileSetsFrom(loadDir, sampNames) };
 	outcomes.reserve(fileSets.size());
+
+	// load image chips in background (in fileSets order)
+	std::vector<std::filesystem::path> pgmPaths;
+	pgmPaths.reserve(fileSets.size());
+	for (eval::FileSet const & fileSet : fileSets)
+	{
+		pgmPaths.emplace_back(fileSet.thePathPGM);
+	}
+	quadloco::io::BatchReader reader(pgmPaths, 4u);
+
+	quadloco::io::BatchReader::Frame frame{};
 	for (eval::FileSet const & fileSet : fileSets)
 	{
+		if (! reader.nextFrame(&frame))
+		{
+			std::cerr << "Reader ended early before: "
+				<< fileSet.thePathPGM.native() << '\n';
+			break;
+		}
+		if (! frame.isValid())
+		{
+			std::cerr << "Skipping unreadable image: "
+				<< frame.thePath.native() << '\n';
+			continue;
+		}
 		eval::Outcome const outcome
-			{ eval::processFileSet(fileSet, saveDir) };
+			{ eval::processFileSet(fileSet, frame.theGrid, saveDir) };
 		outcomes.emplace_back(outcome);
 	}
 
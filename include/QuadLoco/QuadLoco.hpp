@@ -52,6 +52,10 @@
 #include "QuadLoco/cast.hpp"
 #include "QuadLoco/img.hpp"
 #include "QuadLoco/io.hpp"
+#include "QuadLoco/ioBatchReader.hpp"
+#include "QuadLoco/ioBinGrid.hpp"
+#include "QuadLoco/ioMappedFile.hpp"
+#include "QuadLoco/ioMappedPGM.hpp"
 #include "QuadLoco/mat.hpp"
 #include "QuadLoco/mea.hpp"
 #include "QuadLoco/obj.hpp"
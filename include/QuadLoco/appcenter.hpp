@@ -32,14 +32,20 @@
  */
 
 
-#include "QuadLoco/opsAllPeaks2D.hpp"
 #include "QuadLoco/opsCenterRefinerSSD.hpp"
 #include "QuadLoco/opsSymRing.hpp"
+#include "QuadLoco/pix.hpp"
 #include "QuadLoco/prbStats.hpp"
+#include "QuadLoco/rasChipSpec.hpp"
 #include "QuadLoco/rasgrid.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
 #include "QuadLoco/rasPeakRCV.hpp"
+#include "QuadLoco/rasPyramid.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
 
+#include <algorithm>
+#include <limits>
 #include <vector>
 
 
@@ -131,78 +137,170 @@ namespace center
 	 * of 1) balance between dark and light pixels; 2) high contrast
 	 * in the local area; and 3) symmetry of radiometric values under
 	 * a half-turn rotation.
+	 *
+	 * The srcGrid may be a view into a larger image (e.g. a chip area)
+	 * in which case the returned peak locations are relative to the
+	 * view (i.e. are chip row/col values).
+	 *
+	 * The amount of secondary evaluation may be bounded by specifying
+	 * maxNumPeaks and/or minimum absolute or relative values. Since
+	 * SymRing responses are no larger than one (for srcStats that
+	 * include all srcGrid values), a combined value is no larger than
+	 * its first filter value. Initial peaks are therefore processed in
+	 * decreasing value order (in batches evaluated via
+	 * ops::SymRing::fillCells()) and processing stops once either:
+	 * \arg the next initial peak value is below the value threshold
+	 * \arg maxNumPeaks combined values are larger than the next
+	 *      initial peak value (i.e. the result can no longer change).
+	 *
+	 * With default values (no bounds) all initial peaks are returned.
+	 * When bounded, combined peaks that are not valid or that have
+	 * values below the threshold are not returned.
 	 */
 	inline
 	std::vector<ras::PeakRCV>
 	multiSymRingPeaks
-		( ras::Grid<float> const & srcGrid
-			//!< Input intensity grid
+		( ras::GridView<float> const & srcGrid
+			//!< Input intensity data
 		, prb::Stats<float> const & srcStats
 			//!< Statisics for srcGrid values
 		, std::vector<std::size_t> const & ringHalfSizes
 			//!< SymRing quantized radius - in order of application.
+		, std::size_t const & maxNumPeaks
+			= std::numeric_limits<std::size_t>::max()
+			//!< Return (at most) this many of the largest combined peaks
+		, double const & minAbsValue = 0.
+			//!< Return only combined peaks with (at least) this value
+		, double const & minRelValue = 0.
+			//!< As minAbsValue but as fraction of largest first peak
 		)
 	{
 		std::vector<ras::PeakRCV> peakCombos;
 
 		bool const srcOkay{ srcGrid.isValid() && srcStats.isValid() };
 
-		if (srcOkay && (! ringHalfSizes.empty()))
+		if (srcOkay && (! ringHalfSizes.empty()) && (0u < maxNumPeaks))
 		{
 			// construct filter objects with requested geometry
 			// (e.g. define relative row/col offsets from filter origin)
+			// (sharing null distances so that most evaluations can
+			// skip per-sample null checks)
+			ras::NullDistance const nullDist(srcGrid);
 			std::vector<ops::SymRing> symRings;
 			symRings.reserve(ringHalfSizes.size());
 			for (std::size_t const & ringHalfSize : ringHalfSizes)
 			{
-				ops::SymRing const symRing(&srcGrid, srcStats, ringHalfSize);
+				ops::SymRing const symRing
+					(srcGrid, srcStats, ringHalfSize, &nullDist);
 				symRings.emplace_back(symRing);
 			}
 
-			// run initial symmetry filter
+			// run initial symmetry filter and get all peaks (largest first)
+			// (fused evaluation - no full size response grid is needed)
 			ops::SymRing const & symRingA = symRings.front();
-			ras::Grid<float> const peakGridA
-				{ ops::symRingGridFor(srcGrid, symRingA) };
-
-			// get all peaks from gridA
-			ops::AllPeaks2D const allPeaksA(peakGridA);
-			std::size_t const numToGet{ srcGrid.size() }; // { 100u };
-			std::vector<ras::PeakRCV> const peakAs
-				{ allPeaksA.largestPeakRCVs(numToGet) };
+			std::vector<ras::PeakRCV> peakAs
+				{ ops::symRingPeaksFor(srcGrid, symRingA) };
+			std::sort(peakAs.rbegin(), peakAs.rend());
 			if (! peakAs.empty())
 			{
-				// qualify 'A' peaks using symmetry response of 'B'
-				peakCombos.reserve(peakAs.size());
-				for (ras::PeakRCV const & peakA : peakAs)
+				std::size_t const numAs{ peakAs.size() };
+				bool const isBounded
+					{  (maxNumPeaks < numAs)
+					|| (0. < minAbsValue)
+					|| (0. < minRelValue)
+					};
+				double const minValue
+					{ std::max
+						(minAbsValue, minRelValue * peakAs.front().theValue)
+					};
+
+				// allowance for roundoff in responses (nominally <= 1)
+				constexpr double maxResponse{ 1. + 1.e-5 };
+
+				// qualify 'A' peaks using symmetry response of 'B' filters
+				// (evaluated a batch of 'A' peaks at a time)
+				constexpr std::size_t batchSize{ 64u };
+				peakCombos.reserve(std::min(numAs, maxNumPeaks));
+				std::vector<ras::RowCol> rowcols;
+				std::vector<double> valueCombos;
+				std::vector<float> valueBs;
+				rowcols.reserve(batchSize);
+				valueCombos.reserve(batchSize);
+				valueBs.resize(batchSize);
+				ops::SymRing::RingScratch scratch{};
+				sys::cpu::SimdLevel const level{ sys::cpu::simdLevel() };
+				auto const largerFirst
+					{ [] (ras::PeakRCV const & v1, ras::PeakRCV const & v2)
+						{ return (v2 < v1); }
+					};
+				std::size_t ndxBeg{ 0u };
+				bool done{ isBounded && (peakAs.front().theValue < minValue) };
+				while (! done)
 				{
-					std::size_t const & row = peakA.theRowCol.row();
-					std::size_t const & col = peakA.theRowCol.col();
-					double valueCombo{ peakA.theValue };
+					std::size_t const ndxEnd
+						{ std::min(ndxBeg + batchSize, numAs) };
+					rowcols.clear();
+					valueCombos.clear();
+					for (std::size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+					{
+						rowcols.emplace_back(peakAs[ndx].theRowCol);
+						valueCombos.emplace_back(peakAs[ndx].theValue);
+					}
 					for (std::size_t nn{1u} ; nn < symRings.size() ; ++nn)
 					{
 						ops::SymRing const & symRingB = symRings[nn];
-						float const valueB{ symRingB(row, col) };
-						valueCombo *= static_cast<double>(valueB);
-
-/*
-using engabra::g3::io::fixed;
-std::cout
-	<< "values{A,B,combo}:"
-	<< ' ' << fixed(peakA.theValue)
-	<< ' ' << fixed(valueB)
-	<< ' ' << fixed(valueCombo)
-	<< '\n';
-*/
+						symRingB.fillCells
+							(rowcols, valueBs.data(), level, &scratch);
+						for (std::size_t kk{0u} ; kk < rowcols.size() ; ++kk)
+						{
+							valueCombos[kk] *= static_cast<double>(valueBs[kk]);
+						}
+					}
+					for (std::size_t kk{0u} ; kk < rowcols.size() ; ++kk)
+					{
+						float const fVal{ static_cast<float>(valueCombos[kk]) };
+						bool const keep
+							{  (! isBounded)
+							|| (pix::isValid(fVal) && (! (fVal < minValue)))
+							};
+						if (keep)
+						{
+							peakCombos.emplace_back
+								(ras::PeakRCV{ rowcols[kk], fVal });
+						}
+					}
+					ndxBeg = ndxEnd;
+
+					// stop if remaining 'A' peaks are all below threshold
+					done =
+						(  (! (ndxBeg < numAs))
+						|| (isBounded && (peakAs[ndxBeg].theValue < minValue))
+						);
 
+					// stop if no remaining 'A' peak can be among the largest
+					if ((! done) && (! (peakCombos.size() < maxNumPeaks)))
+					{
+						std::vector<ras::PeakRCV>::iterator const itLast
+							{ peakCombos.begin() + (maxNumPeaks - 1u) };
+						std::nth_element
+							( peakCombos.begin(), itLast, peakCombos.end()
+							, largerFirst
+							);
+						double const nextBound
+							{ maxResponse * peakAs[ndxBeg].theValue };
+						done = (nextBound < itLast->theValue);
+
+						// smaller combined peaks are no longer needed
+						peakCombos.resize(maxNumPeaks);
 					}
-					float const fVal{ static_cast<float>(valueCombo) };
-				//	peakCombos.emplace_back(ras::PeakRCV{ { row, col }, fVal });
-					peakCombos.emplace_back
-						(ras::PeakRCV{ peakA.theRowCol, fVal });
 
-				} // peakAs
+				} // batches of peakAs
 
 				std::sort(peakCombos.rbegin(), peakCombos.rend());
+				if (maxNumPeaks < peakCombos.size())
+				{
+					peakCombos.resize(maxNumPeaks);
+				}
 
 			} // ! peakAs.empty()
 
@@ -211,6 +309,47 @@ std::cout
 		return peakCombos;
 	}
 
+	//! \brief Peaks from multiple combined symmetry filters on full grid
+	inline
+	std::vector<ras::PeakRCV>
+	multiSymRingPeaks
+		( ras::Grid<float> const & srcGrid
+			//!< Input intensity grid
+		, prb::Stats<float> const & srcStats
+			//!< Statisics for srcGrid values
+		, std::vector<std::size_t> const & ringHalfSizes
+			//!< SymRing quantized radius - in order of application.
+		, std::size_t const & maxNumPeaks
+			= std::numeric_limits<std::size_t>::max()
+			//!< Return (at most) this many of the largest combined peaks
+		, double const & minAbsValue = 0.
+			//!< Return only combined peaks with (at least) this value
+		, double const & minRelValue = 0.
+			//!< As minAbsValue but as fraction of largest first peak
+		)
+	{
+		return multiSymRingPeaks
+			( ras::GridView<float>(srcGrid), srcStats, ringHalfSizes
+			, maxNumPeaks, minAbsValue, minRelValue
+			);
+	}
+
+	//! \brief Convenience version that computes srcView statistics
+	inline
+	std::vector<ras::PeakRCV>
+	multiSymRingPeaks
+		( ras::GridView<float> const & srcView
+			//!< Input intensity data
+		, std::vector<std::size_t> const & ringHalfSizes
+			//!< SymRing quantized radius - in order of application.
+		)
+	{
+		// get input data statistics
+		prb::Stats<float> const srcStats{ ops::statsFor(srcView) };
+
+		return multiSymRingPeaks(srcView, srcStats, ringHalfSizes);
+	}
+
 	//! \brief Convenience version if srcStatistics are already avilable
 	inline
 	std::vector<ras::PeakRCV>
@@ -222,18 +361,384 @@ std::cout
 		)
 	{
 		// get input grid statistics
-		prb::Stats<float> const srcStats(srcGrid.cbegin(), srcGrid.cend());
+		prb::Stats<float> const srcStats
+			{ ops::statsFor(ras::GridView<float>(srcGrid)) };
 
 		return multiSymRingPeaks(srcGrid, srcStats, ringHalfSizes);
 	}
 
 
+	/*! \brief Number of halo rows needed for banded multiSymRingPeaks().
+	 *
+	 * Each band is extended (above and below) by this many rows such
+	 * that the SymRing responses (which need ringHalfSize+1 rows) and
+	 * the 8-hood peak test (which needs one more) in the band core
+	 * are identical to those computed over the full image.
+	 */
+	inline
+	std::size_t
+	bandHaloFor
+		( std::vector<std::size_t> const & ringHalfSizes
+		)
+	{
+		std::size_t halo{ 0u };
+		if (! ringHalfSizes.empty())
+		{
+			std::size_t const maxHalfSize
+				{ *std::max_element
+					(ringHalfSizes.cbegin(), ringHalfSizes.cend())
+				};
+			halo = maxHalfSize + 2u;
+		}
+		return halo;
+	}
+
+	/*! \brief Streaming multiSymRingPeaks() over horizontal bands of rows.
+	 *
+	 * Source rows are obtained (in increasing order, each exactly once)
+	 * via the fillRow function which has signature compatible with:
+	 * \arg void fillRow(std::size_t const & row, float * const & rowBeg)
+	 * and which must set values for all fullHW.wide() cells of the row.
+	 *
+	 * Rows are processed in bands of bandHigh (core) rows extended by
+	 * bandHaloFor() halo rows on each side. Peaks are reported only for
+	 * the core rows of each band, so that the result is the same as for
+	 * multiSymRingPeaks() applied to the full image. Peak locations are
+	 * in full image row/col coordinates and are sorted largest first.
+	 *
+	 * Memory use is proportional to the band size (bandHigh plus halo
+	 * rows) rather than to the full image size. Since the SymRing
+	 * filters use (global) source statistics, these must be provided
+	 * by the caller (e.g. from a prior pass, or from sensor range).
+	 */
+	template <typename RowFunc>
+	inline
+	std::vector<ras::PeakRCV>
+	multiSymRingPeaksBanded
+		( ras::SizeHW const & fullHW
+			//!< Size of the full (e.g. streaming) source image
+		, RowFunc const & fillRow
+			//!< Function to provide source row values (see above)
+		, prb::Stats<float> const & srcStats
+			//!< Statisics for (full) source data values
+		, std::vector<std::size_t> const & ringHalfSizes
+			//!< SymRing quantized radius - in order of application.
+		, std::size_t const & bandHigh = 256u
+			//!< Number of (core) rows to process in each band
+		)
+	{
+		std::vector<ras::PeakRCV> peaks{};
+
+		std::size_t const fullHigh{ fullHW.high() };
+		std::size_t const fullWide{ fullHW.wide() };
+		std::size_t const coreHigh{ std::max(bandHigh, std::size_t{ 1u }) };
+		std::size_t const halo{ bandHaloFor(ringHalfSizes) };
+		if (fullHW.isValid() && (! ringHalfSizes.empty()))
+		{
+			// band buffer - reused for all bands
+			std::size_t const bufHigh
+				{ std::min(coreHigh + 2u*halo, fullHigh) };
+			ras::Grid<float> bandBuf(bufHigh, fullWide);
+
+			std::size_t bufRow0{ 0u }; // full image row of bandBuf row 0
+			std::size_t bufCount{ 0u }; // number of rows in bandBuf
+			for (std::size_t coreBeg{0u} ; coreBeg < fullHigh
+				; coreBeg += coreHigh)
+			{
+				std::size_t const coreEnd
+					{ std::min(coreBeg + coreHigh, fullHigh) };
+				std::size_t const needBeg
+					{ (coreBeg < halo) ? 0u : (coreBeg - halo) };
+				std::size_t const needEnd
+					{ std::min(coreEnd + halo, fullHigh) };
+
+				// retain (overlapping) rows still needed, discard others
+				if (bufRow0 < needBeg)
+				{
+					std::size_t const shift
+						{ std::min(needBeg - bufRow0, bufCount) };
+					for (std::size_t row{shift} ; row < bufCount ; ++row)
+					{
+						std::copy
+							( bandBuf.cbeginRow(row), bandBuf.cendRow(row)
+							, bandBuf.beginRow(row - shift)
+							);
+					}
+					bufCount -= shift;
+					bufRow0 = needBeg;
+				}
+
+				// obtain new rows from source
+				while ((bufRow0 + bufCount) < needEnd)
+				{
+					fillRow(bufRow0 + bufCount, bandBuf.beginRow(bufCount));
+					++bufCount;
+				}
+
+				// process the band
+				ras::GridView<float> const bandView
+					( bandBuf.cbegin()
+					, ras::SizeHW{ bufCount, fullWide }
+					, bandBuf.rowPitch()
+					);
+				std::vector<ras::PeakRCV> const bandPeaks
+					{ multiSymRingPeaks(bandView, srcStats, ringHalfSizes) };
+
+				// keep peaks from band core (in full image coordinates)
+				for (ras::PeakRCV const & bandPeak : bandPeaks)
+				{
+					std::size_t const row
+						{ bandPeak.theRowCol.row() + bufRow0 };
+					if ((! (row < coreBeg)) && (row < coreEnd))
+					{
+						ras::RowCol const rcFull
+							{ row, bandPeak.theRowCol.col() };
+						peaks.emplace_back
+							(ras::PeakRCV{ rcFull, bandPeak.theValue });
+					}
+				}
+			}
+
+			std::sort(peaks.rbegin(), peaks.rend());
+		}
+
+		return peaks;
+	}
+
+	/*! \brief Banded multiSymRingPeaks() for (e.g. memory mapped) srcView.
+	 *
+	 * Source values (e.g. uint8_t or uint16_t) are converted to float
+	 * one band at a time (i.e. no full size float grid is created).
+	 * Refer to multiSymRingPeaksBanded() with fillRow function.
+	 */
+	template <typename SrcType>
+	inline
+	std::vector<ras::PeakRCV>
+	multiSymRingPeaksBanded
+		( ras::GridView<SrcType> const & srcView
+			//!< Input data (e.g. from io::MappedPGM)
+		, prb::Stats<float> const & srcStats
+			//!< Statisics for srcView values
+		, std::vector<std::size_t> const & ringHalfSizes
+			//!< SymRing quantized radius - in order of application.
+		, std::size_t const & bandHigh = 256u
+			//!< Number of (core) rows to process in each band
+		)
+	{
+		return multiSymRingPeaksBanded
+			( srcView.hwSize()
+			, [&srcView] (std::size_t const & row, float * const & rowBeg)
+				{
+					std::transform
+						( srcView.cbeginRow(row), srcView.cendRow(row)
+						, rowBeg
+						, [] (SrcType const & val)
+							{ return static_cast<float>(val); }
+						);
+				}
+			, srcStats
+			, ringHalfSizes
+			, bandHigh
+			);
+	}
+
+	/*! \brief Coarse-to-fine multiSymRingPeaks() using a ras::Pyramid.
+	 *
+	 * The srcView is decimated (ref ras::Pyramid) to the coarsest of
+	 * numLevels levels, and multiSymRingPeaks() is run there with the
+	 * ringHalfSizes scaled down accordingly (but at least 2 since
+	 * smaller rings do not resolve a quad center). The numCandidates
+	 * strongest coarse peaks are projected back to full resolution
+	 * where multiSymRingPeaks() is evaluated only within a window of
+	 * +/-windowHalf cells (plus bandHaloFor() halo cells) about each
+	 * candidate.
+	 *
+	 * Peaks reported within the windows have the same locations and
+	 * values as those from multiSymRingPeaks() over the full srcView.
+	 * Peaks outside all windows (e.g. small or weak features that do
+	 * not survive decimation) are not found. This is intended for
+	 * large images with relatively few, relatively large targets.
+	 *
+	 * If the pyramid has only a single level (e.g. numLevels<2 or a
+	 * small srcView) this is the same as multiSymRingPeaks().
+	 */
+	inline
+	std::vector<ras::PeakRCV>
+	multiSymRingPeaksPyramid
+		( ras::GridView<float> const & srcView
+			//!< Input intensity data
+		, prb::Stats<float> const & srcStats
+			//!< Statisics for srcView values
+		, std::vector<std::size_t> const & ringHalfSizes
+			//!< SymRing quantized radius - in order of application.
+		, std::size_t const & numLevels = 2u
+			//!< Number of pyramid levels (including full resolution)
+		, std::size_t const & windowHalf = 8u
+			//!< Half size of full resolution window about candidates
+		, std::size_t const & numCandidates = 8u
+			//!< Number of (strongest) coarse peaks to evaluate
+		)
+	{
+		std::vector<ras::PeakRCV> peaks{};
+
+		bool const srcOkay{ srcView.isValid() && srcStats.isValid() };
+		if (srcOkay && (! ringHalfSizes.empty()))
+		{
+			ras::Pyramid const pyramid(srcView, numLevels);
+			std::size_t const coarseLevel{ pyramid.numLevels() - 1u };
+			if (0u == coarseLevel)
+			{
+				peaks = multiSymRingPeaks(srcView, srcStats, ringHalfSizes);
+			}
+			else
+			{
+				// candidates from (scaled) symmetry filters at coarse level
+				std::size_t const scale
+					{ ras::Pyramid::scaleFor(coarseLevel) };
+				std::vector<std::size_t> coarseHalfSizes;
+				coarseHalfSizes.reserve(ringHalfSizes.size());
+				for (std::size_t const & ringHalfSize : ringHalfSizes)
+				{
+					coarseHalfSizes.emplace_back
+						(std::max(ringHalfSize / scale, std::size_t{ 2u }));
+				}
+				std::vector<ras::PeakRCV> const coarsePeaks
+					{ multiSymRingPeaks
+						(pyramid.view(coarseLevel), coarseHalfSizes)
+					};
+				std::size_t const numUse
+					{ std::min(numCandidates, coarsePeaks.size()) };
+
+				// full resolution evaluation in windows about candidates
+				std::size_t const halo{ bandHaloFor(ringHalfSizes) };
+				std::size_t const high{ srcView.high() };
+				std::size_t const wide{ srcView.wide() };
+				for (std::size_t nn{0u} ; nn < numUse ; ++nn)
+				{
+					ras::RowCol const fullRC
+						{ ras::Pyramid::fullRowColFor
+							(coarseLevel, coarsePeaks[nn].theRowCol)
+						};
+
+					// core window (in which peaks are reported)
+					std::size_t const row{ std::min(fullRC.row(), high - 1u) };
+					std::size_t const col{ std::min(fullRC.col(), wide - 1u) };
+					std::size_t const coreRowBeg
+						{ (row < windowHalf) ? 0u : (row - windowHalf) };
+					std::size_t const coreColBeg
+						{ (col < windowHalf) ? 0u : (col - windowHalf) };
+					std::size_t const coreRowEnd
+						{ std::min(row + windowHalf + 1u, high) };
+					std::size_t const coreColEnd
+						{ std::min(col + windowHalf + 1u, wide) };
+
+					// chip (core plus halo) over which filters are run
+					std::size_t const chipRowBeg
+						{ (coreRowBeg < halo) ? 0u : (coreRowBeg - halo) };
+					std::size_t const chipColBeg
+						{ (coreColBeg < halo) ? 0u : (coreColBeg - halo) };
+					std::size_t const chipRowEnd
+						{ std::min(coreRowEnd + halo, high) };
+					std::size_t const chipColEnd
+						{ std::min(coreColEnd + halo, wide) };
+					ras::ChipSpec const chipSpec
+						{ ras::RowCol{ chipRowBeg, chipColBeg }
+						, ras::SizeHW
+							{ chipRowEnd - chipRowBeg, chipColEnd - chipColBeg }
+						};
+					std::vector<ras::PeakRCV> const chipPeaks
+						{ multiSymRingPeaks
+							( srcView.subViewFor(chipSpec)
+							, srcStats
+							, ringHalfSizes
+							)
+						};
+
+					// keep peaks from core (in full image coordinates)
+					for (ras::PeakRCV const & chipPeak : chipPeaks)
+					{
+						std::size_t const peakRow
+							{ chipPeak.theRowCol.row() + chipRowBeg };
+						std::size_t const peakCol
+							{ chipPeak.theRowCol.col() + chipColBeg };
+						bool const inCore
+							{  (! (peakRow < coreRowBeg))
+							&& (peakRow < coreRowEnd)
+							&& (! (peakCol < coreColBeg))
+							&& (peakCol < coreColEnd)
+							};
+						if (inCore)
+						{
+							ras::RowCol const rcFull{ peakRow, peakCol };
+							peaks.emplace_back
+								(ras::PeakRCV{ rcFull, chipPeak.theValue });
+						}
+					}
+				}
+
+				// remove duplicates (from overlapping windows)
+				std::sort
+					( peaks.begin(), peaks.end()
+					, [] (ras::PeakRCV const & pA, ras::PeakRCV const & pB)
+						{
+							ras::RowCol const & rcA = pA.theRowCol;
+							ras::RowCol const & rcB = pB.theRowCol;
+							return
+								(  (rcA.row() < rcB.row())
+								|| (  (rcA.row() == rcB.row())
+								   && (rcA.col() < rcB.col())
+								   )
+								);
+						}
+					);
+				peaks.erase
+					( std::unique
+						( peaks.begin(), peaks.end()
+						, [] (ras::PeakRCV const & pA, ras::PeakRCV const & pB)
+							{ return (pA.theRowCol == pB.theRowCol); }
+						)
+					, peaks.end()
+					);
+
+				std::sort(peaks.rbegin(), peaks.rend());
+			}
+		}
+
+		return peaks;
+	}
+
+	//! \brief Coarse-to-fine multiSymRingPeaks() on a full grid
+	inline
+	std::vector<ras::PeakRCV>
+	multiSymRingPeaksPyramid
+		( ras::Grid<float> const & srcGrid
+			//!< Input intensity grid
+		, prb::Stats<float> const & srcStats
+			//!< Statisics for srcGrid values
+		, std::vector<std::size_t> const & ringHalfSizes
+			//!< SymRing quantized radius - in order of application.
+		, std::size_t const & numLevels = 2u
+			//!< Number of pyramid levels (including full resolution)
+		, std::size_t const & windowHalf = 8u
+			//!< Half size of full resolution window about candidates
+		, std::size_t const & numCandidates = 8u
+			//!< Number of (strongest) coarse peaks to evaluate
+		)
+	{
+		return multiSymRingPeaksPyramid
+			( ras::GridView<float>(srcGrid), srcStats, ringHalfSizes
+			, numLevels, windowHalf, numCandidates
+			);
+	}
+
 	//! Refined center hit via multiSymRingPeaks and CenterRefinerSSD.
 	inline
 	img::Hit
 	refinedHitFrom
-		( ras::Grid<float> const & srcGrid
+		( ras::GridView<float> const & srcGrid
 		, std::vector<std::size_t> const & halfRingSizes
+		, ops::CenterRefinerSSD::Workspace * const & ptWorkspace = nullptr
+			//!< Optional refinement scratch memory to reuse across calls
 		)
 	{
 		img::Hit centerHit;
@@ -250,13 +755,24 @@ std::cout
 			if (peakRCVs.cend() != itMax)
 			{
 				ras::PeakRCV const & peakRCV = *itMax;
-				ops::CenterRefinerSSD const refiner(&srcGrid);
-				centerHit = refiner.fitHitNear(peakRCV.theRowCol);
+				ops::CenterRefinerSSD const refiner(srcGrid);
+				centerHit = refiner.fitHitNear(peakRCV.theRowCol, ptWorkspace);
 			}
 		}
 		return centerHit;
 	}
 
+	//! Refined center hit via multiSymRingPeaks and CenterRefinerSSD.
+	inline
+	img::Hit
+	refinedHitFrom
+		( ras::Grid<float> const & srcGrid
+		, std::vector<std::size_t> const & halfRingSizes
+		)
+	{
+		return refinedHitFrom(ras::GridView<float>(srcGrid), halfRingSizes);
+	}
+
 } // [center]
 
 
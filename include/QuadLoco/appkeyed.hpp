@@ -39,6 +39,7 @@
 #include "QuadLoco/rasChipSpec.hpp"
 #include "QuadLoco/rasgrid.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
 #include "QuadLoco/rasRowCol.hpp"
 #include "QuadLoco/rasSizeHW.hpp"
 
@@ -172,9 +173,9 @@ namespace keyed
 			QuadKey const & key = keyChip.first;
 			ras::ChipSpec const & chipSpec = keyChip.second;
 
-			// crop grid from source and convert to float
+			// convert (only) the chip area of the source to float
 			ras::Grid<float> const srcGrid
-				{ ras::grid::subGridValuesFrom<float>(loadGrid, chipSpec) };
+				{ ras::grid::realGridOf<float>(loadGrid, chipSpec) };
 
 			// find and refine center location
 			img::Hit const chipHit
@@ -197,6 +198,59 @@ namespace keyed
 		return keyCenterHits;
 	}
 
+	/*! \brief Refined target center points near to nominal keyCenterRCs
+	 *
+	 * Same as keyCenterHitsNearTo(..., Grid<uint8_t>, ...) but for
+	 * source data that are already of float type. Each chip is processed
+	 * through a ras::GridView into srcGrid (i.e. no chip data are copied).
+	 */
+	inline
+	std::map<QuadKey, img::Hit>
+	keyCenterHitsNearTo
+		( std::map<QuadKey, ras::ChipSpec> const & keyChips
+		, ras::Grid<float> const & srcGrid
+		, std::vector<std::size_t> const & ringHalfSizes
+		)
+	{
+		std::map<QuadKey, img::Hit> keyCenterHits{};
+
+		// refinement scratch memory reused for all chips
+		ops::CenterRefinerSSD::Workspace workspace{};
+
+		// Extract refined center locations for each chip
+		for (std::map<QuadKey, ras::ChipSpec>::value_type
+			const & keyChip : keyChips)
+		{
+			QuadKey const & key = keyChip.first;
+			ras::ChipSpec const & chipSpec = keyChip.second;
+
+			// view chip area within source (no copy)
+			ras::GridView<float> const chipView
+				{ ras::grid::subGridViewFrom(srcGrid, chipSpec) };
+
+			// find and refine center location
+			img::Hit const chipHit
+				{ center::refinedHitFrom
+					(chipView, ringHalfSizes, &workspace)
+				};
+
+			if (isValid(chipHit))
+			{
+				// adjust hit to reflect source grid coordinates
+				img::Hit const imgHit
+					{ chipSpec.fullSpotForChipSpot(chipHit.location())
+					, chipHit.value()
+					, chipHit.sigma()
+					};
+				keyCenterHits.emplace_hint
+					( keyCenterHits.end()
+					, std::make_pair(key, imgHit)
+					);
+			}
+		}
+		return keyCenterHits;
+	}
+
 } // [keyed]
 
 
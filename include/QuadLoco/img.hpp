@@ -35,6 +35,7 @@
 #include "QuadLoco/imgArea.hpp"
 #include "QuadLoco/imgCircle.hpp"
 #include "QuadLoco/imgEdgel.hpp"
+#include "QuadLoco/imgEdgelSet.hpp"
 #include "QuadLoco/imgGrad.hpp"
 #include "QuadLoco/imgHit.hpp"
 #include "QuadLoco/imgQuadTarget.hpp"
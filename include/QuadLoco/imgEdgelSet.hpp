@@ -0,0 +1,320 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::img::EdgelSet (SoA edgel collection)
+ *
+ */
+
+
+#include "QuadLoco/ang.hpp"
+#include "QuadLoco/imgEdgel.hpp"
+#include "QuadLoco/imgGrad.hpp"
+#include "QuadLoco/imgSpot.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace quadloco
+{
+
+namespace img
+{
+
+	/*! \brief Collection of edgels stored as separate (float) arrays.
+	 *
+	 * Provides the same information as a std::vector<img::Edgel> but
+	 * as a "structure of arrays" with float precision. Each edgel is
+	 * represented by one entry in each of the rows(), cols(), gRows()
+	 * and gCols() arrays. This is a fraction of the memory of the
+	 * equivalent img::Edgel collection, and batch computations (e.g.
+	 * magnitudesInto() and anglesInto()) are simple loops over
+	 * contiguous arrays that compilers can vectorize.
+	 *
+	 * \par Example
+	 * \snippet test/test_imgEdgelSet.cpp DoxyExample01
+	 */
+	class EdgelSet
+	{
+		//! Row locations
+		std::vector<float> theRows{};
+
+		//! Column locations
+		std::vector<float> theCols{};
+
+		//! Row components of gradients
+		std::vector<float> theGradRows{};
+
+		//! Column components of gradients
+		std::vector<float> theGradCols{};
+
+	public:
+
+		//! Construct an empty collection
+		inline
+		EdgelSet
+			() = default;
+
+		//! Collection containing the same edgels as (AoS) edgels
+		inline
+		static
+		EdgelSet
+		from
+			( std::vector<img::Edgel> const & edgels
+			)
+		{
+			EdgelSet edgelSet{};
+			edgelSet.reserve(edgels.size());
+			for (img::Edgel const & edgel : edgels)
+			{
+				edgelSet.add(edgel);
+			}
+			return edgelSet;
+		}
+
+		//! Allocate space for numEdgels (without changing size())
+		inline
+		void
+		reserve
+			( std::size_t const & numEdgels
+			)
+		{
+			theRows.reserve(numEdgels);
+			theCols.reserve(numEdgels);
+			theGradRows.reserve(numEdgels);
+			theGradCols.reserve(numEdgels);
+		}
+
+		//! Remove all edgels (retaining allocated capacity for reuse)
+		inline
+		void
+		clear
+			()
+		{
+			theRows.clear();
+			theCols.clear();
+			theGradRows.clear();
+			theGradCols.clear();
+		}
+
+		//! Number of edgels in collection
+		inline
+		std::size_t
+		size
+			() const
+		{
+			return theRows.size();
+		}
+
+		//! True if there are no edgels in collection
+		inline
+		bool
+		empty
+			() const
+		{
+			return theRows.empty();
+		}
+
+		//! Append edgel at (row,col) with gradient (gRow,gCol)
+		inline
+		void
+		add
+			( float const & row
+			, float const & col
+			, float const & gRow
+			, float const & gCol
+			)
+		{
+			theRows.emplace_back(row);
+			theCols.emplace_back(col);
+			theGradRows.emplace_back(gRow);
+			theGradCols.emplace_back(gCol);
+		}
+
+		//! Append (float precision version of) edgel
+		inline
+		void
+		add
+			( img::Edgel const & edgel
+			)
+		{
+			img::Spot const loc{ edgel.location() };
+			img::Grad const grad{ edgel.gradient() };
+			add
+				( static_cast<float>(loc[0])
+				, static_cast<float>(loc[1])
+				, static_cast<float>(grad[0])
+				, static_cast<float>(grad[1])
+				);
+		}
+
+		//! Row locations (one per edgel)
+		inline
+		std::vector<float> const &
+		rows
+			() const
+		{
+			return theRows;
+		}
+
+		//! Column locations (one per edgel)
+		inline
+		std::vector<float> const &
+		cols
+			() const
+		{
+			return theCols;
+		}
+
+		//! Row gradient components (one per edgel)
+		inline
+		std::vector<float> const &
+		gRows
+			() const
+		{
+			return theGradRows;
+		}
+
+		//! Column gradient components (one per edgel)
+		inline
+		std::vector<float> const &
+		gCols
+			() const
+		{
+			return theGradCols;
+		}
+
+		//! Location of ndx-th edgel
+		inline
+		img::Spot
+		locationAt
+			( std::size_t const & ndx
+			) const
+		{
+			return img::Spot{ (double)theRows[ndx], (double)theCols[ndx] };
+		}
+
+		//! Gradient of ndx-th edgel
+		inline
+		img::Grad
+		gradientAt
+			( std::size_t const & ndx
+			) const
+		{
+			return img::Grad
+				{ (double)theGradRows[ndx]
+				, (double)theGradCols[ndx]
+				};
+		}
+
+		//! The ndx-th edgel (as an AoS img::Edgel instance)
+		inline
+		img::Edgel
+		edgelAt
+			( std::size_t const & ndx
+			) const
+		{
+			return img::Edgel(locationAt(ndx), gradientAt(ndx));
+		}
+
+		//! Gradient magnitudes for all edgels (*ptMags is resized)
+		inline
+		void
+		magnitudesInto
+			( std::vector<double> * const & ptMags
+			) const
+		{
+			std::vector<double> & mags = *ptMags;
+			mags.resize(size());
+			for (std::size_t ndx{0u} ; ndx < mags.size() ; ++ndx)
+			{
+				double const gRow{ theGradRows[ndx] };
+				double const gCol{ theGradCols[ndx] };
+				mags[ndx] = std::sqrt(gRow*gRow + gCol*gCol);
+			}
+		}
+
+		//! Gradient angles for all edgels (*ptAngles is resized)
+		inline
+		void
+		anglesInto
+			( std::vector<double> * const & ptAngles
+			) const
+		{
+			std::vector<double> & angles = *ptAngles;
+			angles.resize(size());
+			for (std::size_t ndx{0u} ; ndx < angles.size() ; ++ndx)
+			{
+				angles[ndx] = ang::atan2
+					((double)theGradCols[ndx], (double)theGradRows[ndx]);
+			}
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss << "size: " << size();
+			return oss.str();
+		}
+
+	}; // EdgelSet
+
+} // [img]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::img::EdgelSet const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+} // [anon/global]
+
@@ -39,11 +39,15 @@
 
 #include <Engabra>
 
+#include <algorithm>
+#include <bit>
+#include <cctype>
 #include <cstdint>
 #include <filesystem>
 #include <limits>
 #include <fstream>
 #include <sstream>
+#include <vector>
 
 
 namespace quadloco
@@ -145,6 +149,101 @@ namespace io
 			return Header(magic, high, wide, maxPix);
 		}
 
+		/*! \brief Populate header by parsing (in place) from memory buffer
+		 *
+		 * The buffer [beg,end) is assumed to start with the PGM header
+		 * (e.g. a memory mapped file). If successful, *ptDataOffset is
+		 * set to the (byte) offset from beg to the start of pixel data.
+		 * If the header cannot be parsed, the returned header has zero
+		 * size and *ptDataOffset is unchanged.
+		 */
+		inline
+		static
+		Header
+		fromBuffer
+			( char const * const & beg
+				//!< Start of buffer (i.e. start of PGM header)
+			, char const * const & end
+				//!< End of buffer (e.g. end of file)
+			, std::size_t * const & ptDataOffset
+				//!< Set to offset of first pixel data byte (if successful)
+			)
+		{
+			char const * ptCurr{ beg };
+
+			// skip whitespace and comments (from '#' to end of line)
+			auto const skipSpace
+				{ [&ptCurr, &end] ()
+				{
+					while (ptCurr < end)
+					{
+						if ('#' == *ptCurr)
+						{
+							while ((ptCurr < end) && ('\n' != *ptCurr))
+							{
+								++ptCurr;
+							}
+						}
+						else
+						if (std::isspace(static_cast<unsigned char>(*ptCurr)))
+						{
+							++ptCurr;
+						}
+						else
+						{
+							break;
+						}
+					}
+				}
+				};
+
+			// parse unsigned decimal value (zero if none available)
+			auto const nextValue
+				{ [&ptCurr, &end, &skipSpace] ()
+				{
+					skipSpace();
+					unsigned int value{ 0u };
+					while ( (ptCurr < end)
+						&& std::isdigit(static_cast<unsigned char>(*ptCurr))
+						  )
+					{
+						value = 10u*value + static_cast<unsigned int>
+							(*ptCurr - '0');
+						++ptCurr;
+					}
+					return value;
+				}
+				};
+
+			std::string magic{};
+			skipSpace();
+			if ((ptCurr + 1) < end)
+			{
+				magic = std::string(ptCurr, ptCurr + 2);
+				ptCurr += 2;
+			}
+			// NOTE PGM stores (wide,high) order
+			unsigned int const wide{ nextValue() };
+			unsigned int const high{ nextValue() };
+			unsigned int const maxPix{ nextValue() };
+
+			// exactly one whitespace character precedes the pixel data
+			bool const okay
+				{  ("P5" == magic)
+				&& (0u < wide) && (0u < high) && (0u < maxPix)
+				&& (ptCurr < end)
+				&& std::isspace(static_cast<unsigned char>(*ptCurr))
+				};
+			Header hdr(magic, 0u, 0u, 0u);
+			if (okay)
+			{
+				++ptCurr;
+				*ptDataOffset = static_cast<std::size_t>(ptCurr - beg);
+				hdr = Header(magic, high, wide, maxPix);
+			}
+			return hdr;
+		}
+
 		//! Value construction
 		inline
 		explicit
@@ -216,11 +315,149 @@ namespace io
 		hdr.toStream(ofs);
 
 		// write block of data to stream
-		ofs.write(reinterpret_cast<char const *>(ugrid.cbegin()), ugrid.size());
+		if (ugrid.isContiguous())
+		{
+			ofs.write
+				(reinterpret_cast<char const *>(ugrid.cbegin()), ugrid.size());
+		}
+		else // padded rows: write only the cells within each row
+		{
+			for (std::size_t row{0u} ; row < ugrid.high() ; ++row)
+			{
+				ofs.write
+					( reinterpret_cast<char const *>(ugrid.cbeginRow(row))
+					, ugrid.wide()
+					);
+			}
+		}
 
 		return (! ofs.fail());
 	}
 
+	//! Reverse byte order of each 16-bit value in [beg,end)
+	inline
+	void
+	swapBytes16
+		( uint16_t * const & beg
+		, uint16_t * const & end
+		)
+	{
+		for (uint16_t * ptr{ beg } ; end != ptr ; ++ptr)
+		{
+			// simple form that compilers recognize (and vectorize)
+			*ptr = static_cast<uint16_t>((*ptr >> 8u) | (*ptr << 8u));
+		}
+	}
+
+	/*! \brief Convert between host and big-endian (PGM) order in place.
+	 *
+	 * A no-op on big-endian hosts.
+	 */
+	inline
+	void
+	bigEndianSwap16
+		( uint16_t * const & beg
+		, uint16_t * const & end
+		)
+	{
+		if constexpr (std::endian::little == std::endian::native)
+		{
+			swapBytes16(beg, end);
+		}
+	}
+
+	/*! \brief Write grid contents in 16-bit PGM file format.
+	 *
+	 * Pixel values are written with two bytes each in big-endian order
+	 * (per the PGM specification for maxval greater than 255).
+	 */
+	inline
+	bool
+	writePGM
+		( std::filesystem::path const & pgmPath
+		, ras::Grid<uint16_t> const & ugrid
+		)
+	{
+		std::ofstream ofs
+			( pgmPath
+			, std::ios_base::out
+			| std::ios_base::binary
+			| std::ios_base::trunc
+			);
+		Header const hdr(ugrid);
+		hdr.toStream(ofs);
+
+		// write (byte swapped) data row by row
+		std::vector<uint16_t> rowBuf(ugrid.wide());
+		for (std::size_t row{0u} ; row < ugrid.high() ; ++row)
+		{
+			std::copy(ugrid.cbeginRow(row), ugrid.cendRow(row), rowBuf.begin());
+			bigEndianSwap16(rowBuf.data(), rowBuf.data() + rowBuf.size());
+			ofs.write
+				( reinterpret_cast<char const *>(rowBuf.data())
+				, rowBuf.size() * sizeof(uint16_t)
+				);
+		}
+
+		return (! ofs.fail());
+	}
+
+	/*! \brief Grid of 16-bit image pixels retrieved from pgmPath
+	 *
+	 * Supports PGM files with any maxval in range [1,65535]. For
+	 * maxval larger than 255, samples are (big-endian) 16-bit values
+	 * which are byte-swapped in place (as needed for host order).
+	 * For smaller maxval, the 8-bit samples are widened to uint16_t.
+	 * Values are *not* rescaled (e.g. 12-bit data remain [0,4095]).
+	 */
+	inline
+	ras::Grid<uint16_t>
+	readPGM16
+		( std::filesystem::path const & pgmPath
+		)
+	{
+		ras::Grid<uint16_t> ugrid{};
+		std::ifstream ifs
+			( pgmPath
+			, std::ios_base::in
+			| std::ios_base::binary
+			);
+
+		// read header info
+		Header const hdr{ Header::fromStream(ifs) };
+		ras::SizeHW const hwSize{ hdr.hwSize() };
+		unsigned int const maxPix{ hdr.theMaxPix };
+
+		// if valid header info, then read pixel values
+		if (hwSize.isValid() && (0u < maxPix) && (maxPix < 65536u))
+		{
+			ugrid = ras::Grid<uint16_t>(hwSize);
+			if (255u < maxPix)
+			{
+				// read block of data directly into image and fix byte order
+				ifs.read
+					( reinterpret_cast<char*>(ugrid.begin())
+					, ugrid.size() * sizeof(uint16_t)
+					);
+				bigEndianSwap16(ugrid.begin(), ugrid.end());
+			}
+			else
+			{
+				// one byte per sample - widen into image
+				std::vector<uint8_t> bytes(ugrid.size());
+				ifs.read(reinterpret_cast<char*>(bytes.data()), bytes.size());
+				std::copy(bytes.cbegin(), bytes.cend(), ugrid.begin());
+			}
+
+			if (ifs.fail())
+			{
+				ugrid = ras::Grid<uint16_t>{};
+			}
+		}
+
+		return ugrid;
+	}
+
 	//! Grid of image pixels retrieved from pgmPath
 	inline
 	ras::Grid<uint8_t>
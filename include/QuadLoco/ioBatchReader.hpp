@@ -0,0 +1,345 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::io::BatchReader (prefetching image load)
+ *
+ */
+
+
+#include "QuadLoco/io.hpp"
+#include "QuadLoco/rasGrid.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace quadloco
+{
+
+namespace io
+{
+
+	/*! \brief Load a sequence of PGM images on a background thread.
+	 *
+	 * A worker thread reads (and decodes) images in the order of the
+	 * provided path list and places them into a bounded queue. The
+	 * consumer pulls ready frames with nextFrame(), so that file i/o
+	 * overlaps with processing of previous images. At most
+	 * queueDepth() decoded frames are held in memory at any time.
+	 *
+	 * Every path produces exactly one frame (in order). Frames for
+	 * files that could not be read contain a null grid.
+	 *
+	 * Destroying the reader stops the worker (any unconsumed frames
+	 * are discarded). Instances can be neither copied nor moved.
+	 *
+	 * \par Example
+	 * \snippet test/test_ioBatchReader.cpp DoxyExample01
+	 */
+	class BatchReader
+	{
+
+	public:
+
+		//! Image (and the file from which it was loaded)
+		struct Frame
+		{
+			//! Source file path
+			std::filesystem::path thePath{};
+
+			//! Pixel data (null if file was not loaded)
+			ras::Grid<std::uint8_t> theGrid{};
+
+			//! True if theGrid contains data
+			inline
+			bool
+			isValid
+				() const
+			{
+				return theGrid.isValid();
+			}
+
+		}; // Frame
+
+	private:
+
+		//! Files to load (in order)
+		std::vector<std::filesystem::path> const thePaths{};
+
+		//! Maximum number of frames pending in theQueue
+		std::size_t const theQueueDepth{ 0u };
+
+		//! Guard for theQueue, theStop and theIsDone
+		mutable std::mutex theMutex{};
+
+		//! Signaled when theQueue has room (or theStop is set)
+		std::condition_variable theCvNotFull{};
+
+		//! Signaled when theQueue has a frame (or worker is done)
+		std::condition_variable theCvNotEmpty{};
+
+		//! Frames loaded and not yet consumed
+		std::deque<Frame> theQueue{};
+
+		//! Set by consumer (destructor) to request worker exit
+		bool theStop{ false };
+
+		//! Set by worker after last frame has been queued
+		bool theIsDone{ false };
+
+		//! Background thread (last member: starts after others exist)
+		std::thread theWorker{};
+
+		//! Worker thread body: load each path and queue the result
+		inline
+		void
+		loadAll
+			()
+		{
+			for (std::filesystem::path const & path : thePaths)
+			{
+				// decode without holding the lock
+				Frame frame{ path, readPGM(path) };
+
+				std::unique_lock<std::mutex> lock(theMutex);
+				theCvNotFull.wait
+					( lock
+					, [this] ()
+						{
+							return
+								(theStop || (theQueue.size() < theQueueDepth));
+						}
+					);
+				if (theStop)
+				{
+					break;
+				}
+				theQueue.emplace_back(std::move(frame));
+				lock.unlock();
+				theCvNotEmpty.notify_one();
+			}
+
+			{
+				std::lock_guard<std::mutex> const lock(theMutex);
+				theIsDone = true;
+			}
+			theCvNotEmpty.notify_all();
+		}
+
+	public:
+
+		//! Sorted list of files in directory with (case sensitive) extension
+		inline
+		static
+		std::vector<std::filesystem::path>
+		pathsInDirectory
+			( std::filesystem::path const & dirPath
+			, std::string const & extension = ".pgm"
+			)
+		{
+			std::vector<std::filesystem::path> paths;
+			std::error_code errCode{};
+			if (std::filesystem::is_directory(dirPath, errCode))
+			{
+				for (std::filesystem::directory_entry const & entry
+					: std::filesystem::directory_iterator(dirPath, errCode))
+				{
+					if ( entry.is_regular_file(errCode)
+					  && (extension == entry.path().extension().string())
+					   )
+					{
+						paths.emplace_back(entry.path());
+					}
+				}
+			}
+			std::sort(paths.begin(), paths.end());
+			return paths;
+		}
+
+		//! Start background loading of (each of) paths
+		inline
+		explicit
+		BatchReader
+			( std::vector<std::filesystem::path> const & paths
+				//!< Files to load - frames are provided in this order
+			, std::size_t const & queueDepth = 2u
+				//!< Max number of loaded frames waiting for consumer (min 1)
+			)
+			: thePaths{ paths }
+			, theQueueDepth{ std::max(queueDepth, std::size_t{ 1u }) }
+			, theWorker(&BatchReader::loadAll, this)
+		{ }
+
+		//! Start background loading of all ".pgm" files in directory
+		inline
+		explicit
+		BatchReader
+			( std::filesystem::path const & dirPath
+				//!< Directory to search for ".pgm" files (sorted by name)
+			, std::size_t const & queueDepth = 2u
+				//!< Max number of loaded frames waiting for consumer (min 1)
+			)
+			: BatchReader(pathsInDirectory(dirPath), queueDepth)
+		{ }
+
+		//! DISABLE copy construction (worker refers to this instance)
+		BatchReader
+			(BatchReader const &) = delete;
+
+		//! DISABLE copy assignment
+		BatchReader &
+		operator=
+			(BatchReader const &) = delete;
+
+		//! Stop worker thread (discarding any unconsumed frames)
+		inline
+		~BatchReader
+			()
+		{
+			{
+				std::lock_guard<std::mutex> const lock(theMutex);
+				theStop = true;
+			}
+			theCvNotFull.notify_all();
+			if (theWorker.joinable())
+			{
+				theWorker.join();
+			}
+		}
+
+		//! Number of frames this instance will provide (== num paths)
+		inline
+		std::size_t
+		size
+			() const
+		{
+			return thePaths.size();
+		}
+
+		//! Maximum number of frames buffered ahead of consumer
+		inline
+		std::size_t
+		queueDepth
+			() const
+		{
+			return theQueueDepth;
+		}
+
+		/*! \brief Wait for next frame, (false if all have been provided).
+		 *
+		 * On success, *ptFrame is set to the next frame (in path order).
+		 * Note that ptFrame->theGrid is null if that file was not read.
+		 */
+		inline
+		bool
+		nextFrame
+			( Frame * const & ptFrame
+			)
+		{
+			bool gotFrame{ false };
+			std::unique_lock<std::mutex> lock(theMutex);
+			theCvNotEmpty.wait
+				( lock
+				, [this] ()
+					{ return (theIsDone || (! theQueue.empty())); }
+				);
+			if (! theQueue.empty())
+			{
+				if (ptFrame)
+				{
+					*ptFrame = std::move(theQueue.front());
+				}
+				theQueue.pop_front();
+				gotFrame = true;
+			}
+			lock.unlock();
+			theCvNotFull.notify_one();
+			return gotFrame;
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::size_t numPending{ 0u };
+			{
+				std::lock_guard<std::mutex> const lock(theMutex);
+				numPending = theQueue.size();
+			}
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss
+				<< "size: " << size()
+				<< ' '
+				<< "queueDepth: " << queueDepth()
+				<< ' '
+				<< "numPending: " << numPending
+				;
+			return oss.str();
+		}
+
+	}; // BatchReader
+
+
+} // [io]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::io::BatchReader const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+} // [anon/global]
+
@@ -0,0 +1,569 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::io binary grid (".qgrid") file i/o
+ *
+ * Compact binary file format for intermediate raster data (e.g. for
+ * debugging and/or pipeline stage handoff). This is much faster and
+ * smaller than the ASCII dumps from io::writeAsciiFile().
+ *
+ * File layout (all multi-byte values are little-endian):
+ * \verbatim
+ * offset  size  content
+ *      0     8  magic "QLBGRID1"
+ *      8    16  type code (NUL padded) e.g. "float32", "float64", "grad2f64"
+ *     24     8  uint64 high (number of rows)
+ *     32     8  uint64 wide (number of columns)
+ *     40     8  float64 value used in payload to represent null cells
+ *     48     4  uint32 bytes per component (4 or 8)
+ *     52     4  uint32 components per cell (1, or 2 for img::Grad)
+ *     56     8  reserved (zero)
+ *     64   ...  payload: high*wide*components values in row major order
+ * \endverbatim
+ */
+
+
+#include "QuadLoco/imgGrad.hpp"
+#include "QuadLoco/ioMappedFile.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace quadloco
+{
+
+namespace io
+{
+
+	/*! \brief Per cell type encoding traits for binary grid files.
+	 *
+	 * Specializations provide the type code (as stored in file), the
+	 * component value type and the conversion between a cell and its
+	 * components.
+	 */
+	template <typename Type>
+	struct BinGridTraits;
+
+	//! Encoding for single precision grids
+	template <>
+	struct BinGridTraits<float>
+	{
+		using CompType = float;
+		static constexpr char const * theTypeCode{ "float32" };
+		static constexpr std::size_t theNumComp{ 1u };
+
+		//! Components (into comps) for cell
+		inline
+		static
+		void
+		toComps
+			( float const & cell
+			, CompType * const & comps
+			)
+		{
+			comps[0] = cell;
+		}
+
+		//! Cell (into cell) from components
+		inline
+		static
+		void
+		fromComps
+			( CompType const * const & comps
+			, float * const & cell
+			)
+		{
+			*cell = comps[0];
+		}
+	};
+
+	//! Encoding for double precision grids
+	template <>
+	struct BinGridTraits<double>
+	{
+		using CompType = double;
+		static constexpr char const * theTypeCode{ "float64" };
+		static constexpr std::size_t theNumComp{ 1u };
+
+		//! Components (into comps) for cell
+		inline
+		static
+		void
+		toComps
+			( double const & cell
+			, CompType * const & comps
+			)
+		{
+			comps[0] = cell;
+		}
+
+		//! Cell (into cell) from components
+		inline
+		static
+		void
+		fromComps
+			( CompType const * const & comps
+			, double * const & cell
+			)
+		{
+			*cell = comps[0];
+		}
+	};
+
+	//! Encoding for gradient grids (two double components per cell)
+	template <>
+	struct BinGridTraits<img::Grad>
+	{
+		using CompType = double;
+		static constexpr char const * theTypeCode{ "grad2f64" };
+		static constexpr std::size_t theNumComp{ 2u };
+
+		//! Components (into comps) for cell
+		inline
+		static
+		void
+		toComps
+			( img::Grad const & cell
+			, CompType * const & comps
+			)
+		{
+			comps[0] = cell[0];
+			comps[1] = cell[1];
+		}
+
+		//! Cell (into cell) from components
+		inline
+		static
+		void
+		fromComps
+			( CompType const * const & comps
+			, img::Grad * const & cell
+			)
+		{
+			*cell = img::Grad{ comps[0], comps[1] };
+		}
+	};
+
+
+	//! Byte (re)ordering between host and little-endian file values
+	template <typename Type>
+	inline
+	Type
+	littleEndian
+		( Type const & value
+		)
+	{
+		Type result{ value };
+		if constexpr (std::endian::big == std::endian::native)
+		{
+			std::array<unsigned char, sizeof(Type)> bytes;
+			std::memcpy(bytes.data(), &value, sizeof(Type));
+			std::reverse(bytes.begin(), bytes.end());
+			std::memcpy(&result, bytes.data(), sizeof(Type));
+		}
+		return result;
+	}
+
+	//! Fixed size (64 byte) header for binary grid files
+	struct BinGridHeader
+	{
+		//! Number of bytes consumed by header (payload starts here)
+		static constexpr std::size_t theByteSize{ 64u };
+
+		//! Leading file signature
+		static constexpr char theMagic[9u]{ "QLBGRID1" };
+
+		//! Maximum number of characters in type code
+		static constexpr std::size_t theMaxCodeSize{ 16u };
+
+		//! Cell type code (e.g. BinGridTraits<Type>::theTypeCode)
+		std::string theTypeCode{};
+
+		//! Grid dimensions
+		std::size_t theHigh{ 0u };
+		std::size_t theWide{ 0u };
+
+		//! Component value written to file in place of null (NaN) values
+		double theNullValue{ std::numeric_limits<double>::quiet_NaN() };
+
+		//! Number of bytes in each component
+		std::size_t theCompBytes{ 0u };
+
+		//! Number of components in each cell
+		std::size_t theNumComp{ 0u };
+
+		//! Header for a grid of (hwSize) Type cells
+		template <typename Type>
+		inline
+		static
+		BinGridHeader
+		forGrid
+			( ras::SizeHW const & hwSize
+			, double const & nullValue
+			)
+		{
+			using Traits = BinGridTraits<Type>;
+			return BinGridHeader
+				{ .theTypeCode = Traits::theTypeCode
+				, .theHigh = hwSize.high()
+				, .theWide = hwSize.wide()
+				, .theNullValue = nullValue
+				, .theCompBytes = sizeof(typename Traits::CompType)
+				, .theNumComp = Traits::theNumComp
+				};
+		}
+
+		/*! \brief Header decoded from start of buffer (null if not valid)
+		 *
+		 * The buffer, [beg,end), must contain at least theByteSize bytes.
+		 */
+		inline
+		static
+		BinGridHeader
+		fromBuffer
+			( char const * const & beg
+			, char const * const & end
+			)
+		{
+			BinGridHeader header{};
+			if ( (nullptr != beg)
+			  && (! (static_cast<std::size_t>(end - beg) < theByteSize))
+			  && (0 == std::memcmp(beg, theMagic, 8u))
+			   )
+			{
+				char code[theMaxCodeSize + 1u]{};
+				std::memcpy(code, beg + 8u, theMaxCodeSize);
+				header.theTypeCode = std::string(code);
+				header.theHigh = static_cast<std::size_t>
+					(valueAt<uint64_t>(beg + 24u));
+				header.theWide = static_cast<std::size_t>
+					(valueAt<uint64_t>(beg + 32u));
+				header.theNullValue = valueAt<double>(beg + 40u);
+				header.theCompBytes = static_cast<std::size_t>
+					(valueAt<uint32_t>(beg + 48u));
+				header.theNumComp = static_cast<std::size_t>
+					(valueAt<uint32_t>(beg + 52u));
+			}
+			return header;
+		}
+
+		//! Value (little-endian in file) at ptr
+		template <typename Type>
+		inline
+		static
+		Type
+		valueAt
+			( char const * const & ptr
+			)
+		{
+			Type value;
+			std::memcpy(&value, ptr, sizeof(Type));
+			return littleEndian(value);
+		}
+
+		//! True if this instance is not null
+		inline
+		bool
+		isValid
+			() const
+		{
+			return
+				(  (! theTypeCode.empty())
+				&& hwSize().isValid()
+				&& (0u < theCompBytes)
+				&& (0u < theNumComp)
+				);
+		}
+
+		//! Dimensions of grid
+		inline
+		ras::SizeHW
+		hwSize
+			() const
+		{
+			return ras::SizeHW{ theHigh, theWide };
+		}
+
+		//! Number of bytes in payload (following header)
+		inline
+		std::size_t
+		payloadSize
+			() const
+		{
+			return (theHigh * theWide * theNumComp * theCompBytes);
+		}
+
+		//! True if this header describes a file of Type cells
+		template <typename Type>
+		inline
+		bool
+		isForType
+			() const
+		{
+			using Traits = BinGridTraits<Type>;
+			return
+				(  isValid()
+				&& (std::string(Traits::theTypeCode) == theTypeCode)
+				&& (sizeof(typename Traits::CompType) == theCompBytes)
+				&& (Traits::theNumComp == theNumComp)
+				);
+		}
+
+		//! Encoded (file) representation of this header
+		inline
+		std::array<char, theByteSize>
+		bytes
+			() const
+		{
+			std::array<char, theByteSize> buf{};
+			std::memcpy(buf.data(), theMagic, 8u);
+			std::size_t const codeSize
+				{ std::min(theTypeCode.size(), theMaxCodeSize) };
+			std::memcpy(buf.data() + 8u, theTypeCode.data(), codeSize);
+			putValue(buf.data() + 24u, static_cast<uint64_t>(theHigh));
+			putValue(buf.data() + 32u, static_cast<uint64_t>(theWide));
+			putValue(buf.data() + 40u, theNullValue);
+			putValue(buf.data() + 48u, static_cast<uint32_t>(theCompBytes));
+			putValue(buf.data() + 52u, static_cast<uint32_t>(theNumComp));
+			return buf;
+		}
+
+		//! Store value into ptr in little-endian order
+		template <typename Type>
+		inline
+		static
+		void
+		putValue
+			( char * const & ptr
+			, Type const & value
+			)
+		{
+			Type const fileValue{ littleEndian(value) };
+			std::memcpy(ptr, &fileValue, sizeof(Type));
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss
+				<< "TypeCode: " << theTypeCode
+				<< ' ' << "High: " << theHigh
+				<< ' ' << "Wide: " << theWide
+				<< ' ' << "NullValue: " << theNullValue
+				<< ' ' << "CompBytes: " << theCompBytes
+				<< ' ' << "NumComp: " << theNumComp
+				;
+			return oss.str();
+		}
+
+	}; // BinGridHeader
+
+
+	/*! \brief Write grid to binary (".qgrid") file.
+	 *
+	 * Null (NaN) components are written as nullValue. Data are written
+	 * one row at a time (so padded grids are handled naturally).
+	 *
+	 * \par Example
+	 * \snippet test/test_ioBinGrid.cpp DoxyExample01
+	 */
+	template <typename Type>
+	inline
+	bool
+	writeBinGrid
+		( std::filesystem::path const & outPath
+			//!< File to create (overwritten if exists)
+		, ras::Grid<Type> const & grid
+			//!< Grid of float, double, or img::Grad values
+		, double const & nullValue = std::numeric_limits<double>::quiet_NaN()
+			//!< Value to store for null (NaN) components
+		)
+	{
+		using Traits = BinGridTraits<Type>;
+		using CompType = typename Traits::CompType;
+		constexpr std::size_t numComp{ Traits::theNumComp };
+
+		BinGridHeader const header
+			{ BinGridHeader::forGrid<Type>(grid.hwSize(), nullValue) };
+		std::array<char, BinGridHeader::theByteSize> const headBytes
+			{ header.bytes() };
+
+		std::ofstream ofs(outPath, std::ios::binary);
+		ofs.write(headBytes.data(), headBytes.size());
+
+		CompType const fileNull{ static_cast<CompType>(nullValue) };
+		std::vector<CompType> rowBuf(grid.wide() * numComp);
+		for (std::size_t row{0u} ; row < grid.high() ; ++row)
+		{
+			CompType * ptComp{ rowBuf.data() };
+			for (typename ras::Grid<Type>::const_iterator
+				iter{grid.cbeginRow(row)} ; grid.cendRow(row) != iter
+				; ++iter, ptComp += numComp)
+			{
+				Traits::toComps(*iter, ptComp);
+			}
+			for (CompType & comp : rowBuf)
+			{
+				if (std::isnan(comp))
+				{
+					comp = fileNull;
+				}
+				comp = littleEndian(comp);
+			}
+			ofs.write
+				( reinterpret_cast<char const *>(rowBuf.data())
+				, rowBuf.size() * sizeof(CompType)
+				);
+		}
+		return (! ofs.fail());
+	}
+
+	/*! \brief Grid loaded from binary file via memory mapping.
+	 *
+	 * Returns null grid if file is not a binary grid file, if the
+	 * file cell type does not match Type, or if the file is truncated.
+	 * Payload components equal to the header null value are returned
+	 * as NaN. Optional layout applies to the returned grid.
+	 */
+	template <typename Type>
+	inline
+	ras::Grid<Type>
+	readBinGrid
+		( std::filesystem::path const & inPath
+			//!< File previously created by writeBinGrid()
+		, ras::GridLayout const & layout = {}
+			//!< Storage layout for returned grid
+		)
+	{
+		using Traits = BinGridTraits<Type>;
+		using CompType = typename Traits::CompType;
+		constexpr std::size_t numComp{ Traits::theNumComp };
+
+		ras::Grid<Type> grid{};
+		MappedFile const map(inPath);
+		if (map.isValid())
+		{
+			BinGridHeader const header
+				{ BinGridHeader::fromBuffer(map.cbegin(), map.cend()) };
+			std::size_t const needSize
+				{ BinGridHeader::theByteSize + header.payloadSize() };
+			if ( header.isForType<Type>()
+			  && (! (map.size() < needSize))
+			   )
+			{
+				bool const mapNulls{ ! std::isnan(header.theNullValue) };
+				CompType const fileNull
+					{ static_cast<CompType>(header.theNullValue) };
+				CompType const nan
+					{ std::numeric_limits<CompType>::quiet_NaN() };
+
+				grid = ras::Grid<Type>(header.hwSize(), layout);
+				std::vector<CompType> rowBuf(grid.wide() * numComp);
+				std::size_t const rowBytes{ rowBuf.size() * sizeof(CompType) };
+				char const * ptFile
+					{ map.cbegin() + BinGridHeader::theByteSize };
+				for (std::size_t row{0u} ; row < grid.high()
+					; ++row, ptFile += rowBytes)
+				{
+					std::memcpy(rowBuf.data(), ptFile, rowBytes);
+					for (CompType & comp : rowBuf)
+					{
+						comp = littleEndian(comp);
+						if (mapNulls && (fileNull == comp))
+						{
+							comp = nan;
+						}
+					}
+					CompType const * ptComp{ rowBuf.data() };
+					for (typename ras::Grid<Type>::iterator
+						iter{grid.beginRow(row)} ; grid.endRow(row) != iter
+						; ++iter, ptComp += numComp)
+					{
+						Traits::fromComps(ptComp, &(*iter));
+					}
+				}
+			}
+		}
+		return grid;
+	}
+
+
+} // [io]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::io::BinGridHeader const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	inline
+	bool
+	isValid
+		( quadloco::io::BinGridHeader const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
@@ -0,0 +1,265 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::io::MappedFile (read only memory map)
+ *
+ */
+
+
+#include <filesystem>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+namespace quadloco
+{
+
+namespace io
+{
+
+	/*! \brief Read only memory mapping of an entire file (POSIX mmap).
+	 *
+	 * The file content is accessible via the [cbegin(),cend()) range
+	 * for as long as this instance exists. Instances are move-only;
+	 * the mapping is released at destruction. Construction failures
+	 * (e.g. missing or empty file) produce a null instance for which
+	 * isValid() is false.
+	 *
+	 * \par Example
+	 * \snippet test/test_ioMappedFile.cpp DoxyExample01
+	 */
+	class MappedFile
+	{
+		//! Start of mapped memory (or null)
+		void * theAddr{ nullptr };
+
+		//! Number of bytes mapped
+		std::size_t theSize{ 0u };
+
+		//! Release the mapping (if any)
+		inline
+		void
+		release
+			()
+		{
+			if (theAddr)
+			{
+				(void)::munmap(theAddr, theSize);
+				theAddr = nullptr;
+				theSize = 0u;
+			}
+		}
+
+	public:
+
+		//! Construct a null instance (isValid() == false)
+		inline
+		MappedFile
+			() = default;
+
+		//! Map the full contents of file at path into (read only) memory
+		inline
+		explicit
+		MappedFile
+			( std::filesystem::path const & path
+				//!< File to map (must exist and be non-empty)
+			, bool const & prefault = false
+				//!< If true, request pages be loaded now (where supported)
+			)
+		{
+			int const fd{ ::open(path.c_str(), O_RDONLY) };
+			if (! (fd < 0))
+			{
+				struct stat info{};
+				if ((0 == ::fstat(fd, &info)) && (0 < info.st_size))
+				{
+					std::size_t const size
+						{ static_cast<std::size_t>(info.st_size) };
+					int flags{ MAP_PRIVATE };
+#if defined(MAP_POPULATE)
+					if (prefault)
+					{
+						flags |= MAP_POPULATE;
+					}
+#else
+					(void)prefault;
+#endif
+					void * const addr
+						{ ::mmap(nullptr, size, PROT_READ, flags, fd, 0) };
+					if (MAP_FAILED != addr)
+					{
+						theAddr = addr;
+						theSize = size;
+					}
+				}
+				// mapping remains valid after descriptor is closed
+				(void)::close(fd);
+			}
+		}
+
+		//! Copying not supported (mapping is uniquely owned)
+		MappedFile
+			(MappedFile const &) = delete;
+
+		//! Copying not supported (mapping is uniquely owned)
+		MappedFile &
+		operator=
+			(MappedFile const &) = delete;
+
+		//! Move construction (mapped addresses remain unchanged)
+		inline
+		MappedFile
+			( MappedFile && orig
+			) noexcept
+			: MappedFile()
+		{
+			std::swap(theAddr, orig.theAddr);
+			std::swap(theSize, orig.theSize);
+		}
+
+		//! Move assignment (mapped addresses remain unchanged)
+		inline
+		MappedFile &
+		operator=
+			( MappedFile && rhs
+			) noexcept
+		{
+			if (&rhs != this)
+			{
+				release();
+				std::swap(theAddr, rhs.theAddr);
+				std::swap(theSize, rhs.theSize);
+			}
+			return *this;
+		}
+
+		//! Release mapping resources
+		inline
+		~MappedFile
+			()
+		{
+			release();
+		}
+
+		//! True if this instance has a valid mapping
+		inline
+		bool
+		isValid
+			() const
+		{
+			return (theAddr && (0u < theSize));
+		}
+
+		//! Number of bytes in mapping (size of file)
+		inline
+		std::size_t
+		size
+			() const
+		{
+			return theSize;
+		}
+
+		//! Start of mapped file content
+		inline
+		char const *
+		cbegin
+			() const
+		{
+			return static_cast<char const *>(theAddr);
+		}
+
+		//! End of mapped file content
+		inline
+		char const *
+		cend
+			() const
+		{
+			return (cbegin() + theSize);
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss
+				<< "isValid: " << isValid()
+				<< ' '
+				<< "size: " << theSize
+				;
+			return oss.str();
+		}
+
+	}; // MappedFile
+
+
+} // [io]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::io::MappedFile const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	inline
+	bool
+	isValid
+		( quadloco::io::MappedFile const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
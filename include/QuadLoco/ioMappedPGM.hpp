@@ -0,0 +1,205 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::io::MappedPGM (zero copy PGM access)
+ *
+ */
+
+
+#include "QuadLoco/io.hpp"
+#include "QuadLoco/ioMappedFile.hpp"
+#include "QuadLoco/rasGridView.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <sstream>
+#include <string>
+
+
+namespace quadloco
+{
+
+namespace io
+{
+
+	/*! \brief Memory mapped 8-bit PGM file with zero copy pixel access.
+	 *
+	 * The header is parsed in place within the mapped file and the
+	 * pixel payload is exposed as a (read only) ras::GridView that
+	 * refers directly into the mapping. The view remains valid for
+	 * the lifetime of this instance (including after a move).
+	 *
+	 * Only binary ("P5") files with maximum pixel value of 255 are
+	 * supported. Other files produce a null instance (as for readPGM).
+	 *
+	 * \par Example
+	 * \snippet test/test_ioMappedPGM.cpp DoxyExample01
+	 */
+	class MappedPGM
+	{
+		//! Memory mapping of entire file
+		MappedFile theMap{};
+
+		//! Header information parsed from the mapped file
+		Header theHeader{ std::string{}, 0u, 0u, 0u };
+
+		//! View into pixel data (within theMap)
+		ras::GridView<uint8_t> theView{};
+
+	public:
+
+		//! Construct a null instance (isValid() == false)
+		inline
+		MappedPGM
+			() = default;
+
+		//! Map file and (if valid PGM) attach view to pixel data.
+		inline
+		explicit
+		MappedPGM
+			( std::filesystem::path const & pgmPath
+				//!< PGM file to map
+			, bool const & prefault = false
+				//!< If true, request pages be loaded now (where supported)
+			)
+			: theMap(pgmPath, prefault)
+		{
+			if (theMap.isValid())
+			{
+				std::size_t dataOffset{ 0u };
+				theHeader = Header::fromBuffer
+					(theMap.cbegin(), theMap.cend(), &dataOffset);
+				ras::SizeHW const hwSize{ theHeader.hwSize() };
+				std::size_t const endOffset{ dataOffset + hwSize.size() };
+				if ( hwSize.isValid()
+				  && (255u == theHeader.theMaxPix)
+				  && (! (theMap.size() < endOffset))
+				   )
+				{
+					uint8_t const * const ptData
+						{ reinterpret_cast<uint8_t const *>
+							(theMap.cbegin() + dataOffset)
+						};
+					theView = ras::GridView<uint8_t>
+						(ptData, hwSize, hwSize.wide());
+				}
+			}
+		}
+
+		//! True if this instance provides a valid pixel view
+		inline
+		bool
+		isValid
+			() const
+		{
+			return (theMap.isValid() && theView.isValid());
+		}
+
+		//! Header information from the mapped file
+		inline
+		Header const &
+		header
+			() const
+		{
+			return theHeader;
+		}
+
+		//! Size of the image
+		inline
+		ras::SizeHW
+		hwSize
+			() const
+		{
+			return theView.hwSize();
+		}
+
+		//! Read only view into pixel data (valid while this instance exists)
+		inline
+		ras::GridView<uint8_t> const &
+		gridView
+			() const
+		{
+			return theView;
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss
+				<< "theMap: " << theMap
+				<< ' '
+				<< "theView: " << theView
+				;
+			return oss.str();
+		}
+
+	}; // MappedPGM
+
+
+} // [io]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::io::MappedPGM const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	inline
+	bool
+	isValid
+		( quadloco::io::MappedPGM const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
@@ -34,6 +34,7 @@
 
 #include "QuadLoco/matEigen2D.hpp"
 #include "QuadLoco/matfunc.hpp"
+#include "QuadLoco/matMat2.hpp"
 #include "QuadLoco/mattype.hpp"
 
 
@@ -34,6 +34,7 @@
 
 #include "QuadLoco/imgVector.hpp"
 #include "QuadLoco/matfunc.hpp"
+#include "QuadLoco/matMat2.hpp"
 #include "QuadLoco/mat.hpp"
 #include "QuadLoco/mattype.hpp"
 #include "QuadLoco/rasGrid.hpp"
@@ -95,11 +96,11 @@ namespace mat
 		inline
 		explicit
 		Eigen2D
-			( ras::Grid<double> const & mat2D
+			( Mat2 const & mat2D
 			)
 		{
-			double const det{ determinant2x2(mat2D) };
-			double const trc{ trace2x2(mat2D) };
+			double const det{ mat2D.determinant() };
+			double const trc{ mat2D.trace() };
 			double const gotRadicand{ .25*trc*trc - det };
 			// allow some tolerance for numeric error
 			// (this is probably not the best way to compute EVs)
@@ -136,6 +137,15 @@ namespace mat
 			}
 		}
 
+		//! Perform eigen value/vector decomposition (of a 2x2 Grid)
+		inline
+		explicit
+		Eigen2D
+			( ras::Grid<double> const & mat2D
+			)
+			: Eigen2D(Mat2::from(mat2D))
+		{ }
+
 		//! True if decomposition is well defined
 		inline
 		bool
@@ -186,11 +196,11 @@ namespace mat
 
 		//! Matrix values reconstituted from eigen decomposition
 		inline
-		ras::Grid<double>
-		matrix
+		Mat2
+		mat2
 			() const
 		{
-			Matrix mat(2u, 2u);
+			Mat2 mat{};
 			double const & v11 = theVecMin[0];
 			double const & v12 = theVecMin[1];
 			double const & d1 = theLamMin;
@@ -204,6 +214,15 @@ namespace mat
 			return mat;
 		}
 
+		//! Matrix values reconstituted from eigen decomposition (as Grid)
+		inline
+		ras::Grid<double>
+		matrix
+			() const
+		{
+			return mat2().matrix();
+		}
+
 		//! Descriptive information about this instance.
 		inline
 		std::string
@@ -0,0 +1,383 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::mat::Mat2 fixed size 2x2 matrix
+ *
+ */
+
+
+#include "QuadLoco/imgVector.hpp"
+#include "QuadLoco/mattype.hpp"
+
+#include <Engabra>
+
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+
+
+namespace quadloco
+{
+
+namespace mat
+{
+
+	/*! \brief Fixed size 2x2 matrix (value type, no heap allocation)
+	 *
+	 * Elements are stored in row major order within theData. The
+	 * basic operations are constexpr so that they can be evaluated at
+	 * compile time (e.g. in static_assert() checks).
+	 *
+	 * A default constructed instance is null (isValid() == false).
+	 *
+	 * \par Example
+	 * \snippet test/test_matMat2.cpp DoxyExample01
+	 */
+	struct Mat2
+	{
+		//! Element values in row major order: (0,0), (0,1), (1,0), (1,1)
+		std::array<double, 4u> theData
+			{ std::numeric_limits<double>::quiet_NaN()
+			, std::numeric_limits<double>::quiet_NaN()
+			, std::numeric_limits<double>::quiet_NaN()
+			, std::numeric_limits<double>::quiet_NaN()
+			};
+
+		//! Matrix with all elements zero
+		inline
+		constexpr
+		static
+		Mat2
+		zero
+			()
+		{
+			return Mat2{ 0., 0., 0., 0. };
+		}
+
+		//! Identity matrix
+		inline
+		constexpr
+		static
+		Mat2
+		identity
+			()
+		{
+			return Mat2{ 1., 0., 0., 1. };
+		}
+
+		//! Diagonal matrix with diag0 and diag1 along the diagonal
+		inline
+		constexpr
+		static
+		Mat2
+		diagonal
+			( double const & diag0
+			, double const & diag1
+			)
+		{
+			return Mat2{ diag0, 0., 0., diag1 };
+		}
+
+		//! Values from a (heap based) mat::Matrix (null unless 2x2)
+		inline
+		static
+		Mat2
+		from
+			( Matrix const & matrix
+			)
+		{
+			Mat2 mat{};
+			if ((2u == matrix.high()) && (2u == matrix.wide()))
+			{
+				mat = Mat2
+					{ matrix(0u, 0u), matrix(0u, 1u)
+					, matrix(1u, 0u), matrix(1u, 1u)
+					};
+			}
+			return mat;
+		}
+
+		//! True if all elements are valid (not NaN)
+		inline
+		constexpr
+		bool
+		isValid
+			() const
+		{
+			// (v == v) is false only for NaN - and is constexpr
+			return
+				(  (theData[0] == theData[0])
+				&& (theData[1] == theData[1])
+				&& (theData[2] == theData[2])
+				&& (theData[3] == theData[3])
+				);
+		}
+
+		//! Element at (row, col) - mutable
+		inline
+		constexpr
+		double &
+		operator()
+			( std::size_t const & row
+			, std::size_t const & col
+			)
+		{
+			return theData[2u*row + col];
+		}
+
+		//! Element at (row, col) - read only
+		inline
+		constexpr
+		double const &
+		operator()
+			( std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			return theData[2u*row + col];
+		}
+
+		//! Sum of diagonal elements
+		inline
+		constexpr
+		double
+		trace
+			() const
+		{
+			return (theData[0] + theData[3]);
+		}
+
+		//! Determinant
+		inline
+		constexpr
+		double
+		determinant
+			() const
+		{
+			return (theData[0]*theData[3] - theData[2]*theData[1]);
+		}
+
+		//! Transposed matrix
+		inline
+		constexpr
+		Mat2
+		transpose
+			() const
+		{
+			return Mat2{ theData[0], theData[2], theData[1], theData[3] };
+		}
+
+		//! Matrix inverse (null if determinant is [near] zero)
+		inline
+		constexpr
+		Mat2
+		inverse
+			() const
+		{
+			Mat2 inv{};
+			double const det{ determinant() };
+			constexpr double eps{ std::numeric_limits<double>::epsilon() };
+			if ((eps < det) || (det < -eps))
+			{
+				double const scl{ 1. / det };
+				inv = Mat2
+					{  theData[3]*scl, -theData[1]*scl
+					, -theData[2]*scl,  theData[0]*scl
+					};
+			}
+			return inv;
+		}
+
+		//! Values as (heap based) mat::Matrix (e.g. for legacy interfaces)
+		inline
+		Matrix
+		matrix
+			() const
+		{
+			Matrix mat(2u, 2u);
+			std::copy(theData.cbegin(), theData.cend(), mat.begin());
+			return mat;
+		}
+
+		//! True if all elements of other are same as this within tol
+		inline
+		bool
+		nearlyEquals
+			( Mat2 const & other
+			, double const & tol = std::numeric_limits<double>::epsilon()
+			) const
+		{
+			bool same{ isValid() && other.isValid() };
+			for (std::size_t nn{0u} ; same && (nn < 4u) ; ++nn)
+			{
+				same = engabra::g3::nearlyEquals
+					(theData[nn], other.theData[nn], tol);
+			}
+			return same;
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << '\n';
+			}
+			using engabra::g3::io::fixed;
+			oss
+				<< fixed(theData[0]) << ' ' << fixed(theData[1])
+				<< '\n'
+				<< fixed(theData[2]) << ' ' << fixed(theData[3])
+				;
+			return oss.str();
+		}
+
+	}; // Mat2
+
+
+} // [mat]
+
+} // [quadloco]
+
+
+namespace
+{
+	//
+	// Global operators
+	//
+
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::mat::Mat2 const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	inline
+	constexpr
+	bool
+	isValid
+		( quadloco::mat::Mat2 const & item
+		)
+	{
+		return item.isValid();
+	}
+
+	//! True if all elements of itemA and itemB are same within tol
+	inline
+	bool
+	nearlyEquals
+		( quadloco::mat::Mat2 const & itemA
+		, quadloco::mat::Mat2 const & itemB
+		, double const & tol = std::numeric_limits<double>::epsilon()
+		)
+	{
+		return itemA.nearlyEquals(itemB, tol);
+	}
+
+	//! Element by element sum
+	inline
+	constexpr
+	quadloco::mat::Mat2
+	operator+
+		( quadloco::mat::Mat2 const & matA
+		, quadloco::mat::Mat2 const & matB
+		)
+	{
+		return quadloco::mat::Mat2
+			{ matA.theData[0] + matB.theData[0]
+			, matA.theData[1] + matB.theData[1]
+			, matA.theData[2] + matB.theData[2]
+			, matA.theData[3] + matB.theData[3]
+			};
+	}
+
+	//! Scalar (pre)multiplication
+	inline
+	constexpr
+	quadloco::mat::Mat2
+	operator*
+		( double const & scale
+		, quadloco::mat::Mat2 const & mat
+		)
+	{
+		return quadloco::mat::Mat2
+			{ scale * mat.theData[0], scale * mat.theData[1]
+			, scale * mat.theData[2], scale * mat.theData[3]
+			};
+	}
+
+	//! Matrix product: result = matA * matB
+	inline
+	constexpr
+	quadloco::mat::Mat2
+	operator*
+		( quadloco::mat::Mat2 const & matA
+		, quadloco::mat::Mat2 const & matB
+		)
+	{
+		return quadloco::mat::Mat2
+			{ matA(0u, 0u)*matB(0u, 0u) + matA(0u, 1u)*matB(1u, 0u)
+			, matA(0u, 0u)*matB(0u, 1u) + matA(0u, 1u)*matB(1u, 1u)
+			, matA(1u, 0u)*matB(0u, 0u) + matA(1u, 1u)*matB(1u, 0u)
+			, matA(1u, 0u)*matB(0u, 1u) + matA(1u, 1u)*matB(1u, 1u)
+			};
+	}
+
+	//! Matrix (pre)multiplication: result = mat * vec
+	inline
+	constexpr
+	quadloco::img::Vector<double>
+	operator*
+		( quadloco::mat::Mat2 const & mat
+		, quadloco::img::Vector<double> const & vec
+		)
+	{
+		return quadloco::img::Vector<double>
+			{ mat(0u, 0u)*vec.theData[0] + mat(0u, 1u)*vec.theData[1]
+			, mat(1u, 0u)*vec.theData[0] + mat(1u, 1u)*vec.theData[1]
+			};
+	}
+
+} // [anon/global]
+
@@ -33,6 +33,7 @@
 
 
 #include "QuadLoco/imgVector.hpp"
+#include "QuadLoco/matMat2.hpp"
 #include "QuadLoco/mattype.hpp"
 #include "QuadLoco/rasGrid.hpp"
 
@@ -84,7 +85,7 @@ namespace mat
 		return (mat2D(0,0) * mat2D(1,1) - mat2D(1,0) * mat2D(0,1));
 	}
 
-	//! Matrix inverse of a 2x2 matrix
+	//! Matrix inverse of a 2x2 matrix (elements are null if singular)
 	inline
 	Matrix
 	inverse2x2
@@ -94,20 +95,7 @@ namespace mat
 		Matrix inv2x2{};
 		if ((2u == fwd2x2.high()) && (2u == fwd2x2.wide()))
 		{
-			inv2x2 = Matrix(2u, 2u);
-			double const & aa = fwd2x2(0u, 0u);
-			double const & bb = fwd2x2(0u, 1u);
-			double const & cc = fwd2x2(1u, 0u);
-			double const & dd = fwd2x2(1u, 1u);
-			double const det{ aa*dd - bb*cc };
-			if (std::numeric_limits<double>::epsilon() < std::abs(det))
-			{
-				double const scl{ 1. / det };
-				inv2x2(0u, 0u) =  dd * scl;
-				inv2x2(0u, 1u) = -bb * scl;
-				inv2x2(1u, 0u) = -cc * scl;
-				inv2x2(1u, 1u) =  aa * scl;
-			}
+			inv2x2 = Mat2::from(fwd2x2).inverse().matrix();
 		}
 		return inv2x2;
 	}
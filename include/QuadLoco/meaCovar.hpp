@@ -33,6 +33,7 @@
 
 
 #include "QuadLoco/matEigen2D.hpp"
+#include "QuadLoco/matMat2.hpp"
 #include "QuadLoco/mat.hpp"
 #include "QuadLoco/rasGrid.hpp"
 
@@ -58,13 +59,13 @@ namespace mea
 		//! Diagonal covariance matrix corresponding with sigma
 		inline
 		static
-		mat::Matrix
+		mat::Mat2
 		fromSigma
 			( double const & sigma
 			)
 		{
 			double const covarMag{ sigma * sigma };
-			return (covarMag * mat::identity(2u));
+			return mat::Mat2::diagonal(covarMag, covarMag);
 		}
 
 	public:
@@ -78,6 +79,15 @@ namespace mea
 		//! Value construction
 		inline
 		explicit
+		Covar
+			( mat::Mat2 const & covarMat
+			)
+			: theEig(covarMat)
+		{ }
+
+		//! Value construction (from 2x2 Grid)
+		inline
+		explicit
 		Covar
 			( mat::Matrix const & covarMat
 			)
@@ -157,6 +167,15 @@ namespace mea
 
 		//! Matrix values reconstituted from eigen decomposition
 		inline
+		mat::Mat2
+		mat2
+			() const
+		{
+			return theEig.mat2();
+		}
+
+		//! Matrix values reconstituted from eigen decomposition (as Grid)
+		inline
 		ras::Grid<double>
 		matrix
 			() const
@@ -174,8 +193,8 @@ namespace mea
 				//!< Tolerance on variance values (squared expectations)
 			) const
 		{
-			mat::Matrix const matCurr{ matrix() };
-			mat::Matrix const matOther{ other.matrix() };
+			mat::Mat2 const matCurr{ mat2() };
+			mat::Mat2 const matOther{ other.mat2() };
 			return (matCurr.nearlyEquals(matOther, tolVar));
 		}
 
@@ -192,7 +211,7 @@ namespace mea
 				oss << title << '\n';
 			}
 			using engabra::g3::io::fixed;
-			mat::Matrix const coMat{ matrix() };
+			mat::Mat2 const coMat{ mat2() };
 			oss
 				<< fixed(coMat(0u, 0u), 6u, 6u)
 				<< ' '
@@ -77,7 +77,18 @@ namespace mea
 			, theCovar(sigma)
 		{ }
 
-		//! Construct with location and identify covariance matrix
+		//! Construct with location and full covariance matrix
+		inline
+		explicit
+		Vector
+			( img::Vector<double> const & loc
+			, mat::Mat2 const & covar
+			)
+			: theLoc{ loc }
+			, theCovar(covar)
+		{ }
+
+		//! Construct with location and full covariance matrix (2x2 Grid)
 		inline
 		explicit
 		Vector
@@ -138,8 +149,8 @@ namespace mea
 			bool same{ isValid() && other.isValid() };
 			if (same)
 			{
-				mat::Matrix const matA{ theCovar.matrix() };
-				mat::Matrix const matB{ other.theCovar.matrix() };
+				mat::Mat2 const matA{ theCovar.mat2() };
+				mat::Mat2 const matB{ other.theCovar.mat2() };
 				using engabra::g3::nearlyEquals;
 				same =
 					(  theLoc.nearlyEquals(other.theLoc, tol)
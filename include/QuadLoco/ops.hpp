@@ -38,7 +38,10 @@
 #include "QuadLoco/opsCenterRefinerSSD.hpp"
 #include "QuadLoco/opsFence.hpp"
 #include "QuadLoco/opsfilter.hpp"
+#include "QuadLoco/opsGradientGrid.hpp"
+#include "QuadLoco/opsGradientTiles.hpp"
 #include "QuadLoco/opsgrid.hpp"
+#include "QuadLoco/opsIntegralImage.hpp"
 #include "QuadLoco/opsPeakFinder1D.hpp"
 #include "QuadLoco/opsSymRing.hpp"
 
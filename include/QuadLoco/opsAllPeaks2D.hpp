@@ -34,6 +34,7 @@
 
 #include "QuadLoco/pix.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
 #include "QuadLoco/rasPeakRCV.hpp"
 #include "QuadLoco/rasRowCol.hpp"
 
@@ -55,6 +56,85 @@ namespace ops
 
 	public:
 
+		/*! \brief Append 8-hood peaks within currRow to *ptPeakRCVs.
+		 *
+		 * The prevRow, currRow and nextRow pointers are to the first
+		 * cell of three consecutive rows (each with wide cells). Cells
+		 * other than first and last are checked. A cell is a peak if
+		 * it is valid, larger than minValue and not less than any
+		 * (valid) neighbor - refer to unsortedPeakRCVs().
+		 *
+		 * This allows peaks to be found from a rolling window of rows
+		 * (e.g. while the rows are being generated).
+		 */
+		template <typename Type>
+		inline
+		static
+		void
+		appendRowPeakRCVs
+			( Type const * const & prevRow
+				//!< Row before currRow
+			, Type const * const & currRow
+				//!< Row in which to find peaks
+			, Type const * const & nextRow
+				//!< Row after currRow
+			, std::size_t const & wide
+				//!< Number of cells in each row
+			, std::size_t const & rowNdx
+				//!< Row index for currRow (used in PeakRCV)
+			, Type const & minValue
+				//!< Ignore peaks not larger than this
+			, std::vector<ras::PeakRCV> * const & ptPeakRCVs
+				//!< Collection to which to append found peaks
+			)
+		{
+			std::size_t const lastCol{ wide - 1u };
+			for (std::size_t currCol{1u} ; currCol < lastCol ; ++currCol)
+			{
+				std::size_t const prevCol{ currCol - 1u };
+				std::size_t const nextCol{ currCol + 1u };
+
+				Type const & TL = prevRow[prevCol];
+				Type const & TM = prevRow[currCol];
+				Type const & TR = prevRow[nextCol];
+
+				Type const & ML = currRow[prevCol];
+				Type const & MM = currRow[currCol];
+				Type const & MR = currRow[nextCol];
+
+				Type const & BL = nextRow[prevCol];
+				Type const & BM = nextRow[currCol];
+				Type const & BR = nextRow[nextCol];
+
+				if (pix::isValid(MM) && (minValue < MM))
+				{
+					// treat null surrounding peaks as less than valid MM
+					bool const isPeak
+						{  ( (! pix::isValid(TL)) || (! (MM < TL)) )
+						&& ( (! pix::isValid(TM)) || (! (MM < TM)) )
+						&& ( (! pix::isValid(TR)) || (! (MM < TR)) )
+						//
+						&& ( (! pix::isValid(ML)) || (! (MM < ML)) )
+						&& ( (! pix::isValid(MR)) || (! (MM < MR)) )
+						//
+						&& ( (! pix::isValid(BL)) || (! (MM < BL)) )
+						&& ( (! pix::isValid(BM)) || (! (MM < BM)) )
+						&& ( (! pix::isValid(BR)) || (! (MM < BR)) )
+						};
+					if (isPeak)
+					{
+						ras::PeakRCV const peakRCV
+							{ ras::RowCol{ rowNdx, currCol }
+							, static_cast<double>(MM)
+							};
+						ptPeakRCVs->emplace_back(peakRCV);
+					}
+
+				} // over minValue
+
+			} // currCol
+		}
+
 		/*! \brief All local peaks (at least one cell inside grid border)
 		 *
 		 * Peaks are based on neighbor value checking. If the value
@@ -63,7 +143,8 @@ namespace ops
 		 *
 		 * This is a brute force niave algorithm. It visits every cell
 		 * (other than the first and last row or first and last column).
-		 * At each evaluation site, it checks all 8 neighbor values.
+		 * At each evaluation site, it checks all 8 neighbor values
+		 * (ref appendRowPeakRCVs()).
 		 *
 		 * \note The PeakRCV instances are returned in *ORDER ENCOUNTERED*.
 		 * The resulting array can be sorted to put largest peak at 
@@ -75,7 +156,7 @@ namespace ops
 		static
 		std::vector<ras::PeakRCV>
 		unsortedPeakRCVs
-			( ras::Grid<Type> const & fGrid
+			( ras::GridView<Type> const & fGrid
 			, Type const & minValue = std::numeric_limits<Type>::epsilon()
 			)
 		{
@@ -85,61 +166,36 @@ namespace ops
 			std::size_t const high{ fGrid.high() };
 			std::size_t const wide{ fGrid.wide() };
 			std::size_t const lastRow{ high - 1u };
-			std::size_t const lastCol{ wide - 1u };
 			for (std::size_t currRow{1u} ; currRow < lastRow ; ++currRow)
 			{
-				std::size_t const prevRow{ currRow - 1u };
-				std::size_t const nextRow{ currRow + 1u };
-				for (std::size_t currCol{1u} ; currCol < lastCol ; ++currCol)
-				{
-					std::size_t const prevCol{ currCol - 1u };
-					std::size_t const nextCol{ currCol + 1u };
-
-					Type const & TL = fGrid(prevRow, prevCol);
-					Type const & TM = fGrid(prevRow, currCol);
-					Type const & TR = fGrid(prevRow, nextCol);
-
-					Type const & ML = fGrid(currRow, prevCol);
-					Type const & MM = fGrid(currRow, currCol);
-					Type const & MR = fGrid(currRow, nextCol);
-
-					Type const & BL = fGrid(nextRow, prevCol);
-					Type const & BM = fGrid(nextRow, currCol);
-					Type const & BR = fGrid(nextRow, nextCol);
-
-					if (pix::isValid(MM) && (minValue < MM))
-					{
-						// treat null surrounding peaks as less than valid MM
-						bool const isPeak
-							{  ( (! pix::isValid(TL)) || (! (MM < TL)) )
-							&& ( (! pix::isValid(TM)) || (! (MM < TM)) )
-							&& ( (! pix::isValid(TR)) || (! (MM < TR)) )
-							//
-							&& ( (! pix::isValid(ML)) || (! (MM < ML)) )
-							&& ( (! pix::isValid(MR)) || (! (MM < MR)) )
-							//
-							&& ( (! pix::isValid(BL)) || (! (MM < BL)) )
-							&& ( (! pix::isValid(BM)) || (! (MM < BM)) )
-							&& ( (! pix::isValid(BR)) || (! (MM < BR)) )
-							};
-						if (isPeak)
-						{
-							ras::PeakRCV const peakRCV
-								{ ras::RowCol{ currRow, currCol }
-								, static_cast<double>(MM)
-								};
-							peakRCVs.emplace_back(peakRCV);
-						}
-
-					} // over minValue
-
-				} // currCol
+				appendRowPeakRCVs
+					( fGrid.cbeginRow(currRow - 1u)
+					, fGrid.cbeginRow(currRow)
+					, fGrid.cbeginRow(currRow + 1u)
+					, wide
+					, currRow
+					, minValue
+					, &peakRCVs
+					);
 
 			} // currRow
 
 			return peakRCVs;
 		}
 
+		//! \brief All local peaks in fGrid - ref unsortedPeakRCVs(GridView)
+		template <typename Type>
+		inline
+		static
+		std::vector<ras::PeakRCV>
+		unsortedPeakRCVs
+			( ras::Grid<Type> const & fGrid
+			, Type const & minValue = std::numeric_limits<Type>::epsilon()
+			)
+		{
+			return unsortedPeakRCVs(ras::GridView<Type>(fGrid), minValue);
+		}
+
 		/*! \brief Same as unsortedPeakRCVs followed by sort() and resize().
 		 *
 		 * The returned array contains PeakRCV values in sorted order
@@ -221,6 +277,17 @@ namespace ops
 			: thePeakRCVs{ unsortedPeakRCVs(fGrid, minValue) }
 		{ }
 
+		//! \brief Search for all 8-hood peaks within (external) fView data.
+		template <typename Type>
+		inline
+		explicit
+		AllPeaks2D
+			( ras::GridView<Type> const & fView
+			, Type const & minValue = std::numeric_limits<Type>::epsilon()
+			)
+			: thePeakRCVs{ unsortedPeakRCVs(fView, minValue) }
+		{ }
+
 		//! \brief Access to all found peak row/col/values.
 		inline
 		std::vector<ras::PeakRCV> const &
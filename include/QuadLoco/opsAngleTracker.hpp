@@ -39,6 +39,7 @@
 
 #include <Engabra>
 
+#include <algorithm>
 #include <cmath>
 #include <sstream>
 #include <string>
@@ -93,6 +94,16 @@ namespace ops
 		{ }
 
 
+		//! Zero all accumulations (retaining bin allocation for reuse)
+		inline
+		void
+		reset
+			()
+		{
+			std::fill(theBinSums.begin(), theBinSums.end(), 0.);
+			theTotalSum = 0.;
+		}
+
 		//! True if this instance is valid (not null)
 		inline
 		bool
@@ -221,6 +232,31 @@ namespace ops
 			}
 		}
 
+		/*! \brief Incorporate a collection of weighted angles.
+		 *
+		 * Equivalent to calling consider(angles[ndx], weights[ndx], ...)
+		 * for each ndx (e.g. using arrays from img::EdgelSet anglesInto()
+		 * and magnitudesInto()).
+		 */
+		inline
+		void
+		consider
+			( std::vector<double> const & angles
+				//!< Angle values at which to add weighted contributions
+			, std::vector<double> const & weights
+				//!< Corresponding weights (same size as angles)
+			, std::size_t const & halfBinSpread = 1u
+				//!< Spread weighting over into this many bins on each side
+			)
+		{
+			std::size_t const numAngles
+				{ std::min(angles.size(), weights.size()) };
+			for (std::size_t ndx{0u} ; ndx < numAngles ; ++ndx)
+			{
+				consider(angles[ndx], weights[ndx], halfBinSpread);
+			}
+		}
+
 		//! Peak finder for exploring peaks in angle accumulation buffer
 		inline
 		PeakFinder1D
@@ -36,13 +36,17 @@
 #include "QuadLoco/cast.hpp"
 #include "QuadLoco/imgArea.hpp"
 #include "QuadLoco/imgEdgel.hpp"
+#include "QuadLoco/imgEdgelSet.hpp"
 #include "QuadLoco/imgGrad.hpp"
 #include "QuadLoco/imgHit.hpp"
 #include "QuadLoco/imgRay.hpp"
 #include "QuadLoco/imgSpot.hpp"
 #include "QuadLoco/matEigen2D.hpp"
+#include "QuadLoco/matMat2.hpp"
 #include "QuadLoco/meaVector.hpp"
 #include "QuadLoco/opsAngleTracker.hpp"
+#include "QuadLoco/opsGradientGrid.hpp"
+#include "QuadLoco/opsGradientTiles.hpp"
 #include "QuadLoco/opsgrid.hpp"
 #include "QuadLoco/prbStats.hpp"
 #include "QuadLoco/rasGrid.hpp"
@@ -54,6 +58,7 @@
 #include <iostream>
 #include <iterator>
 #include <numbers>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -64,22 +69,22 @@ namespace quadloco
 
 namespace ops
 {
-	//! Compute 2D statistics on group of locations
+	/*! \brief Compute 2D statistics on group of locations
+	 *
+	 * Samples are stored as separate (row, col, weight) arrays so that
+	 * the statistics are evaluated with simple loops over contiguous
+	 * data.
+	 */
 	struct EdgeGroup
 	{
-		//! Weighted location sample
-		struct Sample
-		{
-			//! Location of sample point
-			img::Vector<double> theLoc{};
+		//! Sample location row coordinates
+		std::vector<double> theLocRows;
 
-			//! Relative weight of this location
-			double theWgt{ 0. };
+		//! Sample location column coordinates
+		std::vector<double> theLocCols;
 
-		}; // Sample
-
-		//! Collect samples
-		std::vector<Sample> theSamps;
+		//! Relative weight of each sample location
+		std::vector<double> theWgts;
 
 		//! Add weighted spot data to collection
 		inline
@@ -89,7 +94,29 @@ namespace ops
 			, double const & weight
 			)
 		{
-			theSamps.emplace_back(Sample{ imgSpot, weight });
+			theLocRows.emplace_back(imgSpot[0]);
+			theLocCols.emplace_back(imgSpot[1]);
+			theWgts.emplace_back(weight);
+		}
+
+		//! Remove all samples (retaining allocated capacity for reuse)
+		inline
+		void
+		clear
+			()
+		{
+			theLocRows.clear();
+			theLocCols.clear();
+			theWgts.clear();
+		}
+
+		//! Number of samples in this group
+		inline
+		std::size_t
+		size
+			() const
+		{
+			return theWgts.size();
 		}
 
 		//! Centroid of all samples in this group
@@ -99,17 +126,19 @@ namespace ops
 			() const
 		{
 			img::Vector<double> mean{};
-			img::Vector<double> sumLocs{ 0., 0. };
+			double sumRows{ 0. };
+			double sumCols{ 0. };
 			double sumWgts{ 0. };
-			for (Sample const & samp : theSamps)
+			for (std::size_t ndx{0u} ; ndx < theWgts.size() ; ++ndx)
 			{
-				double const & wgt = samp.theWgt;
+				double const & wgt = theWgts[ndx];
 				sumWgts += wgt;
-				sumLocs = sumLocs + (wgt * samp.theLoc);
+				sumRows += wgt * theLocRows[ndx];
+				sumCols += wgt * theLocCols[ndx];
 			}
 			if (std::numeric_limits<double>::epsilon() < sumWgts)
 			{
-				mean = (1./sumWgts) * sumLocs;
+				mean = (1./sumWgts) * img::Vector<double>{ sumRows, sumCols };
 			}
 			return mean;
 		}
@@ -124,25 +153,28 @@ namespace ops
 			img::Vector<double> axisMag;
 
 			// scatter matrix
-			ras::Grid<double> scatter(2u, 2u);
-			std::fill(scatter.begin(), scatter.end(), 0.);
+			double sum00{ 0. };
+			double sum01{ 0. };
+			double sum11{ 0. };
 			double sumWgts{ 0. };
-			for (Sample const & samp : theSamps)
+			double const & meanRow = meanLoc[0];
+			double const & meanCol = meanLoc[1];
+			for (std::size_t ndx{0u} ; ndx < theWgts.size() ; ++ndx)
 			{
-				img::Vector<double> const & absLoc = samp.theLoc;
-				img::Vector<double> const relLoc{ absLoc - meanLoc };
-				double const & wgt = samp.theWgt;
-
-				scatter(0u, 0u) += wgt * (relLoc[0] * relLoc[0]);
-				scatter(0u, 1u) += wgt * (relLoc[0] * relLoc[1]);
-			//	scatter(1u, 0u) += wgt * (relLoc[1] * relLoc[0]);
-				scatter(1u, 1u) += wgt * (relLoc[1] * relLoc[1]);
+				double const relRow{ theLocRows[ndx] - meanRow };
+				double const relCol{ theLocCols[ndx] - meanCol };
+				double const & wgt = theWgts[ndx];
+
+				sum00 += wgt * (relRow * relRow);
+				sum01 += wgt * (relRow * relCol);
+				sum11 += wgt * (relCol * relCol);
 				sumWgts += wgt;
 			}
-			scatter(0u, 0u) /= sumWgts;
-			scatter(0u, 1u) /= sumWgts;
+			mat::Mat2 scatter{ mat::Mat2::zero() };
+			scatter(0u, 0u) = sum00 / sumWgts;
+			scatter(0u, 1u) = sum01 / sumWgts;
 			scatter(1u, 0u) = scatter(0u, 1u); // symmetric
-			scatter(1u, 1u) /= sumWgts;
+			scatter(1u, 1u) = sum11 / sumWgts;
 
 			mat::Eigen2D const eig(scatter);
 			axisMag = eig.valueMax() * eig.vectorMax();
@@ -164,7 +196,7 @@ namespace ops
 			}
 			img::Vector<double> const mean{ centroid() };
 			oss
-				<< "numSamps: " << theSamps.size()
+				<< "numSamps: " << size()
 				<< "  "
 				<< "centroid: " << mean
 				<< "  "
@@ -190,9 +222,8 @@ namespace ops
 		mea::Vector meaVec{};
 
 		// Assemble radial rays from EdgeGroup geometries
-		mat::Matrix DtD(2u, 2u);
+		mat::Mat2 DtD{ mat::Mat2::zero() };
 		img::Vector<double> Dts{ 0., 0. };
-		std::fill(DtD.begin(), DtD.end(), 0.);
 		for (std::size_t nGrp{0u} ; nGrp < 4u ; ++nGrp)
 		{
 			using Vec = img::Vector<double>;
@@ -214,7 +245,7 @@ namespace ops
 			Dts.theData[1u] += -di1*sidi;
 		}
 
-		mat::Matrix const invDtD{ mat::inverse2x2(DtD) };
+		mat::Mat2 const invDtD{ DtD.inverse() };
 		img::Vector<double> const solnPnt{ invDtD * Dts };
 
 		if (solnPnt.isValid())
@@ -225,7 +256,7 @@ namespace ops
 			img::Vector<double> const halfCell{ .5, .5 };
 			img::Spot const fitLoc{ solnPnt + halfCell };
 			//
-			mat::Matrix const & covar = invDtD;
+			mat::Mat2 const & covar = invDtD;
 			meaVec = mea::Vector(fitLoc, covar);
 		}
 
@@ -255,15 +286,88 @@ namespace ops
 
 	/*! \brief Refine center locations with line fitting (to edge magnitudes).
 	 *
-	 * Upon construction, gradient values are computed for the entire
-	 * source image. These values are used for subsequent center candidate
-	 * refinements.
+	 * By default (GradientMode::Precompute), gradient values are computed
+	 * for the entire source image upon construction. These values are
+	 * used for subsequent center candidate refinements.
 	 *
+	 * With GradientMode::OnDemand, construction is inexpensive and
+	 * gradients are computed only for (tiles overlapping) the search
+	 * windows of candidates that are refined. Computed tiles are cached
+	 * and reused by subsequent candidates. This is generally faster when
+	 * candidates are few relative to image size. In this mode, the source
+	 * grid must remain valid for the lifetime of the refiner.
+	 *
+	 * Both modes produce identical results.
 	 */
 	class CenterRefinerEdge
 	{
-		//! Gradient values for each source image cell.
-		ras::Grid<img::Grad> const theGradGrid{};
+	public:
+
+		//! Strategy for when gradient values are computed
+		enum class GradientMode
+		{
+			  Precompute //!< Compute all gradients at construction
+			, OnDemand //!< Compute (and cache) tiles as candidates need them
+		};
+
+		/*! \brief Reusable scratch memory for repeated imgHitNear() calls.
+		 *
+		 * Provide an instance of this to imgHitNear() to reuse the
+		 * edgel, angle histogram, and edge group allocations across
+		 * many refinement calls. Buffers grow as needed and are then
+		 * retained (the angle tracker is rebuilt only if the search
+		 * radius changes). An instance may be shared across refiners
+		 * but not across concurrent threads.
+		 */
+		struct Workspace
+		{
+			//! Edgels within the search radius of the current candidate
+			img::EdgelSet theEdgels{};
+
+			//! Gradient magnitudes for each of theEdgels
+			std::vector<double> theMags{};
+
+			//! Gradient angles for each of theEdgels
+			std::vector<double> theAngles{};
+
+			//! Angle histogram for the current candidate
+			std::optional<ops::AngleTracker> theAngleTracker{};
+
+			//! Edgel samples grouped by radial edge direction
+			std::array<EdgeGroup, 4u> theEdgeGroups{};
+
+			//! Reset (or if needed, create) angle tracker with numAngBins
+			inline
+			ops::AngleTracker &
+			angleTrackerFor
+				( std::size_t const & numAngBins
+				)
+			{
+				if ( (! theAngleTracker)
+				  || (! (numAngBins == theAngleTracker->size()))
+				   )
+				{
+					theAngleTracker.emplace(numAngBins);
+				}
+				else
+				{
+					theAngleTracker->reset();
+				}
+				return *theAngleTracker;
+			}
+
+		}; // Workspace
+
+	private:
+
+		//! Size of source grid
+		ras::SizeHW const theHwSize{};
+
+		//! Gradient values for each source image cell (if Precompute).
+		ops::GradientGrid const theGradGrid{};
+
+		//! Lazily computed gradient values (if OnDemand).
+		ops::GradientTiles const theGradTiles{};
 
 		//! Angle probability data item
 		struct AngProb
@@ -483,27 +587,35 @@ namespace ops
 		mea::Vector
 		meaVectorCenter
 			( PeakQuad const & peakQuad
-			, std::vector<img::Edgel> const & edgels
+			, img::EdgelSet const & edgels
+			, std::vector<double> const & edgeMags
+				//!< Gradient magnitude for each of edgels
 			, img::Spot const & nomCenter
 			, double const & edgeMagMax
+			, std::array<EdgeGroup, 4u> * const & ptSampleGroups
+				//!< Scratch groups (cleared here, capacity is reused)
 			) const
 		{
 			mea::Vector meaVec{};
 
 			// classify edgels by direction
-			std::array<EdgeGroup, 4u> sampleGroups;
-			for (img::Edgel const & edgel : edgels)
+			std::array<EdgeGroup, 4u> & sampleGroups = *ptSampleGroups;
+			for (EdgeGroup & sampleGroup : sampleGroups)
+			{
+				sampleGroup.clear();
+			}
+			double const magSigma{ .25 * edgeMagMax };
+			for (std::size_t ndx{0u} ; ndx < edgels.size() ; ++ndx)
 			{
 				// Compare relative position with QuadPeak directions
-				img::Vector<double> const relPos
-					{ edgel.location() - nomCenter };
+				img::Spot const edgeLoc{ edgels.locationAt(ndx) };
+				img::Vector<double> const relPos{ edgeLoc - nomCenter };
 				std::size_t const ndxGrp{ peakQuad.groupIndexFor(relPos) };
 
-				double const magSigma{ .25 * edgeMagMax };
-				double const edgeMag{ edgel.magnitude() };
+				double const & edgeMag = edgeMags[ndx];
 				double const arg{ (edgeMagMax - edgeMag) / magSigma };
 				double const weight{ std::exp(-arg*arg) };
-				sampleGroups[ndxGrp].add(edgel.location(), weight);
+				sampleGroups[ndxGrp].add(edgeLoc, weight);
 			}
 
 			// centroids of each edge group - to provide point on edges
@@ -544,15 +656,60 @@ namespace ops
 			return meaVec;
 		}
 
+		//! Gradient {row,col} components at (row,col) (NaN if not valid)
+		inline
+		std::array<float, 2u>
+		gradComponentsAt
+			( std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			std::array<float, 2u> comps;
+			if (theGradTiles.isValid())
+			{
+				comps = theGradTiles.componentsAt(row, col);
+			}
+			else
+			{
+				comps = { theGradGrid.rowGrads()(row, col)
+						, theGradGrid.colGrads()(row, col)
+						};
+			}
+			return comps;
+		}
+
+		//! Gradient grid for full source (empty unless Precompute mode)
+		inline
+		static
+		ops::GradientGrid
+		gradGridFor
+			( ras::Grid<float> const & srcGrid
+			, GradientMode const & gradMode
+			)
+		{
+			ops::GradientGrid gradGrid{};
+			if (GradientMode::Precompute == gradMode)
+			{
+				gradGrid = ops::GradientGrid(srcGrid);
+			}
+			return gradGrid;
+		}
+
 	public:
 
-		//! Compute and cache gradient values for use in other methods.
+		//! Setup gradient values (per gradMode) for use in other methods.
 		inline
 		explicit
 		CenterRefinerEdge
 			( ras::Grid<float> const & srcGrid
+				//!< Source (must persist if gradMode is OnDemand)
+			, GradientMode const & gradMode = GradientMode::Precompute
+				//!< When to compute gradient values
 			)
-			: theGradGrid{ ops::grid::gradientGridBy8x(srcGrid) }
+			: theHwSize{ srcGrid.hwSize() }
+			, theGradGrid(gradGridFor(srcGrid, gradMode))
+			, theGradTiles
+				( (GradientMode::OnDemand == gradMode) ? &srcGrid : nullptr )
 		{ }
 
 		/*! \brief Use gradient grid to estimate center point near to nomSpot
@@ -566,6 +723,8 @@ namespace ops
 		imgHitNear
 			( ras::RowCol const & rc0
 			, std::size_t const & searchRadius
+			, Workspace * const & ptWorkspace = nullptr
+				//!< Optional scratch memory to reuse across calls
 			) const
 		{
 			img::Hit hit{};
@@ -585,22 +744,32 @@ namespace ops
 				// evaluate probability that this point is a target center
 				img::Spot const nomOrig{ cast::imgSpot(rc0) };
 
+				// use consumer workspace if provided, else local one
+				Workspace localWorkspace{};
+				Workspace & work
+					{ ptWorkspace ? *ptWorkspace : localWorkspace };
+
 				//! Track edgels for subsequent use
-				std::vector<img::Edgel> edgels;
+				img::EdgelSet & edgels = work.theEdgels;
+				edgels.clear();
 				edgels.reserve(4u * searchRadius * searchRadius);
 
 				// create angle direction accumluation buffer
 				// (expecting four strong direction peaks - two pairs of
 				// opposing directions)
-				ops::AngleTracker angleTracker(numPeri);
-				double edgeMagMax{ 0. };
+				ops::AngleTracker & angleTracker
+					{ work.angleTrackerFor(numPeri) };
+				// ensure gradients are available within search window
+				theGradTiles.prepareArea
+					( (std::size_t)std::max(rowBeg, 0)
+					, (std::size_t)std::max(rowEnd, 0)
+					, (std::size_t)std::max(colBeg, 0)
+					, (std::size_t)std::max(colEnd, 0)
+					);
 				for (int row{rowBeg} ; row < rowEnd ; ++row)
 				{
 					for (int col{colBeg} ; col < colEnd ; ++col)
 					{
-						// TODO - can precompute angles for filter
-						// value of gradient at this location
-
 						// location in source
 						img::Spot const loc{ (double)row, (double)col };
 						img::Vector<double> const relSpot{ loc - nomOrig };
@@ -614,27 +783,34 @@ namespace ops
 						if ((0. < radius) && (radius < radMax))
 						{
 							// gradient in source
-							img::Grad const & grad = theGradGrid(row, col);
-							if (::isValid(grad))
+							std::array<float, 2u> const comps
+								{ gradComponentsAt
+									((std::size_t)row, (std::size_t)col)
+								};
+							float const & gRow = comps[0];
+							float const & gCol = comps[1];
+							if ( engabra::g3::isValid((double)gRow)
+							  && engabra::g3::isValid((double)gCol)
+							   )
 							{
-								img::Edgel const edgel(loc, grad);
-								edgels.emplace_back(edgel);
-
-								// accumulation direction into angle historgram
-								constexpr std::size_t binSigma{ 1u };
-								double const edgeMag{ edgel.magnitude() };
-								angleTracker.consider
-									(edgel.angle(), edgeMag, binSigma);
-
-								if (edgeMagMax < edgeMag)
-								{
-									edgeMagMax = edgeMag;
-								}
+								edgels.add((float)row, (float)col, gRow, gCol);
 							}
 						}
 					}
 				}
 
+				// accumulate edgel directions into angle historgram
+				std::vector<double> & edgeMags = work.theMags;
+				edgels.magnitudesInto(&edgeMags);
+				edgels.anglesInto(&work.theAngles);
+				constexpr std::size_t binSigma{ 1u };
+				angleTracker.consider(work.theAngles, edgeMags, binSigma);
+				double edgeMagMax{ 0. };
+				for (double const & edgeMag : edgeMags)
+				{
+					edgeMagMax = std::max(edgeMagMax, edgeMag);
+				}
+
 				// Determine pseudo probability that this is a legit center
 				PeakQuad const peakQuad{ peakQuadFor(angleTracker) };
 				double const quadProb{ peakQuad.probability() };
@@ -643,7 +819,13 @@ namespace ops
 					// fit center
 					mea::Vector const meaCenter
 						{ meaVectorCenter
-							(peakQuad, edgels, nomOrig, edgeMagMax)
+							( peakQuad
+							, edgels
+							, edgeMags
+							, nomOrig
+							, edgeMagMax
+							, &work.theEdgeGroups
+							)
 						};
 					img::Spot const centerSpot{ meaCenter.location() };
 					double const sigma{ meaCenter.deviationRMS() };
@@ -669,26 +851,29 @@ namespace ops
 
 			// active area for considering peaks
 			std::size_t const hwMin{ 2u * searchRadius + 1u };
-			if ((hwMin < theGradGrid.high()) && (hwMin < theGradGrid.wide()))
+			if ((hwMin < theHwSize.high()) && (hwMin < theHwSize.wide()))
 			{
 				val::Span const rowSpan
 					{ (double)searchRadius
-					, (double)(theGradGrid.high() - searchRadius - 1u)
+					, (double)(theHwSize.high() - searchRadius - 1u)
 					};
 				val::Span const colSpan
 					{ (double)searchRadius
-					, (double)(theGradGrid.wide() - searchRadius - 1u)
+					, (double)(theHwSize.wide() - searchRadius - 1u)
 					};
 				img::Area const liveArea{ rowSpan, colSpan };
 
 				// process neighborhoods around each candidate center
+				// (reusing the same scratch memory for each)
+				Workspace workspace{};
 				for (ras::PeakRCV const & peakRCV : peakRCVs)
 				{
 					ras::RowCol const & nomRC = peakRCV.theRowCol;
 					img::Spot const nomCenter{ cast::imgSpot(nomRC) };
 					if (liveArea.contains(nomCenter))
 					{
-						img::Hit const hit{ imgHitNear(nomRC, searchRadius) };
+						img::Hit const hit
+							{ imgHitNear(nomRC, searchRadius, &workspace) };
 						if (hit.isValid())
 						{
 							hits.emplace_back(hit);
@@ -696,7 +881,7 @@ namespace ops
 					}
 				}
 
-			} // hw < theGradGrid sizes
+			} // hw < theHwSize
 
 			return hits;
 		}
@@ -713,7 +898,14 @@ namespace ops
 			{
 				oss << title << '\n';
 			}
-			oss << "theGradGrid: " << theGradGrid << '\n';
+			if (theGradTiles.isValid())
+			{
+				oss << "theGradTiles: " << theGradTiles << '\n';
+			}
+			else
+			{
+				oss << "theGradGrid: " << theGradGrid << '\n';
+			}
 			return oss.str();
 		}
 
@@ -38,8 +38,11 @@
 #include "QuadLoco/prbStats.hpp"
 #include "QuadLoco/rasChipSpec.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
+#include "QuadLoco/rasNullDistance.hpp"
 #include "QuadLoco/rasRelRC.hpp"
 #include "QuadLoco/rasRowCol.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
 #include "QuadLoco/valSpan.hpp"
 
 #include <Engabra>
@@ -54,8 +57,46 @@ namespace ops
 	//! \brief Center finding functions assocaited with an external source grid
 	class CenterRefinerSSD
 	{
-		//! Access into external source grid
-		ras::Grid<float> const * const thePtSrcGrid{ nullptr };
+	public:
+
+		/*! \brief Reusable scratch memory for repeated fitHitNear() calls.
+		 *
+		 * Provide an instance of this to fitHitNear() (and related
+		 * functions) to reuse temporary grid allocations across
+		 * many refinement calls. Buffers are (re)allocated only when
+		 * the neighborhood size changes. An instance may be shared
+		 * across refiners but not across concurrent threads.
+		 */
+		struct Workspace
+		{
+			//! Average SSD values over the evaluation neighborhood
+			ras::Grid<double> theSsdGrid{};
+
+			//! Pseudo-probability values corresponding with theSsdGrid
+			ras::Grid<double> theProbGrid{};
+
+			//! Grid (re)allocated only if it does not already have hwSize
+			inline
+			static
+			ras::Grid<double> &
+			gridSizedTo
+				( ras::Grid<double> * const & ptGrid
+				, ras::SizeHW const & hwSize
+				)
+			{
+				if (! (ptGrid->hwSize() == hwSize))
+				{
+					*ptGrid = ras::Grid<double>(hwSize);
+				}
+				return *ptGrid;
+			}
+
+		}; // Workspace
+
+	private:
+
+		//! Access into external source data
+		ras::GridView<float> const theSrcView{};
 
 		//! Neighborhood half-size around candidate center location
 		std::size_t const theHalfHood{};
@@ -69,6 +110,9 @@ namespace ops
 		//! Relative (signed) indices defining rotation symmetry filter inputs
 		std::vector<ras::RelRC> theCorrRelRCs{};
 
+		//! Optional (external) null distances for theSrcView
+		ras::NullDistance const * thePtNullDist{ nullptr };
+
 		//! Relative row,col offsets for defining evaluation box
 		inline
 		static
@@ -100,49 +144,87 @@ namespace ops
 
 	public:
 
-		//! Attach refiner to source grid with specific refinement parameters.
+		//! Attach refiner to source data with specific refinement parameters.
 		inline
 		explicit
 		CenterRefinerSSD
-			( ras::Grid<float> const * const ptSrcGrid
-				//!< Access to source grid (under consumer management)
+			( ras::GridView<float> const & srcView
+				//!< Access to source data (under consumer management)
 			, std::size_t const & halfHood = 2u
 				//!< Half size of (2u*halfHood+1) neighborhood to search
 			, std::size_t const & halfCorr = 5u
 				//!< Radius of rotation filter to use over all box cells
+			, ras::NullDistance const * const & ptNullDist = nullptr
+				//!< Optional: nulls in source (to skip checks where possible)
 			)
-			: thePtSrcGrid{ ptSrcGrid }
+			: theSrcView{ srcView }
 			, theHalfHood{ halfHood }
 			, theHalfCorr{ halfCorr }
 			, theHoodRelRCs{ boxRelRCs(theHalfHood) }
 			, theCorrRelRCs{ boxRelRCs(theHalfCorr) }
+			, thePtNullDist{ ptNullDist }
 		{ }
 
-		/*! \brief Grid of sum-squared-differences centered on source location
+		//! Attach refiner to source grid with specific refinement parameters.
+		inline
+		explicit
+		CenterRefinerSSD
+			( ras::Grid<float> const * const ptSrcGrid
+				//!< Access to source grid (under consumer management)
+			, std::size_t const & halfHood = 2u
+				//!< Half size of (2u*halfHood+1) neighborhood to search
+			, std::size_t const & halfCorr = 5u
+				//!< Radius of rotation filter to use over all box cells
+			, ras::NullDistance const * const & ptNullDist = nullptr
+				//!< Optional: nulls in source (to skip checks where possible)
+			)
+			: CenterRefinerSSD
+				( (ptSrcGrid
+					? ras::GridView<float>(*ptSrcGrid)
+					: ras::GridView<float>{}
+				  )
+				, halfHood
+				, halfCorr
+				, ptNullDist
+				)
+		{ }
+
+		/*! \brief Fill ssdGrid with sum-squared-differences around location
 		 *
-		 * The return value is the *expected* squared difference per *valid*
-		 * pair of pixels in the neighboor hood. E.g. it is the sum of 
-		 * squared difference of valid pixels divided by the number of
-		 * valid (diametrically opposite) pixels in the neighborhood.
+		 * The neighborhood size is that of ptSsdGrid (which should be
+		 * square with size (2u*halfHood+1u) and consistent with the
+		 * halfHood value provided at construction). Other than the
+		 * destination grid, this function performs no allocations.
+		 *
+		 * The values are the same as those described for gridOfAveSSD().
 		 */
 		inline
-		ras::Grid<double>
-		gridOfAveSSD
-			( ras::RowCol const & rcHoodCenterInSrc
-			, std::size_t const & fullHood // i.e. (2u*halfHood+1u)
+		void
+		fillAveSSD
+			( ras::Grid<double> * const & ptSsdGrid
+				//!< Destination - must be allocated with neighborhood size
+			, ras::RowCol const & rcHoodCenterInSrc
 			, prb::Stats<double> * const & ptSrcStats = { nullptr }
 			) const
 		{
-			// allocate and initialize sum-sqr-diff return grid
-			ras::Grid<double> ssdGrid(fullHood, fullHood);
+			// initialize sum-sqr-diff return grid
+			ras::Grid<double> & ssdGrid = *ptSsdGrid;
 			std::fill(ssdGrid.begin(), ssdGrid.end(), pix::null<float>());
 
 			// useful shorthand
-			ras::Grid<float> const & srcGrid = *thePtSrcGrid;
+			ras::GridView<float> const & srcGrid = theSrcView;
 			using CorrIter = ras::Grid<double>::iterator;
 			using FwdIter = std::vector<ras::RelRC>::const_iterator;
 			using RevIter = std::vector<ras::RelRC>::const_reverse_iterator;
 
+			// if all values that are used are known to be valid, then
+			// skip per-sample null checks
+			bool const allValid
+				{  thePtNullDist
+				&& thePtNullDist->isWindowValid
+					(rcHoodCenterInSrc, theHalfHood + theHalfCorr)
+				};
+
 			// loop over evaluation neighborhood (corresponding to output grid)
 			CorrIter outCorrIter{ ssdGrid.begin() };
 			double count{ 0. };
@@ -161,26 +243,48 @@ namespace ops
 
 				// compute filter response at this evaluation location
 				double sumSqDif{ 0. };
-				for ( ; fwdHalf != fwdIter ; ++fwdIter, ++revIter)
+				if (allValid)
 				{
-					ras::RowCol const fwdRowCol
-						{ fwdIter->srcRowCol(rcHood0) };
-					ras::RowCol const revRowCol
-						{ revIter->srcRowCol(rcHood0) };
-
-					float const & fwdSrcVal = srcGrid(fwdRowCol);
-					float const & revSrcVal = srcGrid(revRowCol);
-					if (ptSrcStats)
-					{
-						ptSrcStats->consider((double)fwdSrcVal);
-						ptSrcStats->consider((double)revSrcVal);
-					}
-					if (pix::isValid(fwdSrcVal) && pix::isValid(revSrcVal))
+					for ( ; fwdHalf != fwdIter ; ++fwdIter, ++revIter)
 					{
+						float const & fwdSrcVal
+							= srcGrid(fwdIter->srcRowCol(rcHood0));
+						float const & revSrcVal
+							= srcGrid(revIter->srcRowCol(rcHood0));
+						if (ptSrcStats)
+						{
+							ptSrcStats->consider((double)fwdSrcVal);
+							ptSrcStats->consider((double)revSrcVal);
+						}
 						double const diff
 							{ static_cast<double>(fwdSrcVal - revSrcVal) };
 						sumSqDif += diff*diff;
-						count += 1.;
+					}
+					count += static_cast<double>(halfCorr);
+				}
+				else
+				{
+					for ( ; fwdHalf != fwdIter ; ++fwdIter, ++revIter)
+					{
+						ras::RowCol const fwdRowCol
+							{ fwdIter->srcRowCol(rcHood0) };
+						ras::RowCol const revRowCol
+							{ revIter->srcRowCol(rcHood0) };
+
+						float const & fwdSrcVal = srcGrid(fwdRowCol);
+						float const & revSrcVal = srcGrid(revRowCol);
+						if (ptSrcStats)
+						{
+							ptSrcStats->consider((double)fwdSrcVal);
+							ptSrcStats->consider((double)revSrcVal);
+						}
+						if (pix::isValid(fwdSrcVal) && pix::isValid(revSrcVal))
+						{
+							double const diff
+								{ static_cast<double>(fwdSrcVal - revSrcVal) };
+							sumSqDif += diff*diff;
+							count += 1.;
+						}
 					}
 				}
 
@@ -192,7 +296,26 @@ namespace ops
 				}
 
 			} // hood locations
+		}
 
+		/*! \brief Grid of sum-squared-differences centered on source location
+		 *
+		 * The return value is the *expected* squared difference per *valid*
+		 * pair of pixels in the neighboor hood. E.g. it is the sum of 
+		 * squared difference of valid pixels divided by the number of
+		 * valid (diametrically opposite) pixels in the neighborhood.
+		 */
+		inline
+		ras::Grid<double>
+		gridOfAveSSD
+			( ras::RowCol const & rcHoodCenterInSrc
+			, std::size_t const & fullHood // i.e. (2u*halfHood+1u)
+			, prb::Stats<double> * const & ptSrcStats = { nullptr }
+			) const
+		{
+			// allocate sum-sqr-diff return grid
+			ras::Grid<double> ssdGrid(fullHood, fullHood);
+			fillAveSSD(&ssdGrid, rcHoodCenterInSrc, ptSrcStats);
 			return ssdGrid;
 		}
 
@@ -225,12 +348,18 @@ namespace ops
 				//!< Per pixel SSD values over neighborhood
 			, double const & varSrcPix
 				//!< Radiometric standard deviation of source grid values
+			, ras::Grid<double> * const & ptProbGrid = nullptr
+				//!< Optional scratch grid (reused if already ssdGrid size)
 			)
 		{
 			img::Hit minHit{};
 			if (ssdGrid.isValid() && engabra::g3::isValid(varSrcPix))
 			{
-				ras::Grid<double> probGrid(ssdGrid.hwSize());
+				ras::Grid<double> localProbGrid{};
+				ras::Grid<double> & probGrid = Workspace::gridSizedTo
+					( (ptProbGrid ? ptProbGrid : &localProbGrid)
+					, ssdGrid.hwSize()
+					);
 				std::fill(probGrid.begin(), probGrid.end(), 0.);
 
 				// Estimate best fit location (ssdGrid minimum)
@@ -309,6 +438,8 @@ namespace ops
 		fitHitNear
 			( ras::RowCol const & rcHoodCenterInSrc
 				//!< Center of window in which to search
+			, Workspace * const & ptWorkspace = nullptr
+				//!< Optional scratch memory to reuse across calls
 			) const
 		{
 			img::Hit fitHit{};
@@ -319,13 +450,13 @@ namespace ops
 
 			// check if neighborhood filter size fits within source grid
 			bool isInterior{ false };
-			if ( thePtSrcGrid
-			  && (2u*maxRad < thePtSrcGrid->high())
-			  && (2u*maxRad < thePtSrcGrid->wide())
+			if ( theSrcView.isValid()
+			  && (2u*maxRad < theSrcView.high())
+			  && (2u*maxRad < theSrcView.wide())
 			   )
 			{
-				std::size_t rowMax{ thePtSrcGrid->high() - maxRad };
-				std::size_t colMax{ thePtSrcGrid->wide() - maxRad };
+				std::size_t rowMax{ theSrcView.high() - maxRad };
+				std::size_t colMax{ theSrcView.wide() - maxRad };
 				if ( (maxRad < rowHood0)
 				  && (maxRad < colHood0)
 				  && (rowHood0 < rowMax)
@@ -343,8 +474,13 @@ namespace ops
 				// while computing SSD in neighborhood
 				prb::Stats<double> srcStats{};
 				std::size_t const fullHood{ 2u*theHalfHood + 1u };
-				ras::Grid<double> const aveGridSSD
-					{ gridOfAveSSD(rcHoodCenterInSrc, fullHood, &srcStats) };
+				Workspace localWorkspace{};
+				Workspace & work
+					{ ptWorkspace ? *ptWorkspace : localWorkspace };
+				ras::SizeHW const hwHood{ fullHood, fullHood };
+				ras::Grid<double> const & aveGridSSD
+					{ Workspace::gridSizedTo(&work.theSsdGrid, hwHood) };
+				fillAveSSD(&work.theSsdGrid, rcHoodCenterInSrc, &srcStats);
 
 				// upper left corner of ssd evaluation chip
 				ras::RowCol const rcChipTL
@@ -366,7 +502,9 @@ namespace ops
 
 				// estimate sub-cell location of minimum
 				img::Hit const minHitInChip
-					{ hitAtMinimumOf(aveGridSSD, varSrcPix) };
+					{ hitAtMinimumOf
+						(aveGridSSD, varSrcPix, &work.theProbGrid)
+					};
 				img::Spot const & minSpotInChip = minHitInChip.location();
 
 				// get full source image location for ssd Chip minimum
@@ -0,0 +1,254 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::ops::GradientGrid (float gradients)
+ *
+ */
+
+
+#include "QuadLoco/imgGrad.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasgrid.hpp"
+#include "QuadLoco/rassimd.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <string>
+
+
+namespace quadloco
+{
+
+namespace ops
+{
+
+	/*! \brief Eight neighbor gradients stored as two float grids.
+	 *
+	 * Contains the same values as ops::grid::gradientGridBy8x() (which
+	 * are computed with float precision) but stores the row and column
+	 * components in separate ras::Grid<float> instances. This uses
+	 * 8 bytes per cell (vs. 24 for img::Grad) and the kernel results
+	 * are written directly into the component grids.
+	 *
+	 * Border cells (one cell wide) are null (NaN components).
+	 *
+	 * \par Example
+	 * \snippet test/test_opsGradientGrid.cpp DoxyExample01
+	 */
+	class GradientGrid
+	{
+		//! Row direction components of gradients
+		ras::Grid<float> theRowGrads{};
+
+		//! Column direction components of gradients
+		ras::Grid<float> theColGrads{};
+
+	public:
+
+		//! Construct a null instance (isValid() == false)
+		inline
+		GradientGrid
+			() = default;
+
+		//! Compute gradients for srcGrid (null if srcGrid is too small)
+		inline
+		explicit
+		GradientGrid
+			( ras::Grid<float> const & srcGrid
+			)
+		{
+			std::size_t const high{ srcGrid.high() };
+			std::size_t const wide{ srcGrid.wide() };
+			if ((2u < high) && (2u < wide))
+			{
+				theRowGrads = ras::Grid<float>(srcGrid.hwSize());
+				theColGrads = ras::Grid<float>(srcGrid.hwSize());
+
+				// set border to null values
+				constexpr float nan{ std::numeric_limits<float>::quiet_NaN() };
+				ras::grid::fillBorder(&theRowGrads, 1u, nan);
+				ras::grid::fillBorder(&theColGrads, 1u, nan);
+
+				// evaluate interior one row at a time
+				std::size_t const numCols{ wide - 2u };
+				for (std::size_t row{1u} ; row < (high - 1u) ; ++row)
+				{
+					ras::simd::gradientRowBy8x
+						( &(srcGrid(row - 1u, 0u))
+						, &(srcGrid(row, 0u))
+						, &(srcGrid(row + 1u, 0u))
+						, numCols
+						, &(theRowGrads(row, 1u))
+						, &(theColGrads(row, 1u))
+						);
+				}
+			}
+		}
+
+		//! True if this instance is not null
+		inline
+		bool
+		isValid
+			() const
+		{
+			return (theRowGrads.isValid() && theColGrads.isValid());
+		}
+
+		//! Dimensions of the gradient grids (same as source)
+		inline
+		ras::SizeHW
+		hwSize
+			() const
+		{
+			return theRowGrads.hwSize();
+		}
+
+		//! Number of rows
+		inline
+		std::size_t
+		high
+			() const
+		{
+			return theRowGrads.high();
+		}
+
+		//! Number of columns
+		inline
+		std::size_t
+		wide
+			() const
+		{
+			return theRowGrads.wide();
+		}
+
+		//! Row direction gradient components
+		inline
+		ras::Grid<float> const &
+		rowGrads
+			() const
+		{
+			return theRowGrads;
+		}
+
+		//! Column direction gradient components
+		inline
+		ras::Grid<float> const &
+		colGrads
+			() const
+		{
+			return theColGrads;
+		}
+
+		//! Gradient at (row,col) (null at border cells)
+		inline
+		img::Grad
+		operator()
+			( std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			return img::Grad
+				{ (double)theRowGrads(row, col)
+				, (double)theColGrads(row, col)
+				};
+		}
+
+		//! Gradients as (AoS) grid - e.g. for use with ops::grid functions
+		inline
+		ras::Grid<img::Grad>
+		gradGrid
+			() const
+		{
+			ras::Grid<img::Grad> grads(hwSize());
+			for (std::size_t row{0u} ; row < high() ; ++row)
+			{
+				for (std::size_t col{0u} ; col < wide() ; ++col)
+				{
+					grads(row, col) = operator()(row, col);
+				}
+			}
+			return grads;
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss
+				<< "rowGrads: " << theRowGrads
+				<< ' '
+				<< "colGrads: " << theColGrads
+				;
+			return oss.str();
+		}
+
+	}; // GradientGrid
+
+} // [ops]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::ops::GradientGrid const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	inline
+	bool
+	isValid
+		( quadloco::ops::GradientGrid const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
@@ -0,0 +1,397 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::ops::GradientTiles (lazy gradients)
+ *
+ */
+
+
+#include "QuadLoco/imgGrad.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rassimd.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace quadloco
+{
+
+namespace ops
+{
+
+	/*! \brief Gradient values computed on demand in (cached) square tiles.
+	 *
+	 * Provides the same values as ops::GradientGrid, but computes them
+	 * only for tiles that overlap areas requested via prepareArea().
+	 * Computed tiles are retained so that overlapping requests (e.g.
+	 * search windows of nearby center candidates) reuse prior work.
+	 * Construction is inexpensive (no gradients are computed and only
+	 * the per-tile pointer slots are allocated).
+	 *
+	 * The source grid is referenced (not copied) and must remain valid
+	 * (and unchanged) for the lifetime of this instance.
+	 *
+	 * All const methods may be called concurrently from multiple
+	 * threads (e.g. one instance shared by per-thread workspaces).
+	 * Tiles are computed under a lock in prepareArea() and then
+	 * published (release/acquire) such that componentsAt() reads
+	 * them without locking. Values should only be accessed (via
+	 * componentsAt()) for areas that have been prepared.
+	 *
+	 * \par Example
+	 * \snippet test/test_opsGradientTiles.cpp DoxyExample01
+	 */
+	class GradientTiles
+	{
+		//! Gradient components for one tile
+		struct Tile
+		{
+			ras::Grid<float> theRowGrads{};
+			ras::Grid<float> theColGrads{};
+		};
+
+		//! Source data from which gradients are computed
+		ras::Grid<float> const * thePtSrc{ nullptr };
+
+		//! Size of each (square) tile
+		std::size_t theTileSize{ 0u };
+
+		//! Number of tiles in each column and row of the tile layout
+		std::size_t theNumTileRows{ 0u };
+		std::size_t theNumTileCols{ 0u };
+
+		//! Storage for computed tiles (row major order, null until used)
+		mutable std::vector<std::unique_ptr<Tile>> theTiles{};
+
+		//! Published (fully computed) tiles - for lock free access
+		mutable std::vector<std::atomic<Tile const *>> thePubTiles{};
+
+		//! Number of tiles computed so far
+		mutable std::size_t theNumComputed{ 0u };
+
+		//! Guard for theTiles and theNumComputed updates
+		mutable std::mutex theMutex{};
+
+		//! Compute gradients for tile at (tileRow,tileCol)
+		inline
+		std::unique_ptr<Tile>
+		computedTile
+			( std::size_t const & tileRow
+			, std::size_t const & tileCol
+			) const
+		{
+			ras::Grid<float> const & srcGrid = *thePtSrc;
+			std::size_t const high{ srcGrid.high() };
+			std::size_t const wide{ srcGrid.wide() };
+
+			// tile extents (clipped to source)
+			std::size_t const row0{ tileRow * theTileSize };
+			std::size_t const col0{ tileCol * theTileSize };
+			std::size_t const row1{ std::min(row0 + theTileSize, high) };
+			std::size_t const col1{ std::min(col0 + theTileSize, wide) };
+			ras::SizeHW const hwTile{ row1 - row0, col1 - col0 };
+
+			std::unique_ptr<Tile> ptTile{ std::make_unique<Tile>() };
+			ptTile->theRowGrads = ras::Grid<float>(hwTile);
+			ptTile->theColGrads = ras::Grid<float>(hwTile);
+			constexpr float nan{ std::numeric_limits<float>::quiet_NaN() };
+			std::fill
+				(ptTile->theRowGrads.begin(), ptTile->theRowGrads.end(), nan);
+			std::fill
+				(ptTile->theColGrads.begin(), ptTile->theColGrads.end(), nan);
+
+			// evaluate cells that are not on the source border
+			std::size_t const rowA{ std::max(row0, std::size_t{ 1u }) };
+			std::size_t const rowB{ std::min(row1, high - 1u) };
+			std::size_t const colA{ std::max(col0, std::size_t{ 1u }) };
+			std::size_t const colB{ std::min(col1, wide - 1u) };
+			if (colA < colB)
+			{
+				for (std::size_t row{rowA} ; row < rowB ; ++row)
+				{
+					ras::simd::gradientRowBy8x
+						( &(srcGrid(row - 1u, colA - 1u))
+						, &(srcGrid(row, colA - 1u))
+						, &(srcGrid(row + 1u, colA - 1u))
+						, (colB - colA)
+						, &(ptTile->theRowGrads(row - row0, colA - col0))
+						, &(ptTile->theColGrads(row - row0, colA - col0))
+						);
+				}
+			}
+			return ptTile;
+		}
+
+	public:
+
+		//! Construct a null instance (isValid() == false)
+		inline
+		GradientTiles
+			() = default;
+
+		//! Setup (but do not compute) tiles covering *ptSrc
+		inline
+		explicit
+		GradientTiles
+			( ras::Grid<float> const * const & ptSrc
+				//!< Source data (must persist for lifetime of this instance)
+			, std::size_t const & tileSize = 64u
+				//!< Size of (square) tiles in which gradients are computed
+			)
+			: thePtSrc{ ptSrc }
+			, theTileSize{ std::max(tileSize, std::size_t{ 1u }) }
+		{
+			// (same size restriction as for GradientGrid)
+			if (thePtSrc && (2u < thePtSrc->high()) && (2u < thePtSrc->wide()))
+			{
+				theNumTileRows = (thePtSrc->high() + theTileSize - 1u)
+					/ theTileSize;
+				theNumTileCols = (thePtSrc->wide() + theTileSize - 1u)
+					/ theTileSize;
+				// slots are sized here (never resized) for lock free reads
+				theTiles.resize(numTiles());
+				thePubTiles = std::vector<std::atomic<Tile const *>>
+					(numTiles());
+			}
+			else
+			{
+				thePtSrc = nullptr;
+			}
+		}
+
+		//! True if this instance is not null
+		inline
+		bool
+		isValid
+			() const
+		{
+			return (nullptr != thePtSrc);
+		}
+
+		//! Dimensions of (full) gradient area (same as source)
+		inline
+		ras::SizeHW
+		hwSize
+			() const
+		{
+			ras::SizeHW hwSize{};
+			if (isValid())
+			{
+				hwSize = thePtSrc->hwSize();
+			}
+			return hwSize;
+		}
+
+		//! Size of (square) tiles
+		inline
+		std::size_t
+		tileSize
+			() const
+		{
+			return theTileSize;
+		}
+
+		//! Total number of tiles covering full source
+		inline
+		std::size_t
+		numTiles
+			() const
+		{
+			return (theNumTileRows * theNumTileCols);
+		}
+
+		//! Number of tiles for which gradients have been computed
+		inline
+		std::size_t
+		numTilesComputed
+			() const
+		{
+			std::lock_guard<std::mutex> const lock(theMutex);
+			return theNumComputed;
+		}
+
+		/*! \brief Ensure gradients are available for cells in given area.
+		 *
+		 * The area is [rowBeg,rowEnd) by [colBeg,colEnd) (clipped to
+		 * source). Any tiles that overlap the area and that have not
+		 * yet been computed are computed now.
+		 */
+		inline
+		void
+		prepareArea
+			( std::size_t const & rowBeg
+			, std::size_t const & rowEnd
+			, std::size_t const & colBeg
+			, std::size_t const & colEnd
+			) const
+		{
+			if (isValid() && (rowBeg < rowEnd) && (colBeg < colEnd))
+			{
+				std::size_t const high{ thePtSrc->high() };
+				std::size_t const wide{ thePtSrc->wide() };
+				std::size_t const tileRowBeg{ rowBeg / theTileSize };
+				std::size_t const tileColBeg{ colBeg / theTileSize };
+				std::size_t const rowLast{ std::min(rowEnd, high) - 1u };
+				std::size_t const colLast{ std::min(colEnd, wide) - 1u };
+				std::size_t const tileRowEnd{ rowLast / theTileSize + 1u };
+				std::size_t const tileColEnd{ colLast / theTileSize + 1u };
+
+				std::lock_guard<std::mutex> const lock(theMutex);
+				for (std::size_t tRow{tileRowBeg} ; tRow < tileRowEnd ; ++tRow)
+				{
+					for (std::size_t tCol{tileColBeg} ; tCol < tileColEnd
+						; ++tCol)
+					{
+						std::size_t const ndx{ tRow * theNumTileCols + tCol };
+						std::unique_ptr<Tile> & ptTile = theTiles[ndx];
+						if (! ptTile)
+						{
+							ptTile = computedTile(tRow, tCol);
+							++theNumComputed;
+							thePubTiles[ndx].store
+								(ptTile.get(), std::memory_order_release);
+						}
+					}
+				}
+			}
+		}
+
+		/*! \brief Gradient {row,col} components at cell (row,col).
+		 *
+		 * Returns NaN components for border cells and for cells in
+		 * tiles that have not been prepared (ref prepareArea()).
+		 * Does not lock (reads published tiles only).
+		 */
+		inline
+		std::array<float, 2u>
+		componentsAt
+			( std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			constexpr float nan{ std::numeric_limits<float>::quiet_NaN() };
+			std::array<float, 2u> comps{ nan, nan };
+			std::size_t const tRow{ row / theTileSize };
+			std::size_t const tCol{ col / theTileSize };
+			if ((tRow < theNumTileRows) && (tCol < theNumTileCols))
+			{
+				Tile const * const ptTile
+					{ thePubTiles[tRow * theNumTileCols + tCol].load
+						(std::memory_order_acquire)
+					};
+				if (ptTile)
+				{
+					std::size_t const tileRow{ row - tRow * theTileSize };
+					std::size_t const tileCol{ col - tCol * theTileSize };
+					comps[0] = ptTile->theRowGrads(tileRow, tileCol);
+					comps[1] = ptTile->theColGrads(tileRow, tileCol);
+				}
+			}
+			return comps;
+		}
+
+		//! Gradient at (row,col) (null if border or not prepared)
+		inline
+		img::Grad
+		operator()
+			( std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			std::array<float, 2u> const comps{ componentsAt(row, col) };
+			return img::Grad{ (double)comps[0], (double)comps[1] };
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss
+				<< "hwSize: " << hwSize()
+				<< ' '
+				<< "tileSize: " << tileSize()
+				<< ' '
+				<< "numTiles: " << numTiles()
+				<< ' '
+				<< "numTilesComputed: " << numTilesComputed()
+				;
+			return oss.str();
+		}
+
+	}; // GradientTiles
+
+} // [ops]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::ops::GradientTiles const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	inline
+	bool
+	isValid
+		( quadloco::ops::GradientTiles const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
@@ -0,0 +1,525 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::ops::IntegralImage (summed area tables)
+ *
+ */
+
+
+#include "QuadLoco/rasChipSpec.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
+
+#include <Engabra>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+
+
+namespace quadloco
+{
+
+namespace ops
+{
+
+	/*! \brief Summed area tables for O(1) box statistics.
+	 *
+	 * Upon construction, cumulative sums of source values, of squared
+	 * source values, and of the number of valid (non-null) source cells
+	 * are computed. Thereafter, the sum, mean and variance of the
+	 * (valid) values within any rectangular box (ras::ChipSpec) are
+	 * available in constant time regardless of box size.
+	 *
+	 * For precision, sums are accumulated separately within square
+	 * tiles (of theTileSize cells on a side) and relative to the
+	 * (rounded) mean of the valid values in each tile. Sums therefore stay small even
+	 * for large images with large values (e.g. a high offset), and
+	 * variance (and squared differences from a reference value) are
+	 * evaluated about a local reference rather than from differences
+	 * of large global totals. A box contained in one tile costs one
+	 * table lookup per statistic, and a box straddling tile edges a
+	 * few more (one per overlapped tile).
+	 *
+	 * Tables have one more row and column than the source (the first
+	 * row and column are unused) and hold, at (row+1,col+1), the sum
+	 * over the tile cells up to and including source cell (row,col).
+	 * Sums are accumulated in double precision, counts in 32 bits.
+	 *
+	 * \par Example
+	 * \snippet test/test_opsIntegralImage.cpp DoxyExample01
+	 */
+	class IntegralImage
+	{
+	public:
+
+		//! Size (rows and columns) of tiles with separate sums
+		static constexpr std::size_t theTileSize{ 64u };
+
+	private:
+
+		//! Cumulative (within tile) sums of valid values less tile ref
+		ras::Grid<double> theSums{};
+
+		//! Cumulative (within tile) sums of squared (value less tile ref)
+		ras::Grid<double> theSumSqs{};
+
+		//! Cumulative (within tile) count of valid values
+		ras::Grid<std::uint32_t> theCounts{};
+
+		//! Reference value (rounded mean of valid values) for each tile
+		ras::Grid<double> theTileRefs{};
+
+		//! Count, sum and sum of squares relative to a reference value
+		struct Moments
+		{
+			std::size_t theCount{ 0u };
+			double theSum{ 0. };
+			double theSumSq{ 0. };
+			double theRef{ 0. };
+		};
+
+		//! Total within one tile for box (begs at or after tile begs)
+		template <typename Type>
+		inline
+		static
+		Type
+		tileTotal
+			( ras::Grid<Type> const & table
+			, std::size_t const & tileRow0 //!< First row in tile
+			, std::size_t const & tileCol0 //!< First col in tile
+			, std::size_t const & row0 //!< First row of box part
+			, std::size_t const & col0 //!< First col of box part
+			, std::size_t const & row1 //!< One past last row of box part
+			, std::size_t const & col1 //!< One past last col of box part
+			)
+		{
+			// table values before start of tile are (implicitly) zero
+			bool const atRow0{ (row0 == tileRow0) };
+			bool const atCol0{ (col0 == tileCol0) };
+			Type const sum00
+				{ (atRow0 || atCol0) ? Type{ 0 } : table(row0, col0) };
+			Type const sum01{ atRow0 ? Type{ 0 } : table(row0, col1) };
+			Type const sum10{ atCol0 ? Type{ 0 } : table(row1, col0) };
+			// (ordered to avoid unsigned underflow for count tables)
+			return ((table(row1, col1) + sum00) - (sum01 + sum10));
+		}
+
+		//! Moments of valid values in box (box must fit - no checking)
+		inline
+		Moments
+		momentsFor
+			( ras::ChipSpec const & box
+			) const
+		{
+			Moments moms{};
+			bool haveRef{ false };
+			std::size_t const rowEnd{ box.srcRowEnd() };
+			std::size_t const colEnd{ box.srcColEnd() };
+			for (std::size_t row0{box.srcRowBeg()} ; row0 < rowEnd ; )
+			{
+				std::size_t const tileRow{ row0 / theTileSize };
+				std::size_t const tileRow0{ tileRow * theTileSize };
+				std::size_t const row1
+					{ std::min(rowEnd, tileRow0 + theTileSize) };
+				for (std::size_t col0{box.srcColBeg()} ; col0 < colEnd ; )
+				{
+					std::size_t const tileCol{ col0 / theTileSize };
+					std::size_t const tileCol0{ tileCol * theTileSize };
+					std::size_t const col1
+						{ std::min(colEnd, tileCol0 + theTileSize) };
+
+					std::size_t const num
+						{ tileTotal
+							( theCounts, tileRow0, tileCol0
+							, row0, col0, row1, col1
+							)
+						};
+					if (0u < num)
+					{
+						double const sum
+							{ tileTotal
+								( theSums, tileRow0, tileCol0
+								, row0, col0, row1, col1
+								)
+							};
+						double const sumSq
+							{ tileTotal
+								( theSumSqs, tileRow0, tileCol0
+								, row0, col0, row1, col1
+								)
+							};
+						double const tileRef{ theTileRefs(tileRow, tileCol) };
+						if (! haveRef)
+						{
+							moms.theRef = tileRef;
+							haveRef = true;
+						}
+						// shift from tile reference to common reference
+						double const dRef{ tileRef - moms.theRef };
+						double const dNum{ static_cast<double>(num) };
+						moms.theCount += num;
+						moms.theSum += sum + dNum * dRef;
+						moms.theSumSq
+							+= sumSq + 2. * dRef * sum + dNum * dRef * dRef;
+					}
+					col0 = col1;
+				}
+				row0 = row1;
+			}
+			return moms;
+		}
+
+	public:
+
+		//! Construct a null instance (isValid() == false)
+		inline
+		IntegralImage
+			() = default;
+
+		//! Compute summed area tables for (all of) srcGrid
+		template <typename SrcType>
+		inline
+		explicit
+		IntegralImage
+			( ras::Grid<SrcType> const & srcGrid
+				//!< Source values (nulls are excluded from all statistics)
+			)
+		{
+			if (srcGrid.isValid())
+			{
+				std::size_t const high{ srcGrid.high() };
+				std::size_t const wide{ srcGrid.wide() };
+
+				// reference value for each tile ((rounded) mean value)
+				ras::SizeHW const hwTiles
+					{ (high + theTileSize - 1u) / theTileSize
+					, (wide + theTileSize - 1u) / theTileSize
+					};
+				theTileRefs = ras::Grid<double>(hwTiles);
+				std::fill(theTileRefs.begin(), theTileRefs.end(), 0.);
+				ras::Grid<std::size_t> tileCounts(hwTiles);
+				std::fill(tileCounts.begin(), tileCounts.end(), 0u);
+				for (std::size_t row{0u} ; row < high ; ++row)
+				{
+					std::size_t const tileRow{ row / theTileSize };
+					for (std::size_t col{0u} ; col < wide ; ++col)
+					{
+						SrcType const & srcVal = srcGrid(row, col);
+						if (engabra::g3::isValid(srcVal))
+						{
+							std::size_t const tileCol{ col / theTileSize };
+							theTileRefs(tileRow, tileCol)
+								+= static_cast<double>(srcVal);
+							++tileCounts(tileRow, tileCol);
+						}
+					}
+				}
+				for (std::size_t nn{0u} ; nn < theTileRefs.size() ; ++nn)
+				{
+					std::size_t const & num = *(tileCounts.cbegin() + nn);
+					if (0u < num)
+					{
+						// (rounded so integer data sum exactly)
+						double & ref = *(theTileRefs.begin() + nn);
+						ref = std::round(ref / static_cast<double>(num));
+					}
+				}
+
+				// cumulative sums restarting at each tile
+				ras::SizeHW const hwTable{ high + 1u, wide + 1u };
+				theSums = ras::Grid<double>(hwTable);
+				theSumSqs = ras::Grid<double>(hwTable);
+				theCounts = ras::Grid<std::uint32_t>(hwTable);
+				std::fill(theSums.begin(), theSums.end(), 0.);
+				std::fill(theSumSqs.begin(), theSumSqs.end(), 0.);
+				std::fill(theCounts.begin(), theCounts.end(), 0u);
+				for (std::size_t row{0u} ; row < high ; ++row)
+				{
+					std::size_t const tileRow{ row / theTileSize };
+					// first row in tile has nothing above it
+					bool const addAbove{ (0u != (row % theTileSize)) };
+					double rowSum{ 0. };
+					double rowSumSq{ 0. };
+					std::uint32_t rowCount{ 0u };
+					double tileRef{ 0. };
+					for (std::size_t col{0u} ; col < wide ; ++col)
+					{
+						// running totals along this source row (in tile)
+						if (0u == (col % theTileSize))
+						{
+							rowSum = 0.;
+							rowSumSq = 0.;
+							rowCount = 0u;
+							tileRef = theTileRefs(tileRow, col / theTileSize);
+						}
+						SrcType const & srcVal = srcGrid(row, col);
+						if (engabra::g3::isValid(srcVal))
+						{
+							double const value
+								{ static_cast<double>(srcVal) - tileRef };
+							rowSum += value;
+							rowSumSq += value * value;
+							++rowCount;
+						}
+						// add to totals from row above (within tile)
+						double sumAbove{ 0. };
+						double sumSqAbove{ 0. };
+						std::uint32_t countAbove{ 0u };
+						if (addAbove)
+						{
+							sumAbove = theSums(row, col + 1u);
+							sumSqAbove = theSumSqs(row, col + 1u);
+							countAbove = theCounts(row, col + 1u);
+						}
+						theSums(row + 1u, col + 1u) = sumAbove + rowSum;
+						theSumSqs(row + 1u, col + 1u) = sumSqAbove + rowSumSq;
+						theCounts(row + 1u, col + 1u) = countAbove + rowCount;
+					}
+				}
+			}
+		}
+
+		//! True if this instance is not null
+		inline
+		bool
+		isValid
+			() const
+		{
+			return theSums.isValid();
+		}
+
+		//! Size of source grid from which tables were computed
+		inline
+		ras::SizeHW
+		hwSize
+			() const
+		{
+			ras::SizeHW hwSize{};
+			if (isValid())
+			{
+				hwSize = ras::SizeHW
+					{ theSums.high() - 1u, theSums.wide() - 1u };
+			}
+			return hwSize;
+		}
+
+		//! True if box is entirely within the source area
+		inline
+		bool
+		contains
+			( ras::ChipSpec const & box
+			) const
+		{
+			return (isValid() && box.isValid() && box.fitsInto(hwSize()));
+		}
+
+		//! Number of valid source cells in box (zero if box not contained)
+		inline
+		std::size_t
+		count
+			( ras::ChipSpec const & box
+			) const
+		{
+			std::size_t num{ 0u };
+			if (contains(box))
+			{
+				num = momentsFor(box).theCount;
+			}
+			return num;
+		}
+
+		//! True if box is contained and all cells in it are valid
+		inline
+		bool
+		isFull
+			( ras::ChipSpec const & box
+			) const
+		{
+			return
+				(  contains(box)
+				&& (box.hwSize().size() == momentsFor(box).theCount)
+				);
+		}
+
+		//! Sum of valid source values in box (null if box not contained)
+		inline
+		double
+		sum
+			( ras::ChipSpec const & box
+			) const
+		{
+			double total{ std::numeric_limits<double>::quiet_NaN() };
+			if (contains(box))
+			{
+				Moments const moms{ momentsFor(box) };
+				double const num{ static_cast<double>(moms.theCount) };
+				total = moms.theSum + num * moms.theRef;
+			}
+			return total;
+		}
+
+		//! Sum of squared valid values in box (null if box not contained)
+		inline
+		double
+		sumSq
+			( ras::ChipSpec const & box
+			) const
+		{
+			return sumSqDiff(box, 0.);
+		}
+
+		/*! \brief Sum of squared differences of valid values from ref.
+		 *
+		 * Evaluated about the (local) tile reference values, so that
+		 * precision does not depend on the magnitude of the source
+		 * values (when ref is comparable to them). Null if box is not
+		 * contained.
+		 */
+		inline
+		double
+		sumSqDiff
+			( ras::ChipSpec const & box
+			, double const & ref
+			) const
+		{
+			double total{ std::numeric_limits<double>::quiet_NaN() };
+			if (contains(box))
+			{
+				Moments const moms{ momentsFor(box) };
+				double const num{ static_cast<double>(moms.theCount) };
+				double const dRef{ moms.theRef - ref };
+				total = moms.theSumSq
+					+ 2. * dRef * moms.theSum
+					+ num * dRef * dRef;
+				total = std::max(0., total);
+			}
+			return total;
+		}
+
+		//! Mean of valid values in box (null if none)
+		inline
+		double
+		mean
+			( ras::ChipSpec const & box
+			) const
+		{
+			double ave{ std::numeric_limits<double>::quiet_NaN() };
+			if (contains(box))
+			{
+				Moments const moms{ momentsFor(box) };
+				if (0u < moms.theCount)
+				{
+					double const num{ static_cast<double>(moms.theCount) };
+					ave = moms.theRef + moms.theSum / num;
+				}
+			}
+			return ave;
+		}
+
+		/*! \brief (Population) variance of valid values in box.
+		 *
+		 * Computed from sums relative to a local (tile) reference and
+		 * clamped to be non-negative. Null if box has no valid values.
+		 */
+		inline
+		double
+		variance
+			( ras::ChipSpec const & box
+			) const
+		{
+			double var{ std::numeric_limits<double>::quiet_NaN() };
+			if (contains(box))
+			{
+				Moments const moms{ momentsFor(box) };
+				if (0u < moms.theCount)
+				{
+					double const scl
+						{ 1. / static_cast<double>(moms.theCount) };
+					double const ave{ scl * moms.theSum };
+					double const aveSq{ scl * moms.theSumSq };
+					var = std::max(0., (aveSq - ave * ave));
+				}
+			}
+			return var;
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss << "hwSize: " << hwSize();
+			return oss.str();
+		}
+
+	}; // IntegralImage
+
+} // [ops]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::ops::IntegralImage const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	inline
+	bool
+	isValid
+		( quadloco::ops::IntegralImage const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
@@ -34,15 +34,27 @@
 
 #include "QuadLoco/rasRelRC.hpp"
 #include "QuadLoco/imgSpot.hpp"
+#include "QuadLoco/opsAllPeaks2D.hpp"
 #include "QuadLoco/prbStats.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
+#include "QuadLoco/rasNullDistance.hpp"
 #include "QuadLoco/rasRowCol.hpp"
+#include "QuadLoco/rassimd.hpp"
+#include "QuadLoco/sysThreadPool.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <numbers>
+#include <sstream>
+#include <string>
+#include <utility>
 #include <vector>
 
 
@@ -157,6 +169,34 @@ namespace ops
 		return relRCs;
 	}
 
+	//! Linear offsets (relRow*rowStride + relCol) for relRCs[ndxBeg,ndxEnd)
+	inline
+	std::vector<std::ptrdiff_t>
+	linearOffsetsFor
+		( std::vector<ras::RelRC> const & relRCs
+			//!< Relative row/col offsets (e.g. from annularRelRCs())
+		, std::size_t const & ndxBeg
+			//!< First of relRCs to convert
+		, std::size_t const & ndxEnd
+			//!< One past last of relRCs to convert
+		, std::size_t const & rowStride
+			//!< Number of elements from one source row to the next
+		)
+	{
+		std::vector<std::ptrdiff_t> offsets{};
+		offsets.reserve(ndxEnd - ndxBeg);
+		std::ptrdiff_t const stride{ static_cast<std::ptrdiff_t>(rowStride) };
+		for (std::size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+		{
+			ras::RelRC const & relRC = relRCs[ndx];
+			offsets.emplace_back
+				( static_cast<std::ptrdiff_t>(relRC.theRelRow) * stride
+				+ static_cast<std::ptrdiff_t>(relRC.theRelCol)
+				);
+		}
+		return offsets;
+	}
+
 
 	/*! \brief An annular ring symmetry filter
 	 *
@@ -192,7 +232,7 @@ namespace ops
 	struct SymRing
 	{
 		//! Access into (externally managed) source data
-		ras::Grid<float> const * const thePtSrc{ nullptr };
+		ras::GridView<float> const theSrcView{};
 
 		//! Middle range value over source data (.5*(min()+max()))
 		float theSrcMidValue{};
@@ -210,23 +250,100 @@ namespace ops
 		//! Tunning parm - min number cell values in each transition zone
 		static constexpr std::size_t theMinPosNeg{ 1u };
 
-		//! \brief Construct to operate on ptSrc image.
+		//! Pairs in annularRelRCs(3) ring: evaluated with unrolled loop
+		static constexpr std::size_t theNumPairsR3{ 10u };
+		//! Pairs in annularRelRCs(5) ring: evaluated with unrolled loop
+		static constexpr std::size_t theNumPairsR5{ 16u };
+
+		//! Compile-time copy of annularRelRCs(3) (for unrolled loop)
+		static constexpr std::array<ras::RelRC, 2u*theNumPairsR3> theRelRCsR3
+			{{ {  4,  0 }, {  3,  1 }, {  3,  2 }, {  2,  3 }, {  1,  3 }
+			 , {  0,  4 }, { -1,  3 }, { -2,  3 }, { -3,  2 }, { -3,  1 }
+			 , { -4,  0 }, { -3, -1 }, { -3, -2 }, { -2, -3 }, { -1, -3 }
+			 , {  0, -4 }, {  1, -3 }, {  2, -3 }, {  3, -2 }, {  3, -1 }
+			}};
+		//! Compile-time copy of annularRelRCs(5) (for unrolled loop)
+		static constexpr std::array<ras::RelRC, 2u*theNumPairsR5> theRelRCsR5
+			{{ {  6,  0 }, {  5,  1 }, {  5,  2 }, {  5,  3 }
+			 , {  4,  4 }, {  3,  5 }, {  2,  5 }, {  1,  5 }
+			 , {  0,  6 }, { -1,  5 }, { -2,  5 }, { -3,  5 }
+			 , { -4,  4 }, { -5,  3 }, { -5,  2 }, { -5,  1 }
+			 , { -6,  0 }, { -5, -1 }, { -5, -2 }, { -5, -3 }
+			 , { -4, -4 }, { -3, -5 }, { -2, -5 }, { -1, -5 }
+			 , {  0, -6 }, {  1, -5 }, {  2, -5 }, {  3, -5 }
+			 , {  4, -4 }, {  5, -3 }, {  5, -2 }, {  5, -1 }
+			}};
+
+		//! Null distances for theSrcView (external or theOwnNullDist)
+		ras::NullDistance const * thePtNullDist{ nullptr };
+
+		//! Null distances computed here if none were provided (shared copy)
+		std::shared_ptr<ras::NullDistance const> theOwnNullDist{};
+
+		//! Linear offsets (for theSrcView) to first half of ring
+		std::vector<std::ptrdiff_t> theOffsets1{};
+		//! Linear offsets to second half (opposite theOffsets1 entries)
+		std::vector<std::ptrdiff_t> theOffsets2{};
+
+		//! \brief Construct to operate on (externally managed) srcView data.
 		inline
 		explicit
 		SymRing  // SymRing::
-			( ras::Grid<float> const * const & ptSrc
-				//!< Access source data grid (e.g. raw or smoothed image, etc)
+			( ras::GridView<float> const & srcView
+				//!< Access source data (e.g. chip within larger image)
 			, prb::Stats<float> const & srcStats
 				//!< Statistics on source data grid
 			, std::size_t const & halfSize
 				//!< Controls filter size \ref annularRelRCs()
+			, ras::NullDistance const * const & ptNullDist = nullptr
+				//!< Nulls in source (if not provided, computed here)
 			)
-			: thePtSrc{ ptSrc }
+			: theSrcView{ srcView }
 			, theSrcMidValue{ .5f * (srcStats.max() + srcStats.min()) }
 			, theSrcFullRange{ srcStats.range() }
 			, theHalfFilterSize{ static_cast<int>(halfSize + 1u) }
 			, theRelRCs{ annularRelRCs(halfSize) }
 			, theHalfRingSize{ theRelRCs.size() / 2u }
+			, thePtNullDist{ ptNullDist }
+			, theOffsets1{ linearOffsetsFor
+				(theRelRCs, 0u, theHalfRingSize, srcView.rowStride()) }
+			, theOffsets2{ linearOffsetsFor
+				( theRelRCs, theHalfRingSize, 2u * theHalfRingSize
+				, srcView.rowStride()
+				) }
+		{
+			// null distances enable the (vectorized) fillRow/fillCells
+			// paths - if not provided by caller, compute (once) here
+			if ((! thePtNullDist) && theSrcView.isValid())
+			{
+				theOwnNullDist = std::make_shared<ras::NullDistance const>
+					(theSrcView);
+				thePtNullDist = theOwnNullDist.get();
+			}
+		}
+
+		//! \brief Construct to operate on ptSrc image.
+		inline
+		explicit
+		SymRing  // SymRing::
+			( ras::Grid<float> const * const & ptSrc
+				//!< Access source data grid (e.g. raw or smoothed image, etc)
+			, prb::Stats<float> const & srcStats
+				//!< Statistics on source data grid
+			, std::size_t const & halfSize
+				//!< Controls filter size \ref annularRelRCs()
+			, ras::NullDistance const * const & ptNullDist = nullptr
+				//!< Nulls in source (if not provided, computed here)
+			)
+			: SymRing
+				( ( ptSrc
+				  ? ras::GridView<float>(*ptSrc)
+				  : ras::GridView<float>{}
+				  )
+				, srcStats
+				, halfSize
+				, ptNullDist
+				)
 		{ }
 
 		//! Nominal "radial" size of annulus
@@ -421,6 +538,161 @@ namespace ops
 
 		}; // RingStats
 
+		//! Consider (valid) values of the nn-th radially opposite pair
+		inline
+		void
+		considerPair  // SymRing::
+			( RingStats * const & ptRingStats
+			, std::size_t const & row
+			, std::size_t const & col
+			, std::size_t const & nn
+			) const
+		{
+			ras::RelRC const & relRC1 = theRelRCs[nn];
+			ras::RelRC const & relRC2 = theRelRCs[nn + theHalfRingSize];
+			float const & srcVal1 = theSrcView(relRC1.srcRowCol(row, col));
+			float const & srcVal2 = theSrcView(relRC2.srcRowCol(row, col));
+			ptRingStats->consider
+				( (double)(srcVal1 - theSrcMidValue)
+				, (double)(srcVal2 - theSrcMidValue)
+				);
+		}
+
+		//! Consider Ndx-th pair of compile-time RelRCs (ring must fit)
+		template <auto const & RelRCs, std::size_t Ndx>
+		inline
+		void
+		considerFixedPair  // SymRing::
+			( RingStats * const & ptRingStats
+			, std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			constexpr std::size_t numPairs{ RelRCs.size() / 2u };
+			constexpr ras::RelRC relRC1{ RelRCs[Ndx] };
+			constexpr ras::RelRC relRC2{ RelRCs[Ndx + numPairs] };
+			std::ptrdiff_t const iRow{ static_cast<std::ptrdiff_t>(row) };
+			std::ptrdiff_t const iCol{ static_cast<std::ptrdiff_t>(col) };
+			float const & srcVal1 = theSrcView
+				( static_cast<std::size_t>(iRow + relRC1.theRelRow)
+				, static_cast<std::size_t>(iCol + relRC1.theRelCol)
+				);
+			float const & srcVal2 = theSrcView
+				( static_cast<std::size_t>(iRow + relRC2.theRelRow)
+				, static_cast<std::size_t>(iCol + relRC2.theRelCol)
+				);
+			ptRingStats->consider
+				( (double)(srcVal1 - theSrcMidValue)
+				, (double)(srcVal2 - theSrcMidValue)
+				);
+		}
+
+		//! Consider all pairs of compile-time RelRCs ring: unrolled
+		template <auto const & RelRCs, std::size_t... Ndxs>
+		inline
+		void
+		considerFixedPairs  // SymRing::
+			( RingStats * const & ptRingStats
+			, std::size_t const & row
+			, std::size_t const & col
+			, std::index_sequence<Ndxs...>
+			) const
+		{
+			(considerFixedPair<RelRCs, Ndxs>(ptRingStats, row, col), ...);
+		}
+
+		//! Consider all pairs of (entirely valid) ring around (row,col)
+		inline
+		void
+		considerAllPairs  // SymRing::
+			( RingStats * const & ptRingStats
+			, std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			// common rings have offsets (and trip count) known at
+			// compile time (theHalfFilterSize is ring radius plus one)
+			if (4 == theHalfFilterSize)
+			{
+				considerFixedPairs<theRelRCsR3>
+					( ptRingStats, row, col
+					, std::make_index_sequence<theNumPairsR3>{}
+					);
+			}
+			else
+			if (6 == theHalfFilterSize)
+			{
+				considerFixedPairs<theRelRCsR5>
+					( ptRingStats, row, col
+					, std::make_index_sequence<theNumPairsR5>{}
+					);
+			}
+			else
+			{
+				for (std::size_t nn{0u} ; nn < theHalfRingSize ; ++nn)
+				{
+					considerPair(ptRingStats, row, col, nn);
+				}
+			}
+		}
+
+
+		/*! \brief Filter response value given statistics for full ring
+		 *
+		 * Combines balance, symmetry and contrast metrics (ref class
+		 * description). Requires srcOkay (valid theSrcFullRange).
+		 */
+		inline
+		float
+		responseFor  // SymRing::
+			( RingStats ringStats
+				//!< Statistics from all (valid) ring pairs
+			) const
+		{
+			float outVal{ std::numeric_limits<float>::quiet_NaN() };
+
+			// Balanced lo/hi count threshold qualification
+			if (! ringStats.hasPosNegBalance(theMinPosNeg))
+			{
+				outVal = 0.f;
+			}
+			else // if (enoughPos && enoughNeg)
+			{
+				// Half-Turn Symmetry metric
+				double const valDifVar{ ringStats.varianceValueDifs() };
+				//
+				// for a pure bimodal signal with all values at
+				// either -k or +k, the variance for N samples
+				// is (N*sq(k))/(N-1) which is esentially sq(k)
+				// when N is large (close enough for here)
+				// HOWEVER - it seems half that value works better
+			//	double const kValue{ .5 * theSrcFullRange }; // 'k'
+				double const kValue{ .250 * theSrcFullRange }; // 'k'
+				double const valSrcVar{ sq(kValue) };
+				//
+				// use ratio of filter variance to source variance
+				// as argument for Guassian pseudo prob value
+				double const varianceRatio{ valDifVar / valSrcVar };
+				//
+				// valDifProb ranges in [0,1]
+				double const valDifProb{ std::exp(-varianceRatio) };
+
+				// High Contrast metric (rather ad hoc)
+				// -- normalized to full range in source image
+				double const rngRing
+					{ ringStats.valueRange() / theSrcFullRange };
+
+				// Center element has value near middle of range
+				// -- only relevant for well exposed targets. If
+				// target image is under/over exposed, then the
+				// center values are either dark or light.
+
+				// filter response value
+				outVal = (float)(rngRing * valDifProb);
+
+			} // has pos/neg balance
+			return outVal;
+		}
 
 		//! \brief Evaluate the metric at source image (row,col) location
 		inline
@@ -437,112 +709,312 @@ namespace ops
 				};
 			if (srcOkay)
 			{
-				ras::Grid<float> const & srcGrid = *thePtSrc;
+				ras::GridView<float> const & srcGrid = theSrcView;
 
 				// compare first and second half of ring
 				// (ring pattern halves should repeat for half-turn symmetry)
 				RingStats ringStats{};
 
+				// if ring is known to be entirely valid, skip null checks
+				bool const allValid
+					{  thePtNullDist
+					&& thePtNullDist->isWindowValid
+						(row, col, halfSize(), halfSize())
+					};
+
 				bool hitNull{ false };
-				for (std::size_t nn{0u} ; nn < theHalfRingSize ; ++nn)
+				if (allValid)
+				{
+					considerAllPairs(&ringStats, row, col);
+				}
+				else
+				{
+					for (std::size_t nn{0u} ; nn < theHalfRingSize ; ++nn)
+					{
+						// check values at radially opposite portion of annulus
+						std::size_t & ndx1 = nn;
+						std::size_t ndx2{ ndx1 + theHalfRingSize };
+
+						// access radially opposite ring source values
+						ras::RelRC const & relRC1 = theRelRCs[ndx1];
+						float const & srcVal1
+							= srcGrid(relRC1.srcRowCol(row, col));
+
+						ras::RelRC const & relRC2 = theRelRCs[ndx2];
+						float const & srcVal2
+							= srcGrid(relRC2.srcRowCol(row, col));
+
+						if (pix::isValid(srcVal1) && pix::isValid(srcVal2))
+						{
+							double const delta1
+								{ (double)(srcVal1 - theSrcMidValue) };
+							double const delta2
+								{ (double)(srcVal2 - theSrcMidValue) };
+							ringStats.consider(delta1, delta2);
+						}
+						else
+						{
+							// don't try to work around null input pixel(s)
+							// values (e.g. assume filter processing window is
+							// entirely within valid image area, and there are
+							// no missing pixels within this region)
+							hitNull = true;
+							break;
+						}
+
+					} // ring loop
+				}
+
+				// perform filter analysis
+				if (! hitNull)
+				{
+					outVal = responseFor(ringStats);
+				}
+
+			} // srcOkay
+
+			return outVal;
+		}
+
+		//! RingStats for full ring from ras::simd::ringPairStats*() values
+		inline
+		RingStats
+		ringStatsFor  // SymRing::
+			( float const & min
+				//!< Minimum delta over ring
+			, float const & max
+				//!< Maximum delta over ring
+			, double const & sumSqDif
+				//!< Sum of squared pair differences
+			, std::uint32_t const & numNeg
+				//!< Number of pairs with negative sum
+			) const
+		{
+			RingStats ringStats{};
+			ringStats.theMin = (double)min;
+			ringStats.theMax = (double)max;
+			ringStats.theCount = theHalfRingSize;
+			ringStats.theSumSqDif = sumSqDif;
+			ringStats.theNumNeg = numNeg;
+			ringStats.theNumPos = theHalfRingSize - ringStats.theNumNeg;
+			return ringStats;
+		}
+
+		/*! \brief Reusable work space for fillRow() and fillCells().
+		 *
+		 * Buffers grow as needed and are retained between calls such
+		 * that repeated evaluations (e.g. every row of a grid) do not
+		 * allocate. Each thread should use its own instance.
+		 */
+		struct RingScratch
+		{
+			std::vector<float> theMins{};
+			std::vector<float> theMaxs{};
+			std::vector<double> theSumSqDifs{};
+			std::vector<std::uint32_t> theNumNegs{};
+			std::vector<std::size_t> theFastNdxs{};
+			std::vector<std::ptrdiff_t> theCellOffsets{};
+
+			//! Ensure ring statistics buffers hold at least numCells
+			inline
+			void
+			reserveStats  // RingScratch::
+				( std::size_t const & numCells
+				)
+			{
+				if (theMins.size() < numCells)
 				{
-					// check values at radially opposite portion of annulus
-					std::size_t & ndx1 = nn;
-					std::size_t ndx2{ ndx1 + theHalfRingSize };
+					theMins.resize(numCells);
+					theMaxs.resize(numCells);
+					theSumSqDifs.resize(numCells);
+					theNumNegs.resize(numCells);
+				}
+			}
 
-					// access radially opposite ring source values
-					ras::RelRC const & relRC1 = theRelRCs[ndx1];
-					float const & srcVal1
-						= srcGrid(relRC1.srcRowCol(row, col));
+		}; // RingScratch
 
-					ras::RelRC const & relRC2 = theRelRCs[ndx2];
-					float const & srcVal2
-						= srcGrid(relRC2.srcRowCol(row, col));
+		/*! \brief Evaluate filter for source cells (row,[colBeg,colEnd)).
+		 *
+		 * Results are identical to operator()(row,col) for each cell.
+		 * Runs of cells for which the entire ring is known to be valid
+		 * (via thePtNullDist) are evaluated several at a time via
+		 * ras::simd::ringPairStatsRow() using (precomputed) linear
+		 * offsets into theSrcView. Other cells use operator().
+		 */
+		inline
+		void
+		fillRow  // SymRing::
+			( std::size_t const & row
+				//!< Source row
+			, std::size_t const & colBeg
+				//!< First source column to evaluate
+			, std::size_t const & colEnd
+				//!< One past last source column to evaluate
+			, float * const & outBeg
+				//!< Result for colBeg (and following for colEnd-colBeg)
+			, sys::cpu::SimdLevel const & level = sys::cpu::simdLevel()
+				//!< Most capable instruction set to use
+			, RingScratch * const & ptScratch = nullptr
+				//!< Reusable work space (if null, allocated for this call)
+			) const
+		{
+			bool const srcOkay
+				{  engabra::g3::isValid(theSrcFullRange)
+				&& (0. < theSrcFullRange)
+				};
+			std::size_t col{ colBeg };
+			if (srcOkay && thePtNullDist && (colBeg < colEnd))
+			{
+				RingScratch localScratch{};
+				RingScratch & scratch = ptScratch ? *ptScratch : localScratch;
+				scratch.reserveStats(colEnd - colBeg);
+				std::vector<float> & mins = scratch.theMins;
+				std::vector<float> & maxs = scratch.theMaxs;
+				std::vector<double> & sumSqDifs = scratch.theSumSqDifs;
+				std::vector<std::uint32_t> & numNegs = scratch.theNumNegs;
+				while (col < colEnd)
+				{
+					// find run of cells with entirely valid rings
+					std::size_t runEnd{ col };
+					while ( (runEnd < colEnd)
+						 && thePtNullDist->isWindowValid
+							(row, runEnd, halfSize(), halfSize())
+						  )
+					{
+						++runEnd;
+					}
 
-					if (pix::isValid(srcVal1) && pix::isValid(srcVal2))
+					if (col < runEnd)
 					{
-						double const delta1
-							{ (double)(srcVal1 - theSrcMidValue) };
-						double const delta2
-							{ (double)(srcVal2 - theSrcMidValue) };
-						ringStats.consider(delta1, delta2);
+						std::size_t const ndxBeg{ col - colBeg };
+						std::size_t const ndxEnd{ runEnd - colBeg };
+						ras::simd::ringPairStatsRow
+							( &(theSrcView(row, col))
+							, (runEnd - col)
+							, theOffsets1.data()
+							, theOffsets2.data()
+							, theHalfRingSize
+							, theSrcMidValue
+							, mins.data() + ndxBeg
+							, maxs.data() + ndxBeg
+							, sumSqDifs.data() + ndxBeg
+							, numNegs.data() + ndxBeg
+							, level
+							);
+						for (std::size_t ndx{ndxBeg} ; ndx < ndxEnd ; ++ndx)
+						{
+							outBeg[ndx] = responseFor
+								(ringStatsFor
+									( mins[ndx], maxs[ndx]
+									, sumSqDifs[ndx], numNegs[ndx]
+									)
+								);
+						}
+						col = runEnd;
 					}
 					else
 					{
-						// don't try to work around null input pixel(s)
-						// values (e.g. assume filter processing window is
-						// entirely within valid image area, and there are
-						// no missing pixels within this region)
-						hitNull = true;
-						break;
+						outBeg[col - colBeg] = operator()(row, col);
+						++col;
 					}
+				}
+			}
 
-				} // ring loop
+			// remaining (or all if no null distances) cells
+			for ( ; col < colEnd ; ++col)
+			{
+				outBeg[col - colBeg] = operator()(row, col);
+			}
+		}
 
-				// perform filter analysis
-				if (! hitNull)
+		/*! \brief Evaluate filter at (scattered) source cells rowcols.
+		 *
+		 * Results are identical to operator() for each cell. Cells for
+		 * which the entire ring is known to be valid (via
+		 * thePtNullDist) are evaluated in batches (several cells at a
+		 * time) via ras::simd::ringPairStatsCells(). Other cells use
+		 * operator().
+		 */
+		inline
+		void
+		fillCells  // SymRing::
+			( std::vector<ras::RowCol> const & rowcols
+				//!< Source cells at which to evaluate
+			, float * const & outVals
+				//!< Result for each of rowcols (in same order)
+			, sys::cpu::SimdLevel const & level = sys::cpu::simdLevel()
+				//!< Most capable instruction set to use
+			, RingScratch * const & ptScratch = nullptr
+				//!< Reusable work space (if null, allocated for this call)
+			) const
+		{
+			bool const srcOkay
+				{  engabra::g3::isValid(theSrcFullRange)
+				&& (0. < theSrcFullRange)
+				};
+			RingScratch localScratch{};
+			RingScratch & scratch = ptScratch ? *ptScratch : localScratch;
+			std::size_t const numCells{ rowcols.size() };
+			std::vector<std::size_t> & fastNdxs = scratch.theFastNdxs;
+			std::vector<std::ptrdiff_t> & cellOffsets = scratch.theCellOffsets;
+			fastNdxs.clear();
+			cellOffsets.clear();
+			fastNdxs.reserve(numCells);
+			cellOffsets.reserve(numCells);
+			std::ptrdiff_t const stride
+				{ (std::ptrdiff_t)theSrcView.rowStride() };
+			for (std::size_t ndx{0u} ; ndx < numCells ; ++ndx)
+			{
+				std::size_t const & row = rowcols[ndx].row();
+				std::size_t const & col = rowcols[ndx].col();
+				bool const allValid
+					{  srcOkay
+					&& thePtNullDist
+					&& thePtNullDist->isWindowValid
+						(row, col, halfSize(), halfSize())
+					};
+				if (allValid)
 				{
-					// Balanced lo/hi count threshold qualification
-					if (! ringStats.hasPosNegBalance(theMinPosNeg))
-					{
-						outVal = 0.f;
-					}
-					else // if (enoughPos && enoughNeg)
-					{
-						// Half-Turn Symmetry metric
-						double const valDifVar{ ringStats.varianceValueDifs() };
-						//
-						// for a pure bimodal signal with all values at
-						// either -k or +k, the variance for N samples
-						// is (N*sq(k))/(N-1) which is esentially sq(k)
-						// when N is large (close enough for here)
-						// HOWEVER - it seems half that value works better
-					//	double const kValue{ .5 * theSrcFullRange }; // 'k'
-						double const kValue{ .250 * theSrcFullRange }; // 'k'
-						double const valSrcVar{ sq(kValue) };
-						//
-						// use ratio of filter variance to source variance
-						// as argument for Guassian pseudo prob value
-						double const varianceRatio{ valDifVar / valSrcVar };
-						//
-						// valDifProb ranges in [0,1]
-						double const valDifProb{ std::exp(-varianceRatio) };
-
-						// High Contrast metric (rather ad hoc)
-						// -- normalized to full range in source image
-						double const rngRing
-							{ ringStats.valueRange() / theSrcFullRange };
-
-						// Center element has value near middle of range
-						// -- only relevant for well exposed targets. If
-						// target image is under/over exposed, then the
-						// center values are either dark or light.
-
-						// filter response value
-						outVal = (float)(rngRing * valDifProb);
-
-/*
-//std::cout << "ringStats: " << ringStats.infoString() << '\n';
-using engabra::g3::io::fixed;
-std::cout
-//	<< "ringStat: " << ringStats.infoString()
-//	<< "SymRing::"
-	<< "rowcol:"
-		<< ' ' << std::setw(3u) << row
-		<< ' ' << std::setw(3u) << col
-	<< " valDifProb: " << fixed(valDifProb)
-	<< " rngRing: " << fixed(rngRing)
-	<< " outVal: " << fixed(outVal)
-	<< '\n';
-*/
-
-					} // has pos/neg balance
-
-				} // ! hitNull
-
-			} // srcOkay
+					fastNdxs.emplace_back(ndx);
+					cellOffsets.emplace_back
+						((std::ptrdiff_t)row * stride + (std::ptrdiff_t)col);
+				}
+				else
+				{
+					outVals[ndx] = operator()(row, col);
+				}
+			}
 
-			return outVal;
+			std::size_t const numFast{ fastNdxs.size() };
+			if (0u < numFast)
+			{
+				scratch.reserveStats(numFast);
+				std::vector<float> & mins = scratch.theMins;
+				std::vector<float> & maxs = scratch.theMaxs;
+				std::vector<double> & sumSqDifs = scratch.theSumSqDifs;
+				std::vector<std::uint32_t> & numNegs = scratch.theNumNegs;
+				ras::simd::ringPairStatsCells
+					( &(theSrcView(0u, 0u))
+					, cellOffsets.data()
+					, numFast
+					, theOffsets1.data()
+					, theOffsets2.data()
+					, theHalfRingSize
+					, theSrcMidValue
+					, mins.data()
+					, maxs.data()
+					, sumSqDifs.data()
+					, numNegs.data()
+					, level
+					);
+				for (std::size_t nn{0u} ; nn < numFast ; ++nn)
+				{
+					outVals[fastNdxs[nn]] = responseFor
+						(ringStatsFor
+							(mins[nn], maxs[nn], sumSqDifs[nn], numNegs[nn])
+						);
+				}
+			}
 		}
 
 		//! Descriptive information about this instance.
@@ -557,10 +1029,10 @@ std::cout
 			{
 				oss << title << '\n';
 			}
-			if (thePtSrc)
+			if (theSrcView.isValid())
 			{
 				oss
-					<< "*thePtSrc: " << *thePtSrc
+					<< "theSrcView: " << theSrcView
 					<< '\n'
 					<< "theSrcMidValue: " << theSrcMidValue
 					<< '\n'
@@ -600,14 +1072,16 @@ std::cout
 	}; // SymRing
 
 
-	//! \brief Result applying SymRing rotation symmetry filter to full grid
+	//! \brief Result applying SymRing rotation symmetry filter to full view
 	inline
 	ras::Grid<float>
 	symRingGridFor
-		( ras::Grid<float> const & srcGrid
-			//!< Input intensity grid
+		( ras::GridView<float> const & srcGrid
+			//!< Input intensity data (e.g. chip within larger image)
 		, SymRing const & symRing
 			//!< Annular symmetry filter
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
 		)
 	{
 		ras::Grid<float> symGrid(srcGrid.hwSize());
@@ -615,19 +1089,26 @@ std::cout
 
 		std::size_t const halfSize{ symRing.halfSize() };
 		std::size_t const fullSize{ symRing.fullSize() };
-		if ((fullSize < srcGrid.high()) && (fullSize < srcGrid.high()))
+		if ((fullSize < srcGrid.high()) && (fullSize < srcGrid.wide()))
 		{
-			std::size_t const & rowBeg = halfSize;
 			std::size_t const & colBeg = halfSize;
-			std::size_t const rowEnd{ srcGrid.high() - halfSize };
 			std::size_t const colEnd{ srcGrid.wide() - halfSize };
-			for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
-			{
-				for (std::size_t col{colBeg} ; col < colEnd ; ++col)
-				{
-					symGrid(row, col) = symRing(row, col);
-				}
-			}
+			sys::cpu::SimdLevel const level{ sys::cpu::simdLevel() };
+			sys::forEachBand
+				( halfSize, (srcGrid.high() - halfSize), exec
+				, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+					{
+						// work space reused for all rows of this band
+						SymRing::RingScratch scratch{};
+						for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+						{
+							symRing.fillRow
+								( row, colBeg, colEnd, &(symGrid(row, colBeg))
+								, level, &scratch
+								);
+						}
+					}
+				);
 		}
 
 		return symGrid;
@@ -639,13 +1120,613 @@ std::cout
 	symRingGridFor
 		( ras::Grid<float> const & srcGrid
 			//!< Input intensity grid
+		, SymRing const & symRing
+			//!< Annular symmetry filter
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		return symRingGridFor
+			(ras::GridView<float>(srcGrid), symRing, exec);
+	}
+
+	//! \brief Statistics for all (valid) values within srcView
+	inline
+	prb::Stats<float>
+	statsFor
+		( ras::GridView<float> const & srcView
+		)
+	{
+		prb::Stats<float> srcStats{};
+		for (std::size_t row{0u} ; row < srcView.high() ; ++row)
+		{
+			srcStats.consider(srcView.cbeginRow(row), srcView.cendRow(row));
+		}
+		return srcStats;
+	}
+
+	//! \brief Result applying SymRing rotation symmetry filter to full view
+	inline
+	ras::Grid<float>
+	symRingGridFor
+		( ras::GridView<float> const & srcView
+			//!< Input intensity data (e.g. chip within larger image)
 		, std::size_t const & ringHalfSize
 			//!< Annular filter radius. \ref SymRing constructor
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		prb::Stats<float> const srcStats{ statsFor(srcView) };
+		ras::NullDistance const nullDist(srcView);
+		SymRing const symRing(srcView, srcStats, ringHalfSize, &nullDist);
+		return symRingGridFor(srcView, symRing, exec);
+	}
+
+	//! \brief Result applying SymRing rotation symmetry filter to full grid
+	inline
+	ras::Grid<float>
+	symRingGridFor
+		( ras::Grid<float> const & srcGrid
+			//!< Input intensity grid
+		, std::size_t const & ringHalfSize
+			//!< Annular filter radius. \ref SymRing constructor
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		return symRingGridFor
+			(ras::GridView<float>(srcGrid), ringHalfSize, exec);
+	}
+
+	/*! \brief Running (sliding window) minimum and maximum along a line.
+	 *
+	 * Uses the van Herk/Gil-Werman block prefix/suffix method so that
+	 * the cost is (about) three comparisons per value per extreme
+	 * independent of window size. Scratch buffers are retained for
+	 * reuse across calls (e.g. one instance per row band).
+	 */
+	class SlidingMinMax
+	{
+		//! Running min within each block, from block start
+		std::vector<float> theFwdMins{};
+		//! Running max within each block, from block start
+		std::vector<float> theFwdMaxs{};
+		//! Running min within each block, from block end
+		std::vector<float> theBwdMins{};
+		//! Running max within each block, from block end
+		std::vector<float> theBwdMaxs{};
+
+	public:
+
+		/*! \brief Extremes of windows [ndx-halfSize, ndx+halfSize].
+		 *
+		 * Values are read from srcBeg[ndx*srcStep] for ndx in [0,num).
+		 * Results are written to outMins[ndx] and outMaxs[ndx] for ndx
+		 * in [halfSize, num-halfSize) only. Null (NaN) source values
+		 * are ignored (a window with only nulls has min=+inf, max=-inf).
+		 */
+		inline
+		void
+		fill  // SlidingMinMax::
+			( float const * const & srcBeg
+				//!< Start of source values
+			, std::size_t const & num
+				//!< Number of source values
+			, std::ptrdiff_t const & srcStep
+				//!< Elements between successive source values
+			, std::size_t const & halfSize
+				//!< Window extends this many values each side
+			, float * const & outMins
+				//!< Window minimums (indexed same as source)
+			, float * const & outMaxs
+				//!< Window maximums (indexed same as source)
+			)
+		{
+			std::size_t const winSize{ 2u * halfSize + 1u };
+			if (winSize < (num + 1u))
+			{
+				theFwdMins.resize(num);
+				theFwdMaxs.resize(num);
+				theBwdMins.resize(num);
+				theBwdMaxs.resize(num);
+				constexpr float inf{ std::numeric_limits<float>::infinity() };
+
+				// forward (from start of each block) extremes
+				for (std::size_t ndx{0u} ; ndx < num ; ++ndx)
+				{
+					float const & val = srcBeg[(std::ptrdiff_t)ndx * srcStep];
+					bool const okay{ pix::isValid(val) };
+					float const valMin{ okay ? val : inf };
+					float const valMax{ okay ? val : -inf };
+					if (0u == (ndx % winSize))
+					{
+						theFwdMins[ndx] = valMin;
+						theFwdMaxs[ndx] = valMax;
+					}
+					else
+					{
+						theFwdMins[ndx] = std::min(theFwdMins[ndx-1u], valMin);
+						theFwdMaxs[ndx] = std::max(theFwdMaxs[ndx-1u], valMax);
+					}
+				}
+
+				// backward (from end of each block) extremes
+				for (std::size_t nn{0u} ; nn < num ; ++nn)
+				{
+					std::size_t const ndx{ num - 1u - nn };
+					float const & val = srcBeg[(std::ptrdiff_t)ndx * srcStep];
+					bool const okay{ pix::isValid(val) };
+					float const valMin{ okay ? val : inf };
+					float const valMax{ okay ? val : -inf };
+					bool const isBlockEnd
+						{  ((num - 1u) == ndx)
+						|| (0u == ((ndx + 1u) % winSize))
+						};
+					if (isBlockEnd)
+					{
+						theBwdMins[ndx] = valMin;
+						theBwdMaxs[ndx] = valMax;
+					}
+					else
+					{
+						theBwdMins[ndx] = std::min(theBwdMins[ndx+1u], valMin);
+						theBwdMaxs[ndx] = std::max(theBwdMaxs[ndx+1u], valMax);
+					}
+				}
+
+				// each window spans (at most) the end of one block and
+				// the start of the next
+				for (std::size_t ndx{halfSize} ; ndx < (num - halfSize) ; ++ndx)
+				{
+					std::size_t const ndxBeg{ ndx - halfSize };
+					std::size_t const ndxEnd{ ndx + halfSize };
+					outMins[ndx] = std::min
+						(theBwdMins[ndxBeg], theFwdMins[ndxEnd]);
+					outMaxs[ndx] = std::max
+						(theBwdMaxs[ndxBeg], theFwdMaxs[ndxEnd]);
+				}
+			}
+		}
+
+	}; // SlidingMinMax
+
+
+	//! Counts of cells evaluated and skipped by SymRing pre-screening.
+	struct ScreenStats
+	{
+		//! Number of cells (with full filter footprint) considered
+		std::size_t theNumCells{ 0u };
+		//! Number of cells for which full ring evaluation was skipped
+		std::size_t theNumSkipped{ 0u };
+
+		//! Fraction of considered cells that were skipped
+		inline
+		double
+		fractionSkipped  // ScreenStats::
+			() const
+		{
+			double frac{ std::numeric_limits<double>::quiet_NaN() };
+			if (0u < theNumCells)
+			{
+				frac = (double)theNumSkipped / (double)theNumCells;
+			}
+			return frac;
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString  // ScreenStats::
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss
+				<< "numCells: " << theNumCells
+				<< ' '
+				<< "numSkipped: " << theNumSkipped
+				<< ' '
+				<< "fractionSkipped: " << fractionSkipped()
+				;
+			return oss.str();
+		}
+
+	}; // ScreenStats
+
+	/*! \brief Mask of cells at which symRing response may be non-zero.
+	 *
+	 * Mask values are 1u for cells that need full ring evaluation and
+	 * 0u for cells at which the symRing response is known to be zero
+	 * (and for border cells where the filter does not fit).
+	 *
+	 * The test uses the min/max of source values over the square
+	 * (2*halfSize+1) bounding box of the ring (computed in one row
+	 * major sweep via SlidingMinMax along rows then blockwise prefix/
+	 * suffix extremes along columns). If all box
+	 * values are on one side of symRing.theSrcMidValue, then every
+	 * ring pair average is also on that side, the pos/neg balance
+	 * criterion fails and the response is exactly zero.
+	 *
+	 * Since the response is no larger than the ring range divided by
+	 * theSrcFullRange, cells with box range less than minResponse
+	 * times theSrcFullRange can also be skipped (if 0 < minResponse).
+	 * This is approximate (responses less than about minResponse are
+	 * treated as zero). With minResponse of zero the mask is exact.
+	 *
+	 * Cells with any null in the box are always marked for evaluation
+	 * (nulls are determined from symRing.thePtNullDist if present, else
+	 * from a NullDistance computed here).
+	 */
+	inline
+	ras::Grid<std::uint8_t>
+	symRingCandidateMask
+		( ras::GridView<float> const & srcView
+			//!< Input intensity data (same as used for symRing)
+		, SymRing const & symRing
+			//!< Annular symmetry filter to be screened
+		, float const & minResponse = 0.f
+			//!< Optionally skip cells with response certainly below this
+		, ScreenStats * const & ptStats = nullptr
+			//!< Optional: counts of cells considered and skipped
+		)
+	{
+		ras::Grid<std::uint8_t> mask(srcView.hwSize());
+		std::fill(mask.begin(), mask.end(), std::uint8_t{ 0u });
+
+		std::size_t const halfSize{ symRing.halfSize() };
+		std::size_t const fullSize{ symRing.fullSize() };
+		std::size_t const high{ srcView.high() };
+		std::size_t const wide{ srcView.wide() };
+		ScreenStats stats{};
+		if ((fullSize < high) && (fullSize < wide))
+		{
+			bool const srcOkay
+				{  engabra::g3::isValid(symRing.theSrcFullRange)
+				&& (0.f < symRing.theSrcFullRange)
+				};
+			double const midValue{ (double)symRing.theSrcMidValue };
+
+			// null distances (from symRing if available)
+			ras::NullDistance localNullDist{};
+			ras::NullDistance const * ptNullDist{ symRing.thePtNullDist };
+			if (! ptNullDist)
+			{
+				localNullDist = ras::NullDistance(srcView);
+				ptNullDist = &localNullDist;
+			}
+			double const minRange
+				{ (double)minResponse * (double)symRing.theSrcFullRange };
+
+			// Box extremes are computed in a single row major sweep:
+			// row direction extremes (one SlidingMinMax pass per row)
+			// are combined in the column direction with van Herk/Gil-
+			// Werman blocks of winSize rows. Only a few rows of
+			// intermediate values are kept (no full size grids).
+			std::size_t const winSize{ fullSize };
+			std::size_t const colBeg{ halfSize };
+			std::size_t const colEnd{ wide - halfSize };
+			std::size_t const numCols{ colEnd - colBeg };
+			SlidingMinMax slider{};
+			std::vector<float> rowMins(wide);
+			std::vector<float> rowMaxs(wide);
+			// prefix extremes from start of current block to current row
+			std::vector<float> fwdMins(numCols);
+			std::vector<float> fwdMaxs(numCols);
+			// row extremes of current block (become suffix extremes)
+			ras::Grid<float> currMins(winSize, numCols);
+			ras::Grid<float> currMaxs(winSize, numCols);
+			// suffix extremes (to end of block) for last completed block
+			ras::Grid<float> bwdMins(winSize, numCols);
+			ras::Grid<float> bwdMaxs(winSize, numCols);
+			for (std::size_t row{0u} ; row < high ; ++row)
+			{
+				slider.fill
+					( &(srcView(row, 0u)), wide, 1, halfSize
+					, rowMins.data(), rowMaxs.data()
+					);
+				float const * const rMins{ rowMins.data() + colBeg };
+				float const * const rMaxs{ rowMaxs.data() + colBeg };
+
+				// save row and update prefix extremes within block
+				std::size_t const ndxInBlk{ row % winSize };
+				std::copy_n(rMins, numCols, currMins.beginRow(ndxInBlk));
+				std::copy_n(rMaxs, numCols, currMaxs.beginRow(ndxInBlk));
+				if (0u == ndxInBlk)
+				{
+					std::copy_n(rMins, numCols, fwdMins.begin());
+					std::copy_n(rMaxs, numCols, fwdMaxs.begin());
+				}
+				else
+				{
+					for (std::size_t nc{0u} ; nc < numCols ; ++nc)
+					{
+						fwdMins[nc] = std::min(fwdMins[nc], rMins[nc]);
+						fwdMaxs[nc] = std::max(fwdMaxs[nc], rMaxs[nc]);
+					}
+				}
+
+				// at end of block, convert its rows to suffix extremes
+				if ((winSize - 1u) == ndxInBlk)
+				{
+					for (std::size_t nr{winSize - 1u} ; 0u < nr ; --nr)
+					{
+						float const * const nextMins{ currMins.beginRow(nr) };
+						float const * const nextMaxs{ currMaxs.beginRow(nr) };
+						float * const prevMins{ currMins.beginRow(nr - 1u) };
+						float * const prevMaxs{ currMaxs.beginRow(nr - 1u) };
+						for (std::size_t nc{0u} ; nc < numCols ; ++nc)
+						{
+							prevMins[nc] = std::min(prevMins[nc], nextMins[nc]);
+							prevMaxs[nc] = std::max(prevMaxs[nc], nextMaxs[nc]);
+						}
+					}
+					std::swap(currMins, bwdMins);
+					std::swap(currMaxs, bwdMaxs);
+				}
+
+				// box rows [rowA, row] are complete: screen center row
+				if (row + 1u < winSize)
+				{
+					continue;
+				}
+				std::size_t const rowA{ row + 1u - winSize };
+				std::size_t const rowOut{ rowA + halfSize };
+				float const * const aMins{ bwdMins.cbeginRow(rowA % winSize) };
+				float const * const aMaxs{ bwdMaxs.cbeginRow(rowA % winSize) };
+				for (std::size_t nc{0u} ; nc < numCols ; ++nc)
+				{
+					std::size_t const col{ colBeg + nc };
+					bool const allValid
+						{ ptNullDist->isWindowValid
+							(rowOut, col, halfSize, halfSize)
+						};
+					bool isCandidate{ true };
+					if (srcOkay && allValid)
+					{
+						double const boxMin
+							{ (double)std::min(aMins[nc], fwdMins[nc]) };
+						double const boxMax
+							{ (double)std::max(aMaxs[nc], fwdMaxs[nc]) };
+						bool const hasNeg{ boxMin < midValue };
+						bool const hasPos{ ! (boxMax < midValue) };
+						bool const canReach{ ! ((boxMax - boxMin) < minRange) };
+						isCandidate = (hasNeg && hasPos && canReach);
+					}
+					if (isCandidate)
+					{
+						mask(rowOut, col) = 1u;
+					}
+					else
+					{
+						++stats.theNumSkipped;
+					}
+					++stats.theNumCells;
+				}
+			}
+		}
+
+		if (ptStats)
+		{
+			*ptStats = stats;
+		}
+		return mask;
+	}
+
+	//! Evaluate symRing at candidateMask runs within row (others zero)
+	inline
+	void
+	fillMaskedRow
+		( SymRing const & symRing
+			//!< Annular symmetry filter
+		, ras::Grid<std::uint8_t> const & candidateMask
+			//!< Nonzero at cells to evaluate
+		, std::size_t const & row
+			//!< Row to evaluate
+		, std::size_t const & colBeg
+			//!< First column to evaluate
+		, std::size_t const & colEnd
+			//!< One past last column to evaluate
+		, float * const & outRow
+			//!< Output row (cell col is outRow[col])
+		, SymRing::RingScratch * const & ptScratch = nullptr
+			//!< Reusable work space (ref SymRing::fillRow())
+		, sys::cpu::SimdLevel const & level = sys::cpu::simdLevel()
+			//!< Most capable instruction set to use
+		)
+	{
+		std::size_t col{ colBeg };
+		while (col < colEnd)
+		{
+			std::size_t runEnd{ col };
+			while ((runEnd < colEnd) && (0u != candidateMask(row, runEnd)))
+			{
+				++runEnd;
+			}
+			if (col < runEnd)
+			{
+				symRing.fillRow
+					(row, col, runEnd, outRow + col, level, ptScratch);
+				col = runEnd;
+			}
+			else
+			{
+				outRow[col] = 0.f;
+				++col;
+			}
+		}
+	}
+
+	/*! \brief SymRing response evaluated only at candidateMask cells.
+	 *
+	 * Cells where candidateMask is zero are set to 0.f (border cells
+	 * where the filter does not fit are null as for symRingGridFor()).
+	 * With a mask from symRingCandidateMask() (and minResponse of
+	 * zero) the result is identical to symRingGridFor().
+	 */
+	inline
+	ras::Grid<float>
+	symRingGridFor
+		( ras::GridView<float> const & srcGrid
+			//!< Input intensity data (e.g. chip within larger image)
+		, SymRing const & symRing
+			//!< Annular symmetry filter
+		, ras::Grid<std::uint8_t> const & candidateMask
+			//!< Nonzero at cells to evaluate (ref symRingCandidateMask())
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
 		)
 	{
-		prb::Stats<float> const srcStats(srcGrid.cbegin(), srcGrid.cend());
-		SymRing const symRing(&srcGrid, srcStats, ringHalfSize);
-		return symRingGridFor(srcGrid, symRing);
+		ras::Grid<float> symGrid(srcGrid.hwSize());
+		std::fill(symGrid.begin(), symGrid.end(), pix::fNull);
+
+		std::size_t const halfSize{ symRing.halfSize() };
+		std::size_t const fullSize{ symRing.fullSize() };
+		bool const fits
+			{ (fullSize < srcGrid.high()) && (fullSize < srcGrid.wide()) };
+		if (fits && (candidateMask.hwSize() == srcGrid.hwSize()))
+		{
+			std::size_t const & colBeg = halfSize;
+			std::size_t const colEnd{ srcGrid.wide() - halfSize };
+			sys::cpu::SimdLevel const level{ sys::cpu::simdLevel() };
+			sys::forEachBand
+				( halfSize, (srcGrid.high() - halfSize), exec
+				, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+					{
+						// work space reused for all runs within this band
+						SymRing::RingScratch scratch{};
+						for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+						{
+							fillMaskedRow
+								(symRing, candidateMask, row, colBeg, colEnd
+								, &(symGrid(row, 0u)), &scratch, level
+								);
+						}
+					}
+				);
+		}
+
+		return symGrid;
+	}
+
+	/*! \brief symRingGridFor() with pre-screening (symRingCandidateMask()).
+	 *
+	 * Convenience combination of symRingCandidateMask() and the masked
+	 * symRingGridFor(). Statistics on the fraction of cells skipped are
+	 * returned via ptStats (if provided).
+	 */
+	inline
+	ras::Grid<float>
+	symRingScreenedGridFor
+		( ras::GridView<float> const & srcGrid
+			//!< Input intensity data (e.g. chip within larger image)
+		, SymRing const & symRing
+			//!< Annular symmetry filter
+		, float const & minResponse = 0.f
+			//!< Optionally skip cells with response certainly below this
+		, ScreenStats * const & ptStats = nullptr
+			//!< Optional: counts of cells considered and skipped
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		ras::Grid<std::uint8_t> const candidateMask
+			{ symRingCandidateMask(srcGrid, symRing, minResponse, ptStats) };
+		return symRingGridFor(srcGrid, symRing, candidateMask, exec);
+	}
+
+	/*! \brief Peaks of SymRing response (without a full response grid).
+	 *
+	 * Result is the same as (but with much less memory use and
+	 * traffic than) the two-step evaluation:
+	 * \code
+	 * ras::Grid<float> const symGrid{ symRingGridFor(srcView, symRing) };
+	 * AllPeaks2D::unsortedPeakRCVs(symGrid, minValue);
+	 * \endcode
+	 *
+	 * SymRing responses are computed (via SymRing::fillRow()) one row
+	 * at a time into a rolling window of three rows. Peaks within the
+	 * middle row are found (via AllPeaks2D::appendRowPeakRCVs()) as
+	 * soon as the next row is available. Peaks are returned in the
+	 * order encountered (i.e. in row major order).
+	 */
+	inline
+	std::vector<ras::PeakRCV>
+	symRingPeaksFor
+		( ras::GridView<float> const & srcView
+			//!< Input intensity data (e.g. chip within larger image)
+		, SymRing const & symRing
+			//!< Annular symmetry filter
+		, float const & minValue = std::numeric_limits<float>::epsilon()
+			//!< Ignore peaks not larger than this
+		)
+	{
+		std::vector<ras::PeakRCV> peakRCVs;
+		peakRCVs.reserve(4u*1024u);
+
+		std::size_t const high{ srcView.high() };
+		std::size_t const wide{ srcView.wide() };
+		std::size_t const halfSize{ symRing.halfSize() };
+		std::size_t const fullSize{ symRing.fullSize() };
+		if ((fullSize < high) && (fullSize < wide))
+		{
+			// rolling window of response rows (null outside filter area)
+			std::vector<float> rowBuf0(wide, pix::fNull);
+			std::vector<float> rowBuf1(wide, pix::fNull);
+			std::vector<float> rowBuf2(wide, pix::fNull);
+			float * ptPrev{ rowBuf0.data() };
+			float * ptCurr{ rowBuf1.data() };
+			float * ptNext{ rowBuf2.data() };
+
+			// rows in which filter responses are defined
+			std::size_t const & rowBeg = halfSize;
+			std::size_t const rowEnd{ high - halfSize };
+			std::size_t const & colBeg = halfSize;
+			std::size_t const colEnd{ wide - halfSize };
+
+			// peaks (valid values) can occur only in response rows
+			// (the row before rowBeg, if any, has all null values)
+			sys::cpu::SimdLevel const level{ sys::cpu::simdLevel() };
+			SymRing::RingScratch scratch{};
+			symRing.fillRow
+				(rowBeg, colBeg, colEnd, ptCurr + colBeg, level, &scratch);
+			for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+			{
+				std::size_t const nextRow{ row + 1u };
+				if (nextRow < rowEnd)
+				{
+					symRing.fillRow
+						( nextRow, colBeg, colEnd, ptNext + colBeg
+						, level, &scratch
+						);
+				}
+				else
+				{
+					std::fill(ptNext, ptNext + wide, pix::fNull);
+				}
+
+				// first and last grid rows are not considered for peaks
+				if ((0u < row) && (nextRow < high))
+				{
+					AllPeaks2D::appendRowPeakRCVs
+						( ptPrev, ptCurr, ptNext, wide, row, minValue
+						, &peakRCVs
+						);
+				}
+
+				// advance window (oldest buffer is reused for next row)
+				float * const ptOld{ ptPrev };
+				ptPrev = ptCurr;
+				ptCurr = ptNext;
+				ptNext = ptOld;
+			}
+		}
+
+		return peakRCVs;
 	}
 
 } // [ops]
@@ -667,5 +1748,17 @@ namespace
 		return ostrm;
 	}
 
+	//! Put instance to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::ops::ScreenStats const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
 } // [anon/global]
 
@@ -36,18 +36,26 @@
 #include "QuadLoco/imgEdgel.hpp"
 #include "QuadLoco/imgGrad.hpp"
 #include "QuadLoco/opsfilter.hpp"
+#include "QuadLoco/opsIntegralImage.hpp"
 #include "QuadLoco/rasChipSpec.hpp"
 #include "QuadLoco/rasgrid.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
 #include "QuadLoco/raskernel.hpp"
+#include "QuadLoco/rasNullDistance.hpp"
+#include "QuadLoco/rasPaddedGrid.hpp"
 #include "QuadLoco/rasRowCol.hpp"
+#include "QuadLoco/rassimd.hpp"
 #include "QuadLoco/rasSizeHW.hpp"
+#include "QuadLoco/sysThreadPool.hpp"
 
 #include <algorithm>
 #include <array>
+#include <cmath>
 #include <iterator>
 #include <limits>
 #include <numbers>
+#include <utility>
 #include <vector>
 
 
@@ -136,12 +144,71 @@ namespace grid
 	}
 
 
+	/*! \brief Evaluate numCols gradients along (interior) row of inGrid.
+	 *
+	 * Gradient values are computed (in float precision) for source
+	 * cells (row, colBeg) through (row, colBeg+numCols-1) using the
+	 * vectorized ras::simd::gradientRowBy8x() kernel. Results are
+	 * assigned to the numCols consecutive img::Grad cells at outBeg.
+	 *
+	 * The ptScratch buffer is resized as needed (reuse it across rows
+	 * to avoid repeated allocation).
+	 *
+	 * NOTE: This function *assumes* all cells (row+/-1, colBeg-1)
+	 * through (row+/-1, colBeg+numCols) are inside of inGrid.
+	 */
+	template <typename OutIter>
+	inline
+	void
+	fillGradientRowBy8x
+		( OutIter const & outBeg
+			//!< Start of output cells (e.g. grads.beginRow(...) + col)
+		, ras::Grid<float> const & inGrid
+			//!< Source values
+		, std::size_t const & row
+			//!< Source row for which to compute gradients
+		, std::size_t const & colBeg
+			//!< Source column of first gradient to compute
+		, std::size_t const & numCols
+			//!< Number of gradients to compute
+		, std::vector<float> * const & ptScratch
+			//!< Temporary space for row/col component values
+		)
+	{
+		std::vector<float> & scratch = *ptScratch;
+		if (scratch.size() < (2u * numCols))
+		{
+			scratch.resize(2u * numCols);
+		}
+		float * const gRows{ scratch.data() };
+		float * const gCols{ scratch.data() + numCols };
+
+		ras::simd::gradientRowBy8x
+			( &(inGrid(row - 1u, colBeg - 1u))
+			, &(inGrid(row, colBeg - 1u))
+			, &(inGrid(row + 1u, colBeg - 1u))
+			, numCols
+			, gRows
+			, gCols
+			);
+
+		OutIter outIter{ outBeg };
+		for (std::size_t ndx{0u} ; ndx < numCols ; ++ndx, ++outIter)
+		{
+			*outIter = img::Grad
+				{ static_cast<double>(gRows[ndx])
+				, static_cast<double>(gCols[ndx])
+				};
+		}
+	}
+
 	/*! \brief Compute img::Grad for each pixel within specified ranges.
 	 *
 	 * For each pixel within specified row/col ranges, a gradient value
-	 * is evaluated by calling responseGradientBy8x(). The results are
-	 * placed directly into an *externally allocated* output grid via
-	 * the pointer ptGrads.
+	 * equivalent to responseGradientBy8x() (but computed with float
+	 * precision) is evaluated one row at a time by fillGradientRowBy8x().
+	 * The results are placed directly into an *externally allocated*
+	 * output grid via the pointer ptGrads.
 	 *
 	 * NOTE: This function *assumes* the ChipSpec area is contained
 	 * \b entirely inside the source image.
@@ -152,6 +219,8 @@ namespace grid
 		( ras::Grid<img::Grad> * const & ptGrads
 		, ras::Grid<float> const & inGrid
 		, ras::ChipSpec const & chipSpec
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands (each with own scratch)
 		)
 	{
 		ras::Grid<img::Grad> & grads = *ptGrads;
@@ -159,31 +228,26 @@ namespace grid
 		std::size_t const rowNdxBeg{ chipSpec.srcRowBeg() };
 		std::size_t const rowNdxEnd{ chipSpec.srcRowEnd() };
 		std::size_t const colNdxBeg{ chipSpec.srcColBeg() };
-		std::size_t const colNdxEnd{ chipSpec.srcColEnd() };
+		std::size_t const numCols{ chipSpec.wide() };
 
-		for (std::size_t row{rowNdxBeg} ; row < rowNdxEnd ; ++row)
-		{
-			// specify the rows involved
-			std::size_t const rowT{ row - 1u };
-			std::size_t const & rowM = row;
-			std::size_t const rowB{ row + 1u };
-
-			for (std::size_t col{colNdxBeg} ; col < colNdxEnd ; ++col)
-			{
-				// specify the columns involved
-				std::size_t const colL{ col - 1u };
-				std::size_t const & colM = col;
-				std::size_t const colR{ col + 1u };
-
-				// evalate the gradient
-				grads(row,col)
-					= responseGradientBy8x
-						( inGrid
-						, rowT, rowM, rowB
-						, colL, colM, colR
-						);
-			}
-		}
+		sys::forEachBand
+			( rowNdxBeg, rowNdxEnd, exec
+			, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+				{
+					std::vector<float> scratch(2u * numCols);
+					for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+					{
+						fillGradientRowBy8x
+							( grads.beginRow(row) + colNdxBeg
+							, inGrid
+							, row
+							, colNdxBeg
+							, numCols
+							, &scratch
+							);
+					}
+				}
+			);
 	}
 
 	/*! \brief Gradient sub grid corresponding to ChipSpec from source Grid
@@ -205,13 +269,24 @@ namespace grid
 		ras::Grid<img::Grad> grads;
 		if (chipSpec.fitsInto(inGrid.hwSize()))
 		{
-			// allocate return structure
-			ras::Grid<img::Grad> tmpFull{ inGrid.hwSize() };
-			// no need to init (since unset values cropped away below)
-
-			// compute gradients
-			fillGradientBy8x(&tmpFull, inGrid, chipSpec);
-			grads = ras::grid::subGridValuesFrom<img::Grad>(tmpFull, chipSpec);
+			// allocate return structure (only chip size is needed)
+			grads = ras::Grid<img::Grad>(chipSpec.hwSize());
+
+			// compute gradients directly into chip cells
+			std::size_t const rowNdxBeg{ chipSpec.srcRowBeg() };
+			std::size_t const colNdxBeg{ chipSpec.srcColBeg() };
+			std::vector<float> scratch(2u * grads.wide());
+			for (std::size_t rowChip{0u} ; rowChip < grads.high() ; ++rowChip)
+			{
+				fillGradientRowBy8x
+					( grads.beginRow(rowChip)
+					, inGrid
+					, rowNdxBeg + rowChip
+					, colNdxBeg
+					, grads.wide()
+					, &scratch
+					);
+			}
 		}
 		return grads;
 	}
@@ -227,6 +302,8 @@ namespace grid
 	ras::Grid<img::Grad>
 	gradientGridBy8x
 		( ras::Grid<float> const & inGrid
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
 		)
 	{
 		ras::Grid<img::Grad> grads;
@@ -242,8 +319,7 @@ namespace grid
 
 			// set border to null values
 			static img::Grad const gNull{};
-			ras::grid::fillBorder
-				(grads.begin(), grads.hwSize(), stepHalf, gNull);
+			ras::grid::fillBorder(&grads, stepHalf, gNull);
 
 			//! determine start and end indices
 			ras::ChipSpec const chipSpec
@@ -258,13 +334,97 @@ namespace grid
 				};
 
 			// compute gradients
-			fillGradientBy8x(&grads, inGrid, chipSpec);
+			fillGradientBy8x(&grads, inGrid, chipSpec, exec);
 		}
 
 		return grads;
 	}
 
 
+	/*! \brief Compute img::Grad for every interior cell of padGrid.
+	 *
+	 * Edge cells of the interior are evaluated using values from the
+	 * apron (which must be at least 1 cell thick), so that, unlike
+	 * gradientGridBy8x(ras::Grid), the result has no null border. The
+	 * return grid has size padGrid.hwSize().
+	 */
+	inline
+	ras::Grid<img::Grad>
+	gradientGridBy8x
+		( ras::PaddedGrid<float> const & padGrid
+			//!< Source values (e.g. with ras::PadMode::Replicate apron)
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		ras::Grid<img::Grad> grads;
+		if (padGrid.isValid() && (0u < padGrid.padSize()))
+		{
+			grads = ras::Grid<img::Grad>(padGrid.hwSize());
+			std::size_t const pad{ padGrid.padSize() };
+			std::size_t const wide{ padGrid.wide() };
+			sys::forEachBand
+				( 0u, padGrid.high(), exec
+				, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+					{
+						std::vector<float> scratch(2u * wide);
+						for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+						{
+							fillGradientRowBy8x
+								( grads.beginRow(row)
+								, padGrid.fullGrid()
+								, row + pad
+								, pad
+								, wide
+								, &scratch
+								);
+						}
+					}
+				);
+		}
+		return grads;
+	}
+
+	//! Central difference gradients for gradientGridBy4x() row band.
+	inline
+	void
+	fillGradientRowsBy4x
+		( ras::Grid<img::Grad> * const & ptGrads
+			//!< Output grid (same size as inGrid)
+		, ras::Grid<float> const & inGrid
+			//!< Input data
+		, std::size_t const & stepHalf
+			//!< Half of step over which to evaluate differences
+		, std::size_t const & rowBeg
+			//!< First row to process (at least stepHalf)
+		, std::size_t const & rowEnd
+			//!< One past last row to process
+		, std::size_t const & colBeg
+			//!< First col to process (at least stepHalf)
+		, std::size_t const & colEnd
+			//!< One past last col to process
+		)
+	{
+		ras::Grid<img::Grad> & grads = *ptGrads;
+		float const scl{ 1.f / (float)(2u * stepHalf) };
+		for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+		{
+			std::size_t const rowM1{ row - stepHalf };
+			std::size_t const rowP1{ row + stepHalf };
+			for (std::size_t col{colBeg} ; col < colEnd ; ++col)
+			{
+				std::size_t const colM1{ col - stepHalf };
+				std::size_t const colP1{ col + stepHalf };
+				float const rowGrad
+					{ scl * (inGrid(rowP1, col) - inGrid(rowM1, col)) };
+				float const colGrad
+					{ scl * (inGrid(row, colP1) - inGrid(row, colM1)) };
+
+				grads(row,col) = img::Grad{ rowGrad, colGrad };
+			}
+		}
+	}
+
 	/*! \brief Compute img::Grad for each pixel location (except at edges).
 	 *
 	 * The stepHalf determine how wide an increment is used to estimate
@@ -291,6 +451,8 @@ namespace grid
 	gradientGridBy4x
 		( ras::Grid<float> const & inGrid
 		, std::size_t const & stepHalf = 1u
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
 		)
 	{
 		ras::Grid<img::Grad> grads;
@@ -311,26 +473,18 @@ namespace grid
 
 			// set border to null values
 			static img::Grad const gNull{};
-			ras::grid::fillBorder
-				(grads.begin(), grads.hwSize(), stepHalf, gNull);
+			ras::grid::fillBorder(&grads, stepHalf, gNull);
 
-			float const scl{ 1.f / (float)stepFull };
-			for (std::size_t row{rowNdxBeg} ; row < rowNdxEnd ; ++row)
-			{
-				std::size_t const rowM1{ row - stepHalf };
-				std::size_t const rowP1{ row + stepHalf };
-				for (std::size_t col{colNdxBeg} ; col < colNdxEnd ; ++col)
-				{
-					std::size_t const colM1{ col - stepHalf };
-					std::size_t const colP1{ col + stepHalf };
-					float const rowGrad
-						{ scl * (inGrid(rowP1, col) - inGrid(rowM1, col)) };
-					float const colGrad
-						{ scl * (inGrid(row, colP1) - inGrid(row, colM1)) };
-
-					grads(row,col) = img::Grad{ rowGrad, colGrad };
-				}
-			}
+			sys::forEachBand
+				( rowNdxBeg, rowNdxEnd, exec
+				, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+					{
+						fillGradientRowsBy4x
+							( &grads, inGrid, stepHalf
+							, rowBeg, rowEnd, colNdxBeg, colNdxEnd
+							);
+					}
+				);
 		}
 
 		return grads;
@@ -414,6 +568,61 @@ namespace grid
 
 	};
 
+	/*! \brief True if gradCenter is significant and supported by neighbors
+	 *
+	 * The neighbor gradients (the eight cells around gradCenter) are
+	 * summed and projected onto the direction of gradCenter. The result
+	 * (normalized to a full neighborhood and relative to the magnitude
+	 * of gradCenter) must exceed supportMultiplier.
+	 */
+	inline
+	bool
+	isHoodSupported
+		( img::Grad const & gradCenter
+			//!< Gradient at the cell being tested
+		, std::array<img::Grad const *, 8u> const & ptHoods
+			//!< Gradients at the eight neighbor cells
+		, double const & supportMultiplier
+			//!< Degree of support (1: self only, 2: one other, etc)
+		)
+	{
+		bool supported{ false };
+		if (gradCenter.isValid())
+		{
+			double const gMag{ magnitude(gradCenter) };
+			constexpr double tol
+				{ std::numeric_limits<double>::epsilon() };
+			if (tol < gMag)
+			{
+				img::Vector<double> hoodSum{ 0., 0. };
+				double count{ 0. };
+				for (img::Grad const * const & ptHood : ptHoods)
+				{
+					img::Grad const & hoodGrad = *ptHood;
+					if (isValid(hoodGrad))
+					{
+						hoodSum = hoodSum + hoodGrad;
+						count += 1.;
+					}
+				}
+
+				// check for at least one valid 8-neighbor
+				if (0. < count)
+				{
+					double const scl
+						{ (8./count) // normalize to full hood size
+						* (1./gMag) // unitize gradCenter in dot()
+						};
+					double const sumProj
+						{ scl * dot(hoodSum, gradCenter) };
+					double const hoodRatio{ sumProj / gMag };
+					supported = (supportMultiplier < hoodRatio);
+				}
+			}
+		}
+		return supported;
+	}
+
 	//! Collection edgels that have corroborating neighbors
 	inline
 	std::vector<img::Edgel>
@@ -430,10 +639,6 @@ namespace grid
 		{
 			pixEdgels.reserve(numElem);
 
-			// testing
-			Inside const inFull(gradGrid.hwSize(), 2u);
-			Inside const inEdge(gradGrid.hwSize(), 1u);
-
 			std::size_t const rowLast{ gradGrid.high() - 1u };
 			std::size_t const colLast{ gradGrid.wide() - 1u };
 
@@ -445,62 +650,121 @@ namespace grid
 				{
 					// gradient at center
 					img::Grad const & gradCenter = gradGrid(row, col);
-					if (gradCenter.isValid())
+					std::array<img::Grad const *, 8u> const ptHoods
+						{ &(gradGrid(row-1u, col-1u))
+						, &(gradGrid(row-1u, col   ))
+						, &(gradGrid(row-1u, col+1u))
+						, &(gradGrid(row   , col-1u))
+						//&(gradGrid(row   , col   ))
+						, &(gradGrid(row   , col+1u))
+						, &(gradGrid(row+1u, col-1u))
+						, &(gradGrid(row+1u, col   ))
+						, &(gradGrid(row+1u, col+1u))
+						};
+					if (isHoodSupported
+						(gradCenter, ptHoods, supportMultiplier))
 					{
-						double const gMag{ magnitude(gradCenter) };
-						constexpr double tol
-							{ std::numeric_limits<double>::epsilon() };
-						if (tol < gMag)
-						{
-							std::array<img::Grad const *, 8u> ptHoods
-								{ &(gradGrid(row-1u, col-1u))
-								, &(gradGrid(row-1u, col   ))
-								, &(gradGrid(row-1u, col+1u))
-								, &(gradGrid(row   , col-1u))
-								//&(gradGrid(row   , col   ))
-								, &(gradGrid(row   , col+1u))
-								, &(gradGrid(row+1u, col-1u))
-								, &(gradGrid(row+1u, col   ))
-								, &(gradGrid(row+1u, col+1u))
-								};
-							img::Vector<double> hoodSum{ 0., 0. };
-							double count{ 0. };
-							for (img::Grad const * const & ptHood : ptHoods)
-							{
-								img::Grad const & hoodGrad = *ptHood;
-								if (isValid(hoodGrad))
-								{
-									hoodSum = hoodSum + hoodGrad;
-									count += 1.;
-								}
-							}
+						// assured to be valid at this point since
+						// only processing non-trivial gradients
+						// i.e., tol < magnitude(gradCenter) above
+						img::Edgel const edgel
+							(img::Spot{ row, col }, gradCenter);
+						pixEdgels.push_back(edgel);
+					}
+				}
+			}
+		}
 
-							// check for at least one valid 8-neighbor
-							if (0. < count)
-							{
-								double const scl
-									{ (8./count) // normalize to full hood size
-									* (1./gMag) // unitize gradCenter in dot()
-									};
-								double const sumProj
-									{ scl * dot(hoodSum, gradCenter) };
-								double const hoodRatio{ sumProj / gMag };
-								if (supportMultiplier < hoodRatio)
-								{
-									// assured to be valid at this point since
-									// only processing non-trivial gradients
-									// i.e., tol < magnitude(gradCenter) above
-									img::Edgel const edgel
-										(img::Spot{ row, col }, gradCenter);
-									pixEdgels.push_back(edgel);
-								}
-							}
+		return pixEdgels;
+	}
+
+	/*! \brief Linked edgels computed directly from source pixels.
+	 *
+	 * Produces the same result as
+	 * \code
+	 * linkedEdgelsFrom(gradientGridBy8x(srcGrid), supportMultiplier)
+	 * \endcode
+	 * but without allocating a full gradient grid. Gradients are
+	 * computed one row at a time (by fillGradientRowBy8x()) into a
+	 * ring buffer of three rows, and edgels are emitted as soon as
+	 * the rows above and below a cell are available. Working memory is
+	 * therefore proportional to the width of srcGrid and the source is
+	 * traversed only once.
+	 *
+	 * \par Example
+	 * \snippet test/test_opsgrid.cpp DoxyExample07
+	 */
+	inline
+	std::vector<img::Edgel>
+	linkedEdgelsFrom
+		( ras::Grid<float> const & srcGrid
+			//!< Source pixels from which to compute gradients and edgels
+		, double const & supportMultiplier = 2.5
+			//!< Degree of support (1: self only, 2: one other, etc)
+		)
+	{
+		std::vector<img::Edgel> pixEdgels{};
+		std::size_t const high{ srcGrid.high() };
+		std::size_t const wide{ srcGrid.wide() };
+		// same size restriction as for gradientGridBy8x()
+		if ((2u < high) && (2u < wide))
+		{
+			// gradient rows (border cells remain null)
+			static img::Grad const gNull{};
+			std::array<std::vector<img::Grad>, 3u> gradRows
+				{ std::vector<img::Grad>(wide, gNull)
+				, std::vector<img::Grad>(wide, gNull)
+				, std::vector<img::Grad>(wide, gNull)
+				};
+			std::vector<float> scratch(2u * wide);
+
+			// fill ring buffer slot with gradients for source row
+			std::size_t const numCols{ wide - 2u };
+			std::size_t const rowLast{ high - 1u };
+			auto const fillGradRow
+				{ [&] (std::size_t const & gRow)
+					{
+						std::vector<img::Grad> & gradRow = gradRows[gRow % 3u];
+						if ((0u < gRow) && (gRow < rowLast))
+						{
+							fillGradientRowBy8x
+								( gradRow.begin() + 1u
+								, srcGrid, gRow, 1u, numCols, &scratch
+								);
+						}
+						else
+						{
+							std::fill(gradRow.begin(), gradRow.end(), gNull);
 						}
 					}
+				};
+
+			fillGradRow(0u);
+			fillGradRow(1u);
+			for (std::size_t row{1u} ; row < rowLast ; ++row)
+			{
+				fillGradRow(row + 1u);
+				img::Grad const * const ptT{ gradRows[(row-1u) % 3u].data() };
+				img::Grad const * const ptM{ gradRows[ row      % 3u].data() };
+				img::Grad const * const ptB{ gradRows[(row+1u) % 3u].data() };
+				for (std::size_t col{1u} ; col < (wide - 1u) ; ++col)
+				{
+					img::Grad const & gradCenter = ptM[col];
+					std::array<img::Grad const *, 8u> const ptHoods
+						{ ptT + col - 1u, ptT + col, ptT + col + 1u
+						, ptM + col - 1u,            ptM + col + 1u
+						, ptB + col - 1u, ptB + col, ptB + col + 1u
+						};
+					if (isHoodSupported
+						(gradCenter, ptHoods, supportMultiplier))
+					{
+						img::Edgel const edgel
+							(img::Spot{ row, col }, gradCenter);
+						pixEdgels.push_back(edgel);
+					}
 				}
 			}
 		}
-
 		return pixEdgels;
 	}
 
@@ -561,39 +825,217 @@ namespace grid
 		return grid;
 	}
 
-	/*! \brief Apply func within hwBox moving across srcGrid
+	//! Call boxFunc.consider() for each (compile-time) column in Cols
+	template <typename SrcType, typename BoxFunctor, std::size_t... Cols>
+	inline
+	void
+	considerFixedRow
+		( BoxFunctor & boxFunc
+		, SrcType const * const & inRowBeg
+			//!< Source value for first window column
+		, std::size_t const & wRow
+			//!< Row index within window
+		, std::index_sequence<Cols...>
+			//!< Column indices within window
+		)
+	{
+		(boxFunc.consider(inRowBeg[Cols], wRow, std::size_t{ Cols }), ...);
+	}
+
+	/*! \brief Call boxFunc.consider() for all cells in fixed size window
 	 *
-	 * A moving window, of size hwBox, moves across srcGrid. Every cell
-	 * in srcGrid is visted other than the first/last hwBox.{high,wide}()
-	 * rows/columns around the boarder (which are set to NaN in output).
+	 * The window size is known at compile time, and both loops are
+	 * expanded (fully unrolled) into a sequence of consider() calls
+	 * made in the same (row-major) order as for a runtime size window.
+	 */
+	template
+		< typename SrcType
+		, typename BoxFunctor
+		, std::size_t... Rows
+		, std::size_t... Cols
+		>
+	inline
+	void
+	considerFixedWindow
+		( BoxFunctor & boxFunc
+		, ras::GridView<SrcType> const & srcGrid
+		, std::size_t const & srcRow0
+			//!< Source row for first window row
+		, std::size_t const & srcCol0
+			//!< Source col for first window col
+		, std::index_sequence<Rows...>
+			//!< Row indices within window
+		, std::index_sequence<Cols...> const & cols
+			//!< Column indices within window
+		)
+	{
+		( considerFixedRow
+			( boxFunc
+			, &(srcGrid(srcRow0 + Rows, srcCol0))
+			, std::size_t{ Rows }
+			, cols
+			)
+		, ...
+		);
+	}
+
+	/*! \brief Evaluate functionResponse() for source rows [rowBeg,rowEnd)
 	 *
-	 * At each input cell in the source grid, boxFunc.reset() is called
-	 * to allow function to reset behavior based on the new current
-	 * source image cell values. Then boxFunc, is provided with assess to
-	 * srcGrid information (via a call to boxFunc.consider() for every
-	 * srcGrid cell in the hwBox window around current source cell. After
-	 * calling consider() for every cell in hwBox, the evaluation function,
-	 * boxFunc(), is called and the result is assigned to the output grid
-	 * cell (at the same row,col location as the srcGrid cell then
-	 * being evaluated).
+	 * The output grid must be allocated (and have null values set).
+	 * Rows must be within the active area (i.e. at least hwBox.high()/2
+	 * from the top and bottom of srcGrid).
 	 *
-	 * \note
-	 * boxFunc must provide the following methods:
-	 * \arg boxFunc{}; // default ctor
-	 * \arg boxFunc.reset(srcValue)
-	 * \arg boxFunc.consider(srcValue, boxRow, boxCol);
-	 * \arg boxFunc();
+	 * If FixHigh and FixWide are non-zero, they must match hwBox, and
+	 * the (null free) window evaluation is unrolled at compile time
+	 * (ref considerFixedWindow()).
+	 */
+	template
+		< typename OutType
+		, typename SrcType
+		, typename BoxFunctor
+		, std::size_t FixHigh = 0u
+		, std::size_t FixWide = 0u
+		>
+	inline
+	void
+	fillFunctionResponseRows
+		( ras::Grid<OutType> * const & ptOutGrid
+		, ras::GridView<SrcType> const & srcGrid
+		, ras::SizeHW const & hwBox
+		, ras::NullDistance const & nullDist
+			//!< Null distances for srcGrid
+		, BoxFunctor & boxFunc
+		, std::size_t const & rowBeg
+		, std::size_t const & rowEnd
+		)
+	{
+		ras::Grid<OutType> & outGrid = *ptOutGrid;
+		constexpr OutType nanOut{ std::numeric_limits<double>::quiet_NaN() };
+
+		int const halfHigh{ static_cast<int>(hwBox.high() / 2u) };
+		int const halfWide{ static_cast<int>(hwBox.wide() / 2u) };
+
+		int const wHigh{ (int)hwBox.high() };
+		int const wWide{ (int)hwBox.wide() };
+
+		// loop over (band of) active area of source/output grids
+		int const srcColEnd{ static_cast<int>(srcGrid.wide()) - halfWide };
+		for (int srcRow{(int)rowBeg} ; srcRow < (int)rowEnd ; ++srcRow)
+		{
+			int const srcRow0{ srcRow - halfHigh };
+			for (int srcCol{halfWide} ; srcCol < srcColEnd ; ++srcCol)
+			{
+				int const srcCol0{ srcCol - halfWide };
+
+				OutType outVal{ nanOut };
+
+				SrcType const & refVal = srcGrid(srcRow, srcCol);
+				if (nullDist.isWindowValid
+					( static_cast<std::size_t>(srcRow)
+					, static_cast<std::size_t>(srcCol)
+					, static_cast<std::size_t>(halfHigh)
+					, static_cast<std::size_t>(halfWide)
+					))
+				{
+					// fast path: no null checks needed within window
+					boxFunc.reset(refVal);
+					if constexpr ((0u < FixHigh) && (0u < FixWide))
+					{
+						considerFixedWindow
+							( boxFunc
+							, srcGrid
+							, static_cast<std::size_t>(srcRow0)
+							, static_cast<std::size_t>(srcCol0)
+							, std::make_index_sequence<FixHigh>{}
+							, std::make_index_sequence<FixWide>{}
+							);
+					}
+					else
+					{
+						for (int wRow{0} ; wRow < wHigh ; ++wRow)
+						{
+							SrcType const * const inRowBeg
+								{ &(srcGrid(srcRow0 + wRow, srcCol0)) };
+							for (int wCol{0} ; wCol < wWide ; ++wCol)
+							{
+								boxFunc.consider
+									( inRowBeg[wCol]
+									, static_cast<std::size_t>(wRow)
+									, static_cast<std::size_t>(wCol)
+									);
+							}
+						}
+					}
+					outVal = boxFunc();
+				}
+				else
+				if (engabra::g3::isValid(refVal))
+				{
+					// slow path: (near nulls) check each window value
+					boxFunc.reset(refVal);
+
+					// integrate values over weighted window
+					for (int wRow{0} ; wRow < wHigh ; ++wRow)
+					{
+						int const inRow{ srcRow0 + wRow };
+						for (int wCol{0} ; wCol < wWide ; ++wCol)
+						{
+							int const inCol{ srcCol0 + wCol };
+
+							// have functor consider this value
+							SrcType const & srcVal = srcGrid(inRow, inCol);
+							if (engabra::g3::isValid(srcVal))
+							{
+								boxFunc.consider
+									( srcVal
+									, static_cast<std::size_t>(wRow)
+									, static_cast<std::size_t>(wCol)
+									);
+							}
+							else
+							{
+								// upon encountering a null,
+								// abandon entire window/box processing
+								goto NextWindow;
+							}
+						}
+					}
+
+					outVal = boxFunc();
+				}
+				NextWindow:
+
+				// update evolving return storage
+				outGrid(srcRow, srcCol) = outVal;
+			}
+		}
+	}
+
+	/*! \brief Implementation of functionResponse() (all overloads)
 	 *
-	 * Example
-	 * \snippet opsfilter.hpp DoxyExampleBoxFunc
+	 * Window size hwBox must match FixHigh,FixWide if these are nonzero
+	 * (in which case the window evaluation is unrolled), or if both are
+	 * zero, the window size is determined by hwBox at runtime.
+	 *
+	 * The nullDist must be that of srcGrid (e.g. NullDistance(srcGrid)).
 	 */
-	template <typename OutType, typename SrcType, typename BoxFunctor>
+	template
+		< typename OutType
+		, typename SrcType
+		, typename BoxFunctor
+		, std::size_t FixHigh
+		, std::size_t FixWide
+		>
 	inline
 	ras::Grid<OutType>
-	functionResponse
-		( ras::Grid<SrcType> const & srcGrid
+	functionResponseFor
+		( ras::GridView<SrcType> const & srcGrid
 		, ras::SizeHW const & hwBox
+		, ras::NullDistance const & nullDist
+			//!< Null distances for srcGrid
 		, BoxFunctor & boxFunc
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands (with boxFunc copies)
 		)
 	{
 		ras::Grid<OutType> outGrid;
@@ -607,6 +1049,7 @@ namespace grid
 		  && isOdd(hwBox.wide())
 		  && ((hwBox.high() + 1u) < srcGrid.high())
 		  && ((hwBox.wide() + 1u) < srcGrid.wide())
+		  && (nullDist.hwSize() == srcGrid.hwSize())
 		   )
 		{
 			outGrid = ras::Grid<OutType>(srcGrid.hwSize());
@@ -615,107 +1058,942 @@ namespace grid
 			// TBD - maybe change to set explicitly only the edge values
 			std::fill(outGrid.begin(), outGrid.end(), nanOut);
 
-			int const halfHigh{ static_cast<int>(hwBox.high() / 2u) };
-			int const halfWide{ static_cast<int>(hwBox.wide() / 2u) };
-
-			int const wHigh{ (int)hwBox.high() };
-			int const wWide{ (int)hwBox.wide() };
-
-			// loop over active area of source/output grids
-			int const srcRowEnd{ static_cast<int>(srcGrid.high()) - halfHigh };
-			int const srcColEnd{ static_cast<int>(srcGrid.wide()) - halfWide };
-			for (int srcRow{halfHigh} ; srcRow < srcRowEnd ; ++srcRow)
+			// active rows of source/output grids
+			std::size_t const rowBeg{ hwBox.high() / 2u };
+			std::size_t const rowEnd{ srcGrid.high() - rowBeg };
+			if (sys::Exec::Parallel == exec)
 			{
-				int const srcRow0{ srcRow - halfHigh };
-				for (int srcCol{halfWide} ; srcCol < srcColEnd ; ++srcCol)
-				{
-					int const srcCol0{ srcCol - halfWide };
-
-					OutType outVal{ nanOut };
-
-					// reset filter to new source position
-					SrcType const & refVal = srcGrid(srcRow, srcCol);
-					if (engabra::g3::isValid(refVal))
-					{
-						boxFunc.reset(refVal);
-
-						// integrate values over weighted window
-						for (int wRow{0} ; wRow < wHigh ; ++wRow)
+				sys::forEachBand
+					( rowBeg, rowEnd, exec
+					, [&] (std::size_t const & beg, std::size_t const & end)
 						{
-							int const inRow{ srcRow0 + wRow };
-							for (int wCol{0} ; wCol < wWide ; ++wCol)
-							{
-								int const inCol{ srcCol0 + wCol };
-
-								// have functor consider this value
-								SrcType const & srcVal = srcGrid(inRow, inCol);
-								if (engabra::g3::isValid(srcVal))
-								{
-									boxFunc.consider
-										( srcVal
-										, static_cast<std::size_t>(wRow)
-										, static_cast<std::size_t>(wCol)
-										);
-								}
-								else
-								{
-									// upon encountering a null,
-									// abandon entire window/box processing
-									goto NextWindow;
-								}
-							}
+							BoxFunctor bandFunc{ boxFunc };
+							fillFunctionResponseRows
+								<OutType, SrcType, BoxFunctor, FixHigh, FixWide>
+								( &outGrid, srcGrid, hwBox, nullDist
+								, bandFunc, beg, end
+								);
 						}
-
-						outVal = boxFunc();
-					}
-					NextWindow:
-
-					// update evolving return storage
-					outGrid(srcRow, srcCol) = outVal;
-				}
+					);
+			}
+			else
+			{
+				fillFunctionResponseRows
+					<OutType, SrcType, BoxFunctor, FixHigh, FixWide>
+					( &outGrid, srcGrid, hwBox, nullDist
+					, boxFunc, rowBeg, rowEnd
+					);
 			}
 		} // good inputs
 
 		return outGrid;
 	}
 
-	//! \brief Result of running filter window over srcGrid.
-	template <typename OutType, typename SrcType>
-	inline
-	ras::Grid<OutType>
-	filtered
-		( ras::Grid<SrcType> const & srcGrid
-		, ras::Grid<OutType> const & filter
-		)
-	{
-		ops::filter::WeightedSum<OutType, SrcType> bFunc{ &filter };
-		return functionResponse
-			<OutType, SrcType>
-			(srcGrid, filter.hwSize(), bFunc);
-	}
-
-	//! \brief Result of a sum-square difference filter
-	template <typename OutType, typename SrcType>
-	inline
-	ras::Grid<OutType>
-	smoothGridFor
-		( ras::Grid<SrcType> const & srcGrid
-			//!< Input data
-		, std::size_t const & halfSize
-			//!< Halfsize for moving window
-		, double const & sigma
-			//!< Standard deviation of Gaussian to use for smoothing
-		)
-	{
-		ras::Grid<OutType> const filter
-			{ ras::kernel::gauss<OutType>(halfSize, sigma) };
-		ops::filter::WeightedSum<OutType, SrcType> bFunc{ &filter };
-		return functionResponse
+	/*! \brief Apply func within hwBox moving across srcGrid
+	 *
+	 * A moving window, of size hwBox, moves across srcGrid. Every cell
+	 * in srcGrid is visted other than the first/last hwBox.{high,wide}()
+	 * rows/columns around the boarder (which are set to NaN in output).
+	 *
+	 * At each input cell in the source grid, boxFunc.reset() is called
+	 * to allow function to reset behavior based on the new current
+	 * source image cell values. Then boxFunc, is provided with assess to
+	 * srcGrid information (via a call to boxFunc.consider() for every
+	 * srcGrid cell in the hwBox window around current source cell. After
+	 * calling consider() for every cell in hwBox, the evaluation function,
+	 * boxFunc(), is called and the result is assigned to the output grid
+	 * cell (at the same row,col location as the srcGrid cell then
+	 * being evaluated).
+	 *
+	 * \note
+	 * boxFunc must provide the following methods:
+	 * \arg boxFunc{}; // default ctor
+	 * \arg boxFunc.reset(srcValue)
+	 * \arg boxFunc.consider(srcValue, boxRow, boxCol);
+	 * \arg boxFunc();
+	 *
+	 * For sys::Exec::Parallel, rows are processed in bands on separate
+	 * threads, each band with its own copy of boxFunc (which therefore
+	 * must also be copy constructible). Results are identical to those
+	 * of serial execution.
+	 *
+	 * Common small windows (3x3 and 5x5) are evaluated with loops
+	 * expanded at compile time. Other sizes use runtime loops (or,
+	 * if known at compile time, use the overload with High, Wide
+	 * template parameters).
+	 *
+	 * The srcGrid may be a view into a larger raster (e.g. a chip area
+	 * from ras::GridView::subViewFor()) in which case the output grid
+	 * has the size of the view.
+	 *
+	 * Where windows are free of nulls is determined from nullDist,
+	 * which must be that of srcGrid. Callers applying several filters
+	 * to the same source can construct one ras::NullDistance and share
+	 * it across calls (the overload without nullDist computes it anew
+	 * on each call).
+	 *
+	 * Example
+	 * \snippet opsfilter.hpp DoxyExampleBoxFunc
+	 */
+	template <typename OutType, typename SrcType, typename BoxFunctor>
+	inline
+	ras::Grid<OutType>
+	functionResponse
+		( ras::GridView<SrcType> const & srcGrid
+		, ras::SizeHW const & hwBox
+		, ras::NullDistance const & nullDist
+			//!< Null distances for srcGrid (e.g. NullDistance(srcGrid))
+		, BoxFunctor & boxFunc
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands (with boxFunc copies)
+		)
+	{
+		ras::Grid<OutType> outGrid;
+		// common (small) window sizes use compile-time specializations
+		if ((3u == hwBox.high()) && (3u == hwBox.wide()))
+		{
+			outGrid = functionResponseFor
+				<OutType, SrcType, BoxFunctor, 3u, 3u>
+				(srcGrid, hwBox, nullDist, boxFunc, exec);
+		}
+		else
+		if ((5u == hwBox.high()) && (5u == hwBox.wide()))
+		{
+			outGrid = functionResponseFor
+				<OutType, SrcType, BoxFunctor, 5u, 5u>
+				(srcGrid, hwBox, nullDist, boxFunc, exec);
+		}
+		else
+		{
+			outGrid = functionResponseFor
+				<OutType, SrcType, BoxFunctor, 0u, 0u>
+				(srcGrid, hwBox, nullDist, boxFunc, exec);
+		}
+		return outGrid;
+	}
+
+	//! \brief Apply func within hwBox moving across srcGrid (own nullDist)
+	template <typename OutType, typename SrcType, typename BoxFunctor>
+	inline
+	ras::Grid<OutType>
+	functionResponse
+		( ras::GridView<SrcType> const & srcGrid
+		, ras::SizeHW const & hwBox
+		, BoxFunctor & boxFunc
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands (with boxFunc copies)
+		)
+	{
+		ras::NullDistance const nullDist(srcGrid);
+		return functionResponse<OutType, SrcType, BoxFunctor>
+			(srcGrid, hwBox, nullDist, boxFunc, exec);
+	}
+
+	/*! \brief Apply func within (compile-time) High x Wide window
+	 *
+	 * Same as functionResponse() with hwBox{ High, Wide }, but with
+	 * window evaluation unrolled for any size. E.g.
+	 * \code
+	 * functionResponse<float, float, 7u, 7u>(srcView, boxFunc);
+	 * \endcode
+	 */
+	template
+		< typename OutType
+		, typename SrcType
+		, std::size_t High
+		, std::size_t Wide
+		, typename BoxFunctor
+		>
+	inline
+	ras::Grid<OutType>
+	functionResponse
+		( ras::GridView<SrcType> const & srcGrid
+		, BoxFunctor & boxFunc
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands (with boxFunc copies)
+		)
+	{
+		static_assert((1u == (High % 2u)) && (1u == (Wide % 2u)));
+		ras::NullDistance const nullDist(srcGrid);
+		return functionResponseFor
+			<OutType, SrcType, BoxFunctor, High, Wide>
+			(srcGrid, ras::SizeHW{ High, Wide }, nullDist, boxFunc, exec);
+	}
+
+	//! \brief Apply func within (compile-time) window across srcGrid
+	template
+		< typename OutType
+		, typename SrcType
+		, std::size_t High
+		, std::size_t Wide
+		, typename BoxFunctor
+		>
+	inline
+	ras::Grid<OutType>
+	functionResponse
+		( ras::Grid<SrcType> const & srcGrid
+		, BoxFunctor & boxFunc
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands (with boxFunc copies)
+		)
+	{
+		return functionResponse<OutType, SrcType, High, Wide, BoxFunctor>
+			(ras::GridView<SrcType>(srcGrid), boxFunc, exec);
+	}
+
+	//! \brief Apply func within hwBox moving across (all of) srcGrid
+	template <typename OutType, typename SrcType, typename BoxFunctor>
+	inline
+	ras::Grid<OutType>
+	functionResponse
+		( ras::Grid<SrcType> const & srcGrid
+		, ras::SizeHW const & hwBox
+		, BoxFunctor & boxFunc
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands (with boxFunc copies)
+		)
+	{
+		return functionResponse<OutType, SrcType, BoxFunctor>
+			(ras::GridView<SrcType>(srcGrid), hwBox, boxFunc, exec);
+	}
+
+	/*! \brief Apply func within hwBox moving across (interior of) padGrid
+	 *
+	 * Windows centered on interior edge cells use values from the apron
+	 * (which must be at least half of hwBox thick). The result has size
+	 * padGrid.hwSize() and (for ras::PadMode::Replicate or Mirror) has
+	 * no null border. Otherwise, same as functionResponse(GridView).
+	 */
+	template <typename OutType, typename SrcType, typename BoxFunctor>
+	inline
+	ras::Grid<OutType>
+	functionResponse
+		( ras::PaddedGrid<SrcType> const & padGrid
+		, ras::SizeHW const & hwBox
+		, BoxFunctor & boxFunc
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands (with boxFunc copies)
+		)
+	{
+		ras::Grid<OutType> outGrid;
+		std::size_t const margin{ std::max(hwBox.high(), hwBox.wide()) / 2u };
+		ras::GridView<SrcType> const outerView
+			{ padGrid.viewWithMargin(margin) };
+		if (outerView.isValid())
+		{
+			// evaluate over interior plus margin, then keep interior
+			ras::Grid<OutType> const outerGrid
+				{ functionResponse<OutType, SrcType, BoxFunctor>
+					(outerView, hwBox, boxFunc, exec)
+				};
+			ras::ChipSpec const interior
+				{ ras::RowCol{ margin, margin }, padGrid.hwSize() };
+			outGrid = ras::grid::gridCopyOf<OutType>
+				(ras::GridView<OutType>(outerGrid).subViewFor(interior));
+		}
+		return outGrid;
+	}
+
+	//! \brief Result of running filter window over srcGrid (shared nullDist)
+	template <typename OutType, typename SrcType>
+	inline
+	ras::Grid<OutType>
+	filtered
+		( ras::Grid<SrcType> const & srcGrid
+		, ras::NullDistance const & nullDist
+			//!< Null distances for srcGrid (e.g. NullDistance(srcGrid))
+		, ras::Grid<OutType> const & filter
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		ops::filter::WeightedSum<OutType, SrcType> bFunc{ &filter };
+		return functionResponse
 			<OutType, SrcType>
-			(srcGrid, filter.hwSize(), bFunc);
+			( ras::GridView<SrcType>(srcGrid), filter.hwSize(), nullDist
+			, bFunc, exec
+			);
+	}
+
+	//! \brief Result of running filter window over srcGrid.
+	template <typename OutType, typename SrcType>
+	inline
+	ras::Grid<OutType>
+	filtered
+		( ras::Grid<SrcType> const & srcGrid
+		, ras::Grid<OutType> const & filter
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		ras::NullDistance const nullDist(srcGrid);
+		return filtered<OutType, SrcType>(srcGrid, nullDist, filter, exec);
+	}
+
+	//! Algorithm options for smoothGridFor()
+	enum class SmoothMethod
+	{
+		  Direct //!< Full 2D kernel, O(k^2) per cell, null if any null
+		, Separable //!< Row then column passes, O(k) per cell, null-aware
+		, Recursive //!< Recursive (IIR) approximation, O(1) per cell
+	};
+
+	//! Row pass of smoothGridSeparable() for rows in [rowBeg, rowEnd)
+	template <typename SrcType>
+	inline
+	void
+	fillSeparableRowSums
+		( ras::Grid<double> * const & ptRowSums
+			//!< Weighted sums along each row (for cols within border)
+		, ras::Grid<double> * const & ptRowWgts
+			//!< Sum of weights contributing to each ptRowSums value
+		, ras::Grid<SrcType> const & srcGrid
+			//!< Input data
+		, std::vector<double> const & wgts
+			//!< 1D kernel weights (ref ras::kernel::gaussWeights())
+		, std::size_t const & rowBeg
+			//!< First row to process
+		, std::size_t const & rowEnd
+			//!< One past last row to process
+		)
+	{
+		std::size_t const fullSize{ wgts.size() };
+		std::size_t const halfSize{ fullSize / 2u };
+		std::size_t const colEnd{ srcGrid.wide() - halfSize };
+		for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+		{
+			for (std::size_t col{halfSize} ; col < colEnd ; ++col)
+			{
+				std::size_t const col0{ col - halfSize };
+				double sum{ 0. };
+				double sumWgt{ 0. };
+				for (std::size_t kk{0u} ; kk < fullSize ; ++kk)
+				{
+					SrcType const & srcVal = srcGrid(row, col0 + kk);
+					if (engabra::g3::isValid(srcVal))
+					{
+						sum += wgts[kk] * static_cast<double>(srcVal);
+						sumWgt += wgts[kk];
+					}
+				}
+				(*ptRowSums)(row, col) = sum;
+				(*ptRowWgts)(row, col) = sumWgt;
+			}
+		}
+	}
+
+	//! Column pass of smoothGridSeparable() for rows in [rowBeg, rowEnd)
+	template <typename OutType, typename SrcType>
+	inline
+	void
+	fillSeparableColSums
+		( ras::Grid<OutType> * const & ptOutGrid
+			//!< Output (normalized) smoothed values
+		, ras::Grid<SrcType> const & srcGrid
+			//!< Input data (to propagate null cells)
+		, ras::Grid<double> const & rowSums
+			//!< Result of fillSeparableRowSums()
+		, ras::Grid<double> const & rowWgts
+			//!< Result of fillSeparableRowSums()
+		, std::vector<double> const & wgts
+			//!< 1D kernel weights (ref ras::kernel::gaussWeights())
+		, std::size_t const & rowBeg
+			//!< First row to process (at least halfSize)
+		, std::size_t const & rowEnd
+			//!< One past last row to process
+		)
+	{
+		std::size_t const fullSize{ wgts.size() };
+		std::size_t const halfSize{ fullSize / 2u };
+		std::size_t const wide{ srcGrid.wide() };
+		std::size_t const colEnd{ wide - halfSize };
+		// accumulate (full) rows, then normalize
+		std::vector<double> accSums(wide);
+		std::vector<double> accWgts(wide);
+		for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+		{
+			std::fill(accSums.begin(), accSums.end(), 0.);
+			std::fill(accWgts.begin(), accWgts.end(), 0.);
+			std::size_t const row0{ row - halfSize };
+			for (std::size_t kk{0u} ; kk < fullSize ; ++kk)
+			{
+				double const & wgt = wgts[kk];
+				for (std::size_t col{halfSize} ; col < colEnd ; ++col)
+				{
+					accSums[col] += wgt * rowSums(row0 + kk, col);
+					accWgts[col] += wgt * rowWgts(row0 + kk, col);
+				}
+			}
+			for (std::size_t col{halfSize} ; col < colEnd ; ++col)
+			{
+				if ( engabra::g3::isValid(srcGrid(row, col))
+				  && (0. < accWgts[col])
+				   )
+				{
+					(*ptOutGrid)(row, col) = static_cast<OutType>
+						(accSums[col] / accWgts[col]);
+				}
+			}
+		}
+	}
+
+	/*! \brief Gaussian smoothing by separate row and column passes.
+	 *
+	 * Uses the same (separable) kernel as ras::kernel::gauss(), i.e.
+	 * proportional to exp(-r^2/sigma) so that the standard deviation
+	 * is sqrt(sigma/2) (not sigma itself). Null
+	 * source values are excluded and the remaining weights renormalized
+	 * (i.e. result is weighted average of the valid values in window).
+	 * Output cells are null within halfSize of the border or if the
+	 * corresponding source cell is null.
+	 */
+	template <typename OutType, typename SrcType>
+	inline
+	ras::Grid<OutType>
+	smoothGridSeparable
+		( ras::Grid<SrcType> const & srcGrid
+			//!< Input data
+		, std::size_t const & halfSize
+			//!< Halfsize for moving window
+		, double const & sigma
+			//!< Kernel exp(-r^2/sigma) parameter (stdDev is sqrt(sigma/2))
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		ras::Grid<OutType> outGrid;
+		std::size_t const fullSize{ 2u * halfSize + 1u };
+		if ( srcGrid.isValid()
+		  && ((fullSize + 1u) < srcGrid.high())
+		  && ((fullSize + 1u) < srcGrid.wide())
+		   )
+		{
+			std::size_t const high{ srcGrid.high() };
+			std::vector<double> const wgts
+				{ ras::kernel::gaussWeights<double>(halfSize, sigma) };
+
+			// row pass: weighted sums (and sum of weights) of valid values
+			ras::Grid<double> rowSums(srcGrid.hwSize());
+			ras::Grid<double> rowWgts(srcGrid.hwSize());
+			sys::forEachBand
+				( 0u, high, exec
+				, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+					{
+						fillSeparableRowSums<SrcType>
+							(&rowSums, &rowWgts, srcGrid, wgts, rowBeg, rowEnd);
+					}
+				);
+
+			// column pass: accumulate (full) rows, then normalize
+			outGrid = ras::Grid<OutType>(srcGrid.hwSize());
+			constexpr OutType nanOut
+				{ std::numeric_limits<OutType>::quiet_NaN() };
+			std::fill(outGrid.begin(), outGrid.end(), nanOut);
+			sys::forEachBand
+				( halfSize, (high - halfSize), exec
+				, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+					{
+						fillSeparableColSums<OutType, SrcType>
+							( &outGrid, srcGrid, rowSums, rowWgts, wgts
+							, rowBeg, rowEnd
+							);
+					}
+				);
+		}
+		return outGrid;
+	}
+
+	/*! \brief Coefficients {B, b1/b0, b2/b0, b3/b0} for recursive Gaussian.
+	 *
+	 * Filter form from: I.T. Young, L.J. van Vliet, "Recursive
+	 * implementation of the Gaussian filter", Signal Processing 44
+	 * (1995) 139-151. Rather than the paper's closed form for parameter
+	 * q (which yields a response about 10% wider than requested), q is
+	 * found by bisection such that the combined causal/anti-causal
+	 * impulse response has variance equal to stdDev^2.
+	 */
+	inline
+	std::array<double, 4u>
+	recursiveGaussCoefficients
+		( double const & stdDev
+			//!< Standard deviation of Gaussian to approximate
+		)
+	{
+		// coefficients as function of parameter q
+		auto const coefsFor
+			{ [] (double const & qq)
+				{
+					double const q2{ qq * qq };
+					double const q3{ q2 * qq };
+					double const b0
+						{ 1.57825 + 2.44413*qq + 1.4281*q2 + .422205*q3 };
+					double const b1{ 2.44413*qq + 2.85619*q2 + 1.26661*q3 };
+					double const b2{ -(1.4281*q2 + 1.26661*q3) };
+					double const b3{ .422205*q3 };
+					return std::array<double, 4u>
+						{ 1. - (b1 + b2 + b3) / b0
+						, b1 / b0
+						, b2 / b0
+						, b3 / b0
+						};
+				}
+			};
+
+		// variance of (forward then backward) impulse response
+		auto const varianceFor
+			{ [] (std::array<double, 4u> const & coefs)
+				{
+					double const & bb = coefs[0];
+					double const mean
+						{ (1.*coefs[1] + 2.*coefs[2] + 3.*coefs[3]) / bb };
+					double const fact2
+						{ (2.*coefs[2] + 6.*coefs[3]) / bb };
+					return (2. * (fact2 + mean + mean*mean));
+				}
+			};
+
+		// variance increases monotonically with q (zero at q == 0)
+		double const varExp{ stdDev * stdDev };
+		double qLo{ 0. };
+		double qHi{ stdDev + 1. };
+		for (std::size_t iter{0u} ; iter < 64u ; ++iter)
+		{
+			double const qMid{ .5 * (qLo + qHi) };
+			if (varianceFor(coefsFor(qMid)) < varExp)
+			{
+				qLo = qMid;
+			}
+			else
+			{
+				qHi = qMid;
+			}
+		}
+		return coefsFor(.5 * (qLo + qHi));
+	}
+
+	/*! \brief Apply causal and anti-causal recursive passes along rows.
+	 *
+	 * Values beyond the ends of each row are taken as replicas of
+	 * the end values (for which the filter response is steady state).
+	 */
+	inline
+	void
+	recursiveGaussRows
+		( ras::Grid<double> * const & ptGrid
+		, std::array<double, 4u> const & coefs
+			//!< From recursiveGaussCoefficients()
+		, std::size_t const & rowBeg
+			//!< First row to process
+		, std::size_t const & rowEnd
+			//!< One past last row to process
+		)
+	{
+		ras::Grid<double> & grid = *ptGrid;
+		double const & bb = coefs[0];
+		double const & a1 = coefs[1];
+		double const & a2 = coefs[2];
+		double const & a3 = coefs[3];
+		std::size_t const wide{ grid.wide() };
+		for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+		{
+			double * const line{ &(grid(row, 0u)) };
+
+			// causal (forward) pass
+			double w1{ line[0] };
+			double w2{ w1 };
+			double w3{ w1 };
+			for (std::size_t nn{0u} ; nn < wide ; ++nn)
+			{
+				double const ww{ bb * line[nn] + a1*w1 + a2*w2 + a3*w3 };
+				line[nn] = ww;
+				w3 = w2;
+				w2 = w1;
+				w1 = ww;
+			}
+
+			// anti-causal (backward) pass
+			w1 = line[wide - 1u];
+			w2 = w1;
+			w3 = w1;
+			for (std::size_t nn{wide} ; 0u < nn ; --nn)
+			{
+				double & val = line[nn - 1u];
+				double const ww{ bb * val + a1*w1 + a2*w2 + a3*w3 };
+				val = ww;
+				w3 = w2;
+				w2 = w1;
+				w1 = ww;
+			}
+		}
+	}
+
+	/*! \brief Apply causal and anti-causal recursive passes along columns.
+	 *
+	 * Processes the strip of columns [colBeg, colEnd) together (one row
+	 * at a time) for memory locality. End values are replicated as for
+	 * recursiveGaussRows().
+	 */
+	inline
+	void
+	recursiveGaussCols
+		( ras::Grid<double> * const & ptGrid
+		, std::array<double, 4u> const & coefs
+			//!< From recursiveGaussCoefficients()
+		, std::size_t const & colBeg
+			//!< First column to process
+		, std::size_t const & colEnd
+			//!< One past last column to process
+		)
+	{
+		ras::Grid<double> & grid = *ptGrid;
+		double const & bb = coefs[0];
+		double const & a1 = coefs[1];
+		double const & a2 = coefs[2];
+		double const & a3 = coefs[3];
+		std::size_t const high{ grid.high() };
+		std::size_t const numCols{ colEnd - colBeg };
+
+		// causal (forward) pass
+		std::vector<double> const rowFirst
+			{ &(grid(0u, colBeg)), &(grid(0u, colBeg)) + numCols };
+		for (std::size_t row{0u} ; row < high ; ++row)
+		{
+			double * const curr{ &(grid(row, colBeg)) };
+			double const * const prev1
+				{ (0u < row) ? &(grid(row - 1u, colBeg)) : rowFirst.data() };
+			double const * const prev2
+				{ (1u < row) ? &(grid(row - 2u, colBeg)) : rowFirst.data() };
+			double const * const prev3
+				{ (2u < row) ? &(grid(row - 3u, colBeg)) : rowFirst.data() };
+			for (std::size_t nn{0u} ; nn < numCols ; ++nn)
+			{
+				curr[nn] = bb * curr[nn]
+					+ a1*prev1[nn] + a2*prev2[nn] + a3*prev3[nn];
+			}
+		}
+
+		// anti-causal (backward) pass
+		double const * const endBeg{ &(grid(high - 1u, colBeg)) };
+		std::vector<double> const rowLast{ endBeg, endBeg + numCols };
+		for (std::size_t row{high} ; 0u < row ; --row)
+		{
+			std::size_t const rr{ row - 1u };
+			double * const curr{ &(grid(rr, colBeg)) };
+			double const * const next1{ (rr + 1u < high)
+				? &(grid(rr + 1u, colBeg)) : rowLast.data() };
+			double const * const next2{ (rr + 2u < high)
+				? &(grid(rr + 2u, colBeg)) : rowLast.data() };
+			double const * const next3{ (rr + 3u < high)
+				? &(grid(rr + 3u, colBeg)) : rowLast.data() };
+			for (std::size_t nn{0u} ; nn < numCols ; ++nn)
+			{
+				curr[nn] = bb * curr[nn]
+					+ a1*next1[nn] + a2*next2[nn] + a3*next3[nn];
+			}
+		}
 	}
 
-	//! \brief Result of a sum-square difference filter
+	/*! \brief Gaussian smoothing by recursive (IIR) filter approximation.
+	 *
+	 * Cost per cell is independent of sigma, so this is attractive for
+	 * large sigma values. The Gaussian parameter sigma has the same
+	 * meaning as for ras::kernel::gauss() (i.e. kernel proportional to
+	 * exp(-r^2/sigma), so that standard deviation is sqrt(sigma/2)).
+	 *
+	 * Null source values are handled by normalized convolution (the
+	 * validity mask is filtered along with the data). The halfSize only
+	 * defines the border within which output cells are null (for
+	 * consistency with the other methods). Output cells are also null
+	 * where the corresponding source cell is null.
+	 */
+	template <typename OutType, typename SrcType>
+	inline
+	ras::Grid<OutType>
+	smoothGridRecursive
+		( ras::Grid<SrcType> const & srcGrid
+			//!< Input data
+		, std::size_t const & halfSize
+			//!< Halfsize of (null) border
+		, double const & sigma
+			//!< Kernel exp(-r^2/sigma) parameter (stdDev is sqrt(sigma/2))
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands and column strips
+		)
+	{
+		ras::Grid<OutType> outGrid;
+		std::size_t const fullSize{ 2u * halfSize + 1u };
+		if ( srcGrid.isValid()
+		  && ((fullSize + 1u) < srcGrid.high())
+		  && ((fullSize + 1u) < srcGrid.wide())
+		   )
+		{
+			// split source into (zero filled) data and validity mask
+			ras::Grid<double> dataGrid(srcGrid.hwSize());
+			ras::Grid<double> maskGrid(srcGrid.hwSize());
+			for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+			{
+				for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+				{
+					SrcType const & srcVal = srcGrid(row, col);
+					bool const okay{ engabra::g3::isValid(srcVal) };
+					dataGrid(row, col)
+						= okay ? static_cast<double>(srcVal) : 0.;
+					maskGrid(row, col) = okay ? 1. : 0.;
+				}
+			}
+
+			// filter both
+			double const stdDev{ std::sqrt(.5 * sigma) };
+			std::array<double, 4u> const coefs
+				{ recursiveGaussCoefficients(stdDev) };
+			sys::forEachBand
+				( 0u, srcGrid.high(), exec
+				, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+					{
+						recursiveGaussRows(&dataGrid, coefs, rowBeg, rowEnd);
+						recursiveGaussRows(&maskGrid, coefs, rowBeg, rowEnd);
+					}
+				);
+			sys::forEachBand
+				( 0u, srcGrid.wide(), exec
+				, [&] (std::size_t const & colBeg, std::size_t const & colEnd)
+					{
+						recursiveGaussCols(&dataGrid, coefs, colBeg, colEnd);
+						recursiveGaussCols(&maskGrid, coefs, colBeg, colEnd);
+					}
+				);
+
+			// normalize by (filtered) validity
+			outGrid = ras::Grid<OutType>(srcGrid.hwSize());
+			constexpr OutType nanOut
+				{ std::numeric_limits<OutType>::quiet_NaN() };
+			std::fill(outGrid.begin(), outGrid.end(), nanOut);
+			std::size_t const rowEnd{ srcGrid.high() - halfSize };
+			std::size_t const colEnd{ srcGrid.wide() - halfSize };
+			for (std::size_t row{halfSize} ; row < rowEnd ; ++row)
+			{
+				for (std::size_t col{halfSize} ; col < colEnd ; ++col)
+				{
+					double const & mask = maskGrid(row, col);
+					if ( engabra::g3::isValid(srcGrid(row, col))
+					  && (0. < mask)
+					   )
+					{
+						outGrid(row, col) = static_cast<OutType>
+							(dataGrid(row, col) / mask);
+					}
+				}
+			}
+		}
+		return outGrid;
+	}
+
+	/*! \brief Gaussian smoothed version of srcGrid.
+	 *
+	 * All methods use the ras::kernel::gauss() form of sigma (kernel
+	 * proportional to exp(-r^2/sigma), standard deviation sqrt(sigma/2)).
+	 *
+	 * The method determines the algorithm used:
+	 * \arg Direct: Full 2D ras::kernel::gauss() window. Any null value
+	 * within the window results in a null output cell.
+	 * \arg Separable: Same kernel applied as row and column passes
+	 * (ref smoothGridSeparable()). Nulls are skipped (renormalized).
+	 * \arg Recursive: IIR approximation (ref smoothGridRecursive())
+	 * with cost independent of kernel size. Suitable for large sigma
+	 * (uses Separable if standard deviation, sqrt(sigma/2), is < 0.5).
+	 *
+	 * For data without nulls, Direct and Separable agree to within
+	 * numeric roundoff.
+	 *
+	 * The nullDist (that of srcGrid) is used only by the Direct method
+	 * and may be shared across calls smoothing the same source.
+	 */
+	template <typename OutType, typename SrcType>
+	inline
+	ras::Grid<OutType>
+	smoothGridFor
+		( ras::Grid<SrcType> const & srcGrid
+			//!< Input data
+		, ras::NullDistance const & nullDist
+			//!< Null distances for srcGrid (used for SmoothMethod::Direct)
+		, std::size_t const & halfSize
+			//!< Halfsize for moving window
+		, double const & sigma
+			//!< Kernel exp(-r^2/sigma) parameter (stdDev is sqrt(sigma/2))
+		, SmoothMethod const & method = SmoothMethod::Direct
+			//!< Algorithm with which to compute smoothed result
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel (result is same either way)
+		)
+	{
+		ras::Grid<OutType> outGrid;
+		if (SmoothMethod::Separable == method)
+		{
+			outGrid = smoothGridSeparable<OutType, SrcType>
+				(srcGrid, halfSize, sigma, exec);
+		}
+		else
+		if (SmoothMethod::Recursive == method)
+		{
+			if (! (std::sqrt(.5 * sigma) < .5))
+			{
+				outGrid = smoothGridRecursive<OutType, SrcType>
+					(srcGrid, halfSize, sigma, exec);
+			}
+			else
+			{
+				outGrid = smoothGridSeparable<OutType, SrcType>
+					(srcGrid, halfSize, sigma, exec);
+			}
+		}
+		else
+		{
+			ras::Grid<OutType> const filter
+				{ ras::kernel::gauss<OutType>(halfSize, sigma) };
+			outGrid = filtered<OutType, SrcType>
+				(srcGrid, nullDist, filter, exec);
+		}
+		return outGrid;
+	}
+
+	//! \brief Gaussian smoothed version of srcGrid (own nullDist if Direct)
+	template <typename OutType, typename SrcType>
+	inline
+	ras::Grid<OutType>
+	smoothGridFor
+		( ras::Grid<SrcType> const & srcGrid
+			//!< Input data
+		, std::size_t const & halfSize
+			//!< Halfsize for moving window
+		, double const & sigma
+			//!< Kernel exp(-r^2/sigma) parameter (stdDev is sqrt(sigma/2))
+		, SmoothMethod const & method = SmoothMethod::Direct
+			//!< Algorithm with which to compute smoothed result
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel (result is same either way)
+		)
+	{
+		ras::NullDistance nullDist{};
+		if (SmoothMethod::Direct == method)
+		{
+			nullDist = ras::NullDistance(srcGrid);
+		}
+		return smoothGridFor<OutType, SrcType>
+			(srcGrid, nullDist, halfSize, sigma, method, exec);
+	}
+
+	//! Evaluate integralResponse() for rows in [rowBeg, rowEnd)
+	template <typename OutType, typename SrcType, typename BoxStat>
+	inline
+	void
+	fillIntegralResponseRows
+		( ras::Grid<OutType> * const & ptOutGrid
+			//!< Output grid (same size as srcGrid)
+		, ras::Grid<SrcType> const & srcGrid
+			//!< Input data
+		, ops::IntegralImage const & integral
+			//!< Integral image of srcGrid
+		, ras::SizeHW const & hwBox
+			//!< Size of moving window
+		, BoxStat const & boxStat
+			//!< Statistic to evaluate from integral image over window
+		, std::size_t const & rowBeg
+			//!< First row to process (at least hwBox.high()/2)
+		, std::size_t const & rowEnd
+			//!< One past last row to process
+		)
+	{
+		std::size_t const halfHigh{ hwBox.high() / 2u };
+		std::size_t const halfWide{ hwBox.wide() / 2u };
+		std::size_t const colEnd{ srcGrid.wide() - halfWide };
+		for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+		{
+			for (std::size_t col{halfWide} ; col < colEnd ; ++col)
+			{
+				SrcType const & srcVal = srcGrid(row, col);
+				if (engabra::g3::isValid(srcVal))
+				{
+					ras::ChipSpec const box
+						{ ras::RowCol{ row - halfHigh, col - halfWide }
+						, hwBox
+						};
+					(*ptOutGrid)(row, col) = static_cast<OutType>
+						(boxStat(integral, box, (double)srcVal));
+				}
+			}
+		}
+	}
+
+	/*! \brief Box statistic evaluated (in O(1) per cell) across srcGrid.
+	 *
+	 * The boxStat function is called for each cell with a valid source
+	 * value for which the hwBox window (centered on the cell) fits inside
+	 * srcGrid. Its signature is:
+	 * \code
+	 * double boxStat
+	 *     ( ops::IntegralImage const & integral
+	 *     , ras::ChipSpec const & box // window centered on cell
+	 *     , double const & srcValue // value at center cell
+	 *     );
+	 * \endcode
+	 * The returned value (which may be null) is stored into the output.
+	 * Requirements on hwBox (odd sizes, etc.) and nulls in the output
+	 * border are the same as for functionResponse().
+	 */
+	template <typename OutType, typename SrcType, typename BoxStat>
+	inline
+	ras::Grid<OutType>
+	integralResponse
+		( ras::Grid<SrcType> const & srcGrid
+			//!< Input data
+		, ras::SizeHW const & hwBox
+			//!< Size of moving window
+		, BoxStat const & boxStat
+			//!< Statistic to evaluate from integral image over window
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		ras::Grid<OutType> outGrid;
+		if ( srcGrid.isValid()
+		  && hwBox.isValid()
+		  && (1u == (hwBox.high() % 2u))
+		  && (1u == (hwBox.wide() % 2u))
+		  && ((hwBox.high() + 1u) < srcGrid.high())
+		  && ((hwBox.wide() + 1u) < srcGrid.wide())
+		   )
+		{
+			ops::IntegralImage const integral(srcGrid);
+
+			outGrid = ras::Grid<OutType>(srcGrid.hwSize());
+			constexpr OutType nanOut
+				{ std::numeric_limits<OutType>::quiet_NaN() };
+			std::fill(outGrid.begin(), outGrid.end(), nanOut);
+
+			std::size_t const halfHigh{ hwBox.high() / 2u };
+			sys::forEachBand
+				( halfHigh, (srcGrid.high() - halfHigh), exec
+				, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+					{
+						fillIntegralResponseRows<OutType, SrcType>
+							( &outGrid, srcGrid, integral, hwBox, boxStat
+							, rowBeg, rowEnd
+							);
+					}
+				);
+		}
+		return outGrid;
+	}
+
+	/*! \brief Result of a sum-square difference filter
+	 *
+	 * Sum over the window of squared differences from the center value.
+	 * Evaluated in O(1) per cell via ops::IntegralImage::sumSqDiff()
+	 * (which expands about local tile references, so precision does
+	 * not degrade with large source values or offsets). As with the
+	 * (brute force) filter::SumSquareDiff, output is null wherever the
+	 * window contains any null value.
+	 */
 	template <typename OutType, typename SrcType>
 	inline
 	ras::Grid<OutType>
@@ -724,12 +2002,88 @@ namespace grid
 			//!< Input data
 		, ras::SizeHW const & hwBox
 			//!< Size of moving window
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
 		)
 	{
-		ops::filter::SumSquareDiff<OutType> bFunc{};
-		return functionResponse
-			<OutType, SrcType>
-			(srcGrid, hwBox, bFunc);
+		return integralResponse<OutType, SrcType>
+			( srcGrid
+			, hwBox
+			, [] ( ops::IntegralImage const & integral
+				 , ras::ChipSpec const & box
+				 , double const & ref
+				 )
+				{
+					double ssd{ std::numeric_limits<double>::quiet_NaN() };
+					if (integral.isFull(box))
+					{
+						ssd = integral.sumSqDiff(box, ref);
+					}
+					return ssd;
+				}
+			, exec
+			);
+	}
+
+	/*! \brief Mean of (valid) values within hwBox around each cell.
+	 *
+	 * Null values in the window are ignored. Output is null where the
+	 * source cell is null (or near border as for functionResponse()).
+	 */
+	template <typename OutType, typename SrcType>
+	inline
+	ras::Grid<OutType>
+	boxMeanGridFor
+		( ras::Grid<SrcType> const & srcGrid
+			//!< Input data
+		, ras::SizeHW const & hwBox
+			//!< Size of moving window
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		return integralResponse<OutType, SrcType>
+			( srcGrid
+			, hwBox
+			, [] ( ops::IntegralImage const & integral
+				 , ras::ChipSpec const & box
+				 , double const & // ref
+				 )
+				{ return integral.mean(box); }
+			, exec
+			);
+	}
+
+	/*! \brief Variance of (valid) values within hwBox around each cell.
+	 *
+	 * Null values in the window are ignored. Output is null where the
+	 * source cell is null (or near border as for functionResponse()).
+	 *
+	 * Small values indicate flat (featureless) regions - e.g. useful
+	 * to skip areas that cannot contain a quad target center.
+	 */
+	template <typename OutType, typename SrcType>
+	inline
+	ras::Grid<OutType>
+	localVarianceGridFor
+		( ras::Grid<SrcType> const & srcGrid
+			//!< Input data
+		, ras::SizeHW const & hwBox
+			//!< Size of moving window
+		, sys::Exec const & exec = sys::Exec::Serial
+			//!< Serial, or Parallel in row bands
+		)
+	{
+		return integralResponse<OutType, SrcType>
+			( srcGrid
+			, hwBox
+			, [] ( ops::IntegralImage const & integral
+				 , ras::ChipSpec const & box
+				 , double const & // ref
+				 )
+				{ return integral.variance(box); }
+			, exec
+			);
 	}
 
 
@@ -35,10 +35,15 @@
 #include "QuadLoco/rasChipSpec.hpp"
 #include "QuadLoco/rasgrid.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
 #include "QuadLoco/raskernel.hpp"
+#include "QuadLoco/rasNullDistance.hpp"
+#include "QuadLoco/rasPaddedGrid.hpp"
 #include "QuadLoco/rasPeakRCV.hpp"
+#include "QuadLoco/rasPyramid.hpp"
 #include "QuadLoco/rasRelRC.hpp"
 #include "QuadLoco/rasRowCol.hpp"
+#include "QuadLoco/rassimd.hpp"
 #include "QuadLoco/rasSizeHW.hpp"
 
 
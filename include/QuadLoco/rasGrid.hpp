@@ -35,7 +35,13 @@
 #include "QuadLoco/rasRowCol.hpp"
 #include "QuadLoco/rasSizeHW.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <new>
+#include <numeric>
 #include <string>
 
 // implementation
@@ -48,11 +54,103 @@ namespace quadloco
 
 namespace ras
 {
+	/*! \brief Memory layout options for ras::Grid data storage.
+	 *
+	 * The default layout (all members zero) stores rows contiguously
+	 * with natural alignment - i.e. the classic dense row major layout.
+	 *
+	 * A non-zero theAlignBytes value requests that the data buffer, and
+	 * the start of every row, be aligned to that many bytes (e.g. 32
+	 * or 64 for SIMD processing). Rows are padded at the end as needed
+	 * to maintain this alignment which also means that full width
+	 * (aligned) vector loads starting inside a row remain within the
+	 * allocated storage for that row (i.e. a "tail-safe" remainder).
+	 * Values that are not a power of two are rounded up to the next
+	 * power of two (as required for aligned allocation). For element
+	 * sizes that do not divide the alignment (e.g. 24 byte img::Grad),
+	 * the pitch is a multiple of lcm(alignment, element size) bytes so
+	 * that every row start remains aligned.
+	 *
+	 * A non-zero theMinRowPitch value specifies the minimum number of
+	 * elements between the start of successive rows. The actual pitch
+	 * is the larger of this value and the grid width, rounded up to
+	 * satisfy any alignment request.
+	 */
+	struct GridLayout
+	{
+		//! Byte alignment for data and each row (0: natural alignment)
+		std::size_t theAlignBytes{ 0u };
+
+		//! Minimum elements from start of one row to next (0: grid wide)
+		std::size_t theMinRowPitch{ 0u };
+
+		//! Layout with rows aligned to alignBytes (e.g. for SIMD loads)
+		inline
+		static
+		GridLayout
+		aligned
+			( std::size_t const & alignBytes = 64u
+			)
+		{
+			return GridLayout{ alignBytes, 0u };
+		}
+
+		//! Alignment in effect: theAlignBytes rounded up to a power of two
+		inline
+		std::size_t
+		alignBytes
+			() const
+		{
+			std::size_t align{ 0u };
+			if (0u < theAlignBytes)
+			{
+				align = 1u;
+				while (align < theAlignBytes)
+				{
+					align <<= 1u;
+				}
+			}
+			return align;
+		}
+
+		//! Number of elements between rows for a grid wide cells wide
+		template <typename Type>
+		inline
+		std::size_t
+		rowPitchFor
+			( std::size_t const & wide
+			) const
+		{
+			std::size_t pitch{ std::max(wide, theMinRowPitch) };
+			constexpr std::size_t elemSize{ sizeof(Type) };
+			std::size_t const align{ alignBytes() };
+			if (0u < align)
+			{
+				// smallest element count spanning a whole number of aligns
+				std::size_t const perAlign
+					{ std::lcm(align, elemSize) / elemSize };
+				pitch = ((pitch + perAlign - 1u) / perAlign) * perAlign;
+			}
+			return pitch;
+		}
+
+	}; // GridLayout
+
+
 	/*! \brief Holds typed data in layout with row/cols.
 
 	Data values are stored in row major order.
 	Iterations proceed as (0, 0), (0, 1), (0, 2) etc. (along rows)
 
+	By default rows are stored contiguously. If constructed with a
+	GridLayout that requests alignment and/or a larger row pitch, then
+	each row is followed by (value initialized) pad cells. The row
+	iterators (e.g. beginRow()/endRow()) and operator()(row,col) visit
+	only grid cells for any layout. The full extent iterators (e.g.
+	begin()/end()) always span exactly the size() grid cells and are
+	therefore only available for contiguous grids (ref isContiguous()).
+	Padded grids must be traversed one row at a time.
+
 	\par Example
 	\snippet test/test_rasGrid.cpp DoxyExample01
 	*/
@@ -61,8 +159,36 @@ namespace ras
 	{
 		std::size_t theHigh{ 0u }; //!< Height of buffer
 		std::size_t theWide{ 0u }; //!< Width of buffer
+		std::size_t thePitch{ 0u }; //!< Elements from row start to next
+		std::size_t theAlign{ 0u }; //!< Alignment of allocation [bytes]
 		Type * theData{ nullptr }; //!< data buffer pointer
 
+		//! Allocation alignment to use for theData
+		inline
+		static
+		std::align_val_t
+		allocAlignFor
+			( std::size_t const & alignBytes
+			)
+		{
+			return std::align_val_t{ std::max(alignBytes, alignof(Type)) };
+		}
+
+		//! Release theData resources (if any)
+		inline
+		void
+		release
+			()
+		{
+			if (theData)
+			{
+				std::size_t const numStore{ theHigh * thePitch };
+				std::destroy_n(theData, numStore);
+				::operator delete[](theData, allocAlignFor(theAlign));
+				theData = nullptr;
+			}
+		}
+
 	public: // typedef
 
 		//! Data type for values of individual cells within grid.
@@ -96,7 +222,7 @@ namespace ras
 			return {};
 		}
 
-		//! Return a (deep) copy of original
+		//! Return a (deep) copy of original (with same layout)
 		inline
 		static
 		Grid<Type>
@@ -104,10 +230,10 @@ namespace ras
 			( Grid<Type> const & orig
 			)
 		{
-			Grid<Type> copy{ orig.hwSize() };
+			Grid<Type> copy{ orig.hwSize(), orig.layout() };
 			std::copy
-				( orig.cbegin(), orig.cend()
-				, copy.begin()
+				( orig.theData, orig.theData + orig.storageSize()
+				, copy.theData
 				);
 			return copy;
 		}
@@ -124,14 +250,33 @@ namespace ras
 		explicit
 		Grid
 			( SizeHW const & hwSize
+			, GridLayout const & layout = {}
+				//!< Storage alignment and row pitch options
 			)
 			: theHigh{ hwSize.high() }
 			, theWide{ hwSize.wide() }
+			, thePitch{ layout.rowPitchFor<Type>(hwSize.wide()) }
+			, theAlign{ layout.alignBytes() }
 			, theData{ nullptr }
 		{
 			if (0 < theHigh && 0 < theWide)
 			{
-				theData = new Type[theHigh * theWide];
+				std::size_t const numStore{ theHigh * thePitch };
+				void * const ptMem
+					{ ::operator new[]
+						(numStore * sizeof(Type), allocAlignFor(theAlign))
+					};
+				theData = static_cast<Type *>(ptMem);
+				std::uninitialized_default_construct_n(theData, numStore);
+				// pad cells (if any) are given definite values
+				if (thePitch != theWide)
+				{
+					for (std::size_t row{0u} ; row < theHigh ; ++row)
+					{
+						Type * const padBeg{ endRow(row) };
+						std::fill(padBeg, beginRow(row) + thePitch, Type{});
+					}
+				}
 			}
 		}
 
@@ -154,6 +299,8 @@ namespace ras
 		{
 			std::swap(theHigh, orig.theHigh);
 			std::swap(theWide, orig.theWide);
+			std::swap(thePitch, orig.thePitch);
+			std::swap(theAlign, orig.theAlign);
 			std::swap(theData, orig.theData);
 		}
 
@@ -168,6 +315,8 @@ namespace ras
 			{
 				std::swap(theHigh, rhs.theHigh);
 				std::swap(theWide, rhs.theWide);
+				std::swap(thePitch, rhs.thePitch);
+				std::swap(theAlign, rhs.theAlign);
 				std::swap(theData, rhs.theData);
 			}
 			return *this;
@@ -180,10 +329,11 @@ namespace ras
 		{
 			if (theData)
 			{
-				delete [] theData;
+				release();
 				theHigh = 0u;
 				theWide = 0u;
-				theData = nullptr;
+				thePitch = 0u;
+				theAlign = 0u;
 			}
 		}
 
@@ -232,13 +382,49 @@ namespace ras
 			return hwSize().size();
 		}
 
-		//! Number of bytes consumed by data = ((size()*sizeof(Type))
+		//! Number of elements between start of one row and the next
+		inline
+		std::size_t
+		rowPitch
+			() const
+		{
+			return thePitch;
+		}
+
+		//! Number of storage cells (including pad cells) = high()*rowPitch()
+		inline
+		std::size_t
+		storageSize
+			() const
+		{
+			return (theHigh * thePitch);
+		}
+
+		//! True if rows are stored without padding (i.e. rowPitch()==wide())
+		inline
+		bool
+		isContiguous
+			() const
+		{
+			return (thePitch == theWide);
+		}
+
+		//! Layout options with which this instance was allocated
+		inline
+		GridLayout
+		layout
+			() const
+		{
+			return GridLayout{ theAlign, thePitch };
+		}
+
+		//! Number of bytes consumed by data = ((storageSize()*sizeof(Type))
 		inline
 		size_t
 		byteSize
 			() const
 		{
-			return hwSize().size() * sizeof(Type);
+			return storageSize() * sizeof(Type);
 		}
 
 		//! Constant reference to specified element
@@ -249,7 +435,7 @@ namespace ras
 			, size_t const & col
 			) const
 		{
-			return *(theData + row * theWide + col);
+			return *(theData + row * thePitch + col);
 		}
 
 		//! Mutuable reference to specified element
@@ -260,7 +446,7 @@ namespace ras
 			, size_t const & col
 			)
 		{
-			return *(theData + row * theWide + col);
+			return *(theData + row * thePitch + col);
 		}
 
 		//! Constant reference to specified element
@@ -283,40 +469,44 @@ namespace ras
 			return operator()(rowcol.row(), rowcol.col());
 		}
 
-		//! Iterator to start of read only data
+		//! Iterator to start of read only data (contiguous grids only)
 		inline
 		const_iterator
 		cbegin
 			() const
 		{
+			assert(isContiguous()); // padded grids: use cbeginRow()
 			return theData;
 		}
 
-		//! Iterator to end of read only data
+		//! Iterator to end of read only data (contiguous grids only)
 		inline
 		const_iterator
 		cend
 			() const
 		{
-			return theData + hwSize().size();
+			assert(isContiguous()); // padded grids: use cendRow()
+			return theData + size();
 		}
 
-		//! Iterator to start of mutable data
+		//! Iterator to start of mutable data (contiguous grids only)
 		inline
 		iterator
 		begin
 			()
 		{
+			assert(isContiguous()); // padded grids: use beginRow()
 			return theData;
 		}
 
-		//! Iterator to end of mutable data
+		//! Iterator to end of mutable data (contiguous grids only)
 		inline
 		iterator
 		end
 			()
 		{
-			return theData + hwSize().size();
+			assert(isContiguous()); // padded grids: use endRow()
+			return theData + size();
 		}
 
 		//! Reverse-direction iterator to start of read only data
@@ -325,7 +515,7 @@ namespace ras
 		crbegin
 			() const
 		{
-			return const_reverse_iterator(end());
+			return const_reverse_iterator(cend());
 		}
 
 		//! Reverse-direction iterator to end of read only data
@@ -334,7 +524,7 @@ namespace ras
 		crend
 			() const
 		{
-			return const_reverse_iterator(begin());
+			return const_reverse_iterator(cbegin());
 		}
 
 		//! Reverse-direction iterator to start of mutable data
@@ -362,7 +552,7 @@ namespace ras
 			( size_t const & row
 			) const
 		{
-			return theData + (row * theWide);
+			return theData + (row * thePitch);
 		}
 
 		//! Iterator to end of *ROW* of read only data
@@ -372,7 +562,7 @@ namespace ras
 			( size_t const & row
 			) const
 		{
-			return beginRow(row + 1);
+			return cbeginRow(row) + theWide;
 		}
 
 		//! Iterator to start of *ROW* of mutable data
@@ -382,7 +572,7 @@ namespace ras
 			( size_t const & row
 			)
 		{
-			return theData + (row * theWide);
+			return theData + (row * thePitch);
 		}
 
 		//! Iterator to end of *ROW* of mutable data
@@ -392,7 +582,7 @@ namespace ras
 			( size_t const & row
 			)
 		{
-			return beginRow(row + 1);
+			return beginRow(row) + theWide;
 		}
 
 		//! Iterator to read-only data element at (row,col)
@@ -403,7 +593,7 @@ namespace ras
 			, size_t const & col
 			) const
 		{
-			return theData + (row * theWide + col);
+			return theData + (row * thePitch + col);
 		}
 
 		//! Iterator to mutable data element at (row,col)
@@ -414,7 +604,7 @@ namespace ras
 			, size_t const & col
 			)
 		{
-			return theData + (row * theWide + col);
+			return theData + (row * thePitch + col);
 		}
 
 		//! Row/Colum indices associated with iter value
@@ -424,10 +614,11 @@ namespace ras
 			( const_iterator const & iter
 			) const
 		{
-			size_t const dist(std::distance(cbegin(), iter));
+			const_iterator const itData{ theData };
+			size_t const dist(std::distance(itData, iter));
 			return ras::RowCol
-				{ dist / hwSize().wide()
-				, dist % hwSize().wide()
+				{ dist / thePitch
+				, dist % thePitch
 				};
 		}
 
@@ -477,9 +668,9 @@ namespace ras
 			oss << infoString(title);
 			if (isValid())
 			{
-				const_iterator iter{ cbegin() };
 				for (size_t row(0); row < theHigh; ++row)
 				{
+					const_iterator iter{ cbeginRow(row) };
 					oss << '\n';
 					for (size_t col(0); col < theWide; ++col)
 					{
@@ -523,9 +714,9 @@ namespace ras
 			oss << infoString(title);
 			if (isValid())
 			{
-				const_iterator iter{ cbegin() };
 				for (size_t row(0); row < theHigh; ++row)
 				{
+					const_iterator iter{ cbeginRow(row) };
 					oss << '\n';
 					for (size_t col(0); col < theWide; ++col)
 					{
@@ -553,9 +744,11 @@ namespace ras
 				{  isValid() && other.isValid()
 				&& (hwSize() == other.hwSize())
 				};
-			if (same)
+			// compare row by row (in case layouts differ)
+			for (std::size_t row{0u} ; same && (row < theHigh) ; ++row)
 			{
-				same = std::equal(cbegin(), cend(), other.cbegin(), func);
+				same = std::equal
+					(cbeginRow(row), cendRow(row), other.cbeginRow(row), func);
 			}
 			return same;
 		}
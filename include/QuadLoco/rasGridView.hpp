@@ -0,0 +1,364 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Definitions for ras::GridView<> non-owning raster access
+ *
+ */
+
+
+#include "QuadLoco/rasChipSpec.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasRowCol.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+
+namespace quadloco
+{
+
+namespace ras
+{
+	/*! \brief Read-only (non-owning) access to row major data with a stride.
+
+	A GridView provides the same (row,col) access pattern as ras::Grid
+	but does *NOT* own any data. Instead it refers to a data buffer that
+	is managed elsewhere (e.g. by a ras::Grid instance, or by a memory
+	mapped file). The consumer is responsible for ensuring the viewed
+	data buffer remains valid for the lifetime of the view.
+
+	Rows of the view are separated by rowStride() elements which may
+	be larger than wide(). This allows a view into a sub-region of a
+	larger grid (e.g. subViewFor()) without copying any cell values.
+
+	\par Example
+	\snippet test/test_rasGridView.cpp DoxyExample01
+	*/
+	template < typename Type >
+	class GridView
+	{
+		Type const * theData{ nullptr }; //!< Start of (external) data
+		std::size_t theHigh{ 0u }; //!< Number of rows in view
+		std::size_t theWide{ 0u }; //!< Number of columns in view
+		std::size_t theRowStride{ 0u }; //!< Elements from row to next row
+
+	public: // typedef
+
+		//! Data type for values of individual cells within view.
+		typedef Type value_type;
+		//! Type for readonly iterator moving across a single row.
+		typedef Type const * const_iterator;
+
+		// methods
+
+		//! Construct a null instance (false == isValid())
+		GridView
+			() = default;
+
+		//! Construct to view external data (with row stride in elements)
+		inline
+		explicit
+		GridView
+			( Type const * const & ptData
+				//!< Start of data (e.g. location of cell (0,0))
+			, SizeHW const & hwSize
+				//!< Dimensions of the viewed area
+			, std::size_t const & rowStride
+				//!< Number of elements between start of successive rows
+			)
+			: theData{ ptData }
+			, theHigh{ hwSize.high() }
+			, theWide{ hwSize.wide() }
+			, theRowStride{ rowStride }
+		{ }
+
+		//! Construct to view the entire contents of grid
+		inline
+		explicit
+		GridView
+			( Grid<Type> const & grid
+			)
+			: theData{ grid.cbeginRow(0u) }
+			, theHigh{ grid.high() }
+			, theWide{ grid.wide() }
+			, theRowStride{ grid.rowPitch() }
+		{ }
+
+		//! No view of a temporary grid (its data would not outlive this)
+		GridView
+			( Grid<Type> && grid
+			) = delete;
+
+		//! True if this instance refers to data
+		inline
+		bool
+		isValid
+			() const
+		{
+			return
+				(  (nullptr != theData)
+				&& (0u < theHigh)
+				&& (0u < theWide)
+				&& (! (theRowStride < theWide))
+				);
+		}
+
+		//! Dimensions of this view
+		inline
+		SizeHW
+		hwSize
+			() const
+		{
+			return SizeHW(theHigh, theWide);
+		}
+
+		//! Number of cells in each column of the view (== hwSize.high())
+		inline
+		std::size_t
+		high
+			() const
+		{
+			return theHigh;
+		}
+
+		//! Number of cells in each row of the view (== hwSize.wide())
+		inline
+		std::size_t
+		wide
+			() const
+		{
+			return theWide;
+		}
+
+		//! Number of cells in view (aka "element count")
+		inline
+		std::size_t
+		size
+			() const
+		{
+			return hwSize().size();
+		}
+
+		//! Number of elements between start of one row and the next
+		inline
+		std::size_t
+		rowStride
+			() const
+		{
+			return theRowStride;
+		}
+
+		//! True if rows are adjacent in memory (i.e. no gap between rows)
+		inline
+		bool
+		isContiguous
+			() const
+		{
+			return (theRowStride == theWide);
+		}
+
+		//! Constant reference to specified element
+		inline
+		Type const &
+		operator()
+			( std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			return *(theData + row * theRowStride + col);
+		}
+
+		//! Constant reference to specified element
+		inline
+		Type const &
+		operator()
+			( ras::RowCol const & rowcol
+			) const
+		{
+			return operator()(rowcol.row(), rowcol.col());
+		}
+
+		//! Iterator to start of *ROW* of read only data
+		inline
+		const_iterator
+		cbeginRow
+			( std::size_t const & row
+			) const
+		{
+			return theData + (row * theRowStride);
+		}
+
+		//! Iterator to end of *ROW* of read only data
+		inline
+		const_iterator
+		cendRow
+			( std::size_t const & row
+			) const
+		{
+			return cbeginRow(row) + theWide;
+		}
+
+		/*! \brief View of the chipSpec area within this view (no copying)
+		 *
+		 * The returned view uses the same data buffer (and row stride)
+		 * as this instance. If chipSpec does not fit inside this view,
+		 * a null instance is returned.
+		 */
+		inline
+		GridView<Type>
+		subViewFor
+			( ras::ChipSpec const & chipSpec
+			) const
+		{
+			GridView<Type> subView{};
+			if (isValid() && chipSpec.fitsInto(hwSize()))
+			{
+				subView = GridView<Type>
+					( &(operator()(chipSpec.srcOrigRC()))
+					, chipSpec.hwSize()
+					, theRowStride
+					);
+			}
+			return subView;
+		}
+
+		/*! \brief Descriptive information about this instance.
+		 *
+		 * Format is:
+		 * \arg title "High,Wide" high wide "Stride" rowStride
+		 */
+		inline
+		std::string
+		infoString
+			( std::string const & title=std::string()
+			) const
+		{
+			std::ostringstream oss;
+			if (!title.empty())
+			{
+				oss << title << " ";
+			}
+			oss << "High,Wide:"
+				<< ' ' << std::setw(5) << theHigh
+				<< ' ' << std::setw(5) << theWide
+				<< "  Stride:"
+				<< ' ' << std::setw(5) << theRowStride
+				;
+			return oss.str();
+		}
+
+	}; // GridView
+
+
+namespace grid
+{
+	//! View of fullGrid pixels defined by chip spec region (no copying)
+	template <typename Type>
+	inline
+	ras::GridView<Type>
+	subGridViewFrom
+		( ras::Grid<Type> const & fullGrid
+		, ras::ChipSpec const & chipSpec
+		)
+	{
+		return ras::GridView<Type>(fullGrid).subViewFor(chipSpec);
+	}
+
+	//! No view of a temporary grid (its data would not outlive the view)
+	template <typename Type>
+	ras::GridView<Type>
+	subGridViewFrom
+		( ras::Grid<Type> && fullGrid
+		, ras::ChipSpec const & chipSpec
+		) = delete;
+
+	//! Copy of all view cells into a (newly allocated) contiguous grid
+	template <typename OutType, typename SrcType>
+	inline
+	ras::Grid<OutType>
+	gridCopyOf
+		( ras::GridView<SrcType> const & srcView
+		)
+	{
+		ras::Grid<OutType> outGrid;
+		if (srcView.isValid())
+		{
+			outGrid = ras::Grid<OutType>(srcView.hwSize());
+			typename ras::Grid<OutType>::iterator outIter{ outGrid.begin() };
+			for (std::size_t row{0u} ; row < srcView.high() ; ++row)
+			{
+				outIter = std::transform
+					( srcView.cbeginRow(row), srcView.cendRow(row)
+					, outIter
+					, [] (SrcType const & srcVal)
+						{ return static_cast<OutType>(srcVal); }
+					);
+			}
+		}
+		return outGrid;
+	}
+
+} // [grid]
+
+} // [ras]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put obj.infoString() to stream
+	template <typename Type >
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::ras::GridView<Type> const & obj
+		)
+	{
+		ostrm << obj.infoString();
+		return ostrm;
+	}
+
+	//! True if item refers to valid data
+	template <typename Type >
+	inline
+	bool
+	isValid
+		( quadloco::ras::GridView<Type> const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
@@ -0,0 +1,353 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::ras::NullDistance (validity transform)
+ *
+ */
+
+
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
+#include "QuadLoco/rasRowCol.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
+
+#include <Engabra>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <string>
+
+
+namespace quadloco
+{
+
+namespace ras
+{
+
+	/*! \brief Distance (in cells) from each source cell to nearest null.
+	 *
+	 * Computed once per source grid (two raster passes) such that
+	 * window filters can determine in O(1) if an entire (square)
+	 * window contains only valid values - and if so, run an inner
+	 * loop without per-sample validity checks.
+	 *
+	 * Distances are chessboard (Chebyshev) distances: i.e. the square
+	 * window of halfSize cells centered on a cell contains a null value
+	 * if and only if distanceAt() that cell is no larger than halfSize.
+	 * Null cells have distance zero (so this also serves as validity
+	 * mask). Cells outside the source area are not considered to be
+	 * null, and distances are saturated at maxDistance().
+	 *
+	 * \par Example
+	 * \snippet test/test_rasNullDistance.cpp DoxyExample01
+	 */
+	class NullDistance
+	{
+		//! Distance to nearest null (0 for null cells)
+		ras::Grid<std::uint16_t> theDists{};
+
+		//! Number of null cells in source
+		std::size_t theNumNulls{ 0u };
+
+	public:
+
+		//! Largest distance value (e.g. for source without nulls)
+		inline
+		static
+		constexpr
+		std::size_t
+		maxDistance
+			()
+		{
+			return std::numeric_limits<std::uint16_t>::max();
+		}
+
+		//! Construct a null instance (isValid() == false)
+		inline
+		NullDistance
+			() = default;
+
+		//! Compute distance transform of null values in srcView
+		template <typename SrcType>
+		inline
+		explicit
+		NullDistance
+			( ras::GridView<SrcType> const & srcView
+				//!< Source values (null determined by engabra::g3::isValid)
+			)
+		{
+			if (srcView.isValid())
+			{
+				constexpr std::uint16_t maxDist
+					{ std::numeric_limits<std::uint16_t>::max() };
+				std::size_t const high{ srcView.high() };
+				std::size_t const wide{ srcView.wide() };
+				theDists = ras::Grid<std::uint16_t>(srcView.hwSize());
+
+				// incremented distance (saturated at maxDist)
+				auto const nextDist
+					{ [] (std::uint16_t const & dist)
+						{
+							return (dist < maxDist)
+								? static_cast<std::uint16_t>(dist + 1u)
+								: maxDist;
+						}
+					};
+
+				// forward pass: nearest null above and to the left
+				for (std::size_t row{0u} ; row < high ; ++row)
+				{
+					for (std::size_t col{0u} ; col < wide ; ++col)
+					{
+						std::uint16_t dist{ 0u };
+						if (engabra::g3::isValid(srcView(row, col)))
+						{
+							std::uint16_t minPrev{ maxDist };
+							if (0u < row)
+							{
+								if (0u < col)
+								{
+									minPrev = std::min
+										(minPrev, theDists(row - 1u, col - 1u));
+								}
+								minPrev = std::min
+									(minPrev, theDists(row - 1u, col));
+								if ((col + 1u) < wide)
+								{
+									minPrev = std::min
+										(minPrev, theDists(row - 1u, col + 1u));
+								}
+							}
+							if (0u < col)
+							{
+								minPrev = std::min
+									(minPrev, theDists(row, col - 1u));
+							}
+							dist = nextDist(minPrev);
+						}
+						else
+						{
+							++theNumNulls;
+						}
+						theDists(row, col) = dist;
+					}
+				}
+
+				// backward pass: nearest null below and to the right
+				for (std::size_t row{high} ; 0u < row-- ; )
+				{
+					for (std::size_t col{wide} ; 0u < col-- ; )
+					{
+						std::uint16_t & dist = theDists(row, col);
+						if (0u < dist)
+						{
+							std::uint16_t minNext{ maxDist };
+							if ((row + 1u) < high)
+							{
+								if ((col + 1u) < wide)
+								{
+									minNext = std::min
+										(minNext, theDists(row + 1u, col + 1u));
+								}
+								minNext = std::min
+									(minNext, theDists(row + 1u, col));
+								if (0u < col)
+								{
+									minNext = std::min
+										(minNext, theDists(row + 1u, col - 1u));
+								}
+							}
+							if ((col + 1u) < wide)
+							{
+								minNext = std::min
+									(minNext, theDists(row, col + 1u));
+							}
+							dist = std::min(dist, nextDist(minNext));
+						}
+					}
+				}
+			}
+		}
+
+		//! Compute distance transform of null values in srcGrid
+		template <typename SrcType>
+		inline
+		explicit
+		NullDistance
+			( ras::Grid<SrcType> const & srcGrid
+				//!< Source values (null determined by engabra::g3::isValid)
+			)
+			: NullDistance(ras::GridView<SrcType>(srcGrid))
+		{ }
+
+		//! True if this instance is not null
+		inline
+		bool
+		isValid
+			() const
+		{
+			return theDists.isValid();
+		}
+
+		//! Size of source grid
+		inline
+		ras::SizeHW
+		hwSize
+			() const
+		{
+			return theDists.hwSize();
+		}
+
+		//! Number of null cells in source
+		inline
+		std::size_t
+		numNulls
+			() const
+		{
+			return theNumNulls;
+		}
+
+		//! Chessboard distance from (row,col) to nearest null cell
+		inline
+		std::size_t
+		distanceAt
+			( std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			return static_cast<std::size_t>(theDists(row, col));
+		}
+
+		//! True if source value at (row,col) is not null
+		inline
+		bool
+		isValidAt
+			( std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			return (0u < theDists(row, col));
+		}
+
+		/*! \brief True if window is inside source and contains no nulls.
+		 *
+		 * The window covers rows [row-halfHigh, row+halfHigh] and
+		 * columns [col-halfWide, col+halfWide]. For non-square windows
+		 * the test is conservative (may report false for a window that
+		 * is actually valid, but never true for one that is not).
+		 */
+		inline
+		bool
+		isWindowValid
+			( std::size_t const & row
+			, std::size_t const & col
+			, std::size_t const & halfHigh
+			, std::size_t const & halfWide
+			) const
+		{
+			bool okay{ false };
+			if ( isValid()
+			  && (! (row < halfHigh)) && ((row + halfHigh) < theDists.high())
+			  && (! (col < halfWide)) && ((col + halfWide) < theDists.wide())
+			   )
+			{
+				std::size_t const halfMax{ std::max(halfHigh, halfWide) };
+				okay = (halfMax < distanceAt(row, col));
+			}
+			return okay;
+		}
+
+		//! True if square window (of halfSize) about rowcol is all valid
+		inline
+		bool
+		isWindowValid
+			( ras::RowCol const & rowcol
+			, std::size_t const & halfSize
+			) const
+		{
+			return isWindowValid
+				(rowcol.row(), rowcol.col(), halfSize, halfSize);
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss
+				<< "hwSize: " << hwSize()
+				<< ' '
+				<< "numNulls: " << numNulls()
+				;
+			return oss.str();
+		}
+
+	}; // NullDistance
+
+} // [ras]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::ras::NullDistance const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	inline
+	bool
+	isValid
+		( quadloco::ras::NullDistance const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
@@ -0,0 +1,440 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::ras::PaddedGrid (grid with apron)
+ *
+ */
+
+
+#include "QuadLoco/imgSpot.hpp"
+#include "QuadLoco/pix.hpp"
+#include "QuadLoco/rasChipSpec.hpp"
+#include "QuadLoco/rasgrid.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
+#include "QuadLoco/rasRowCol.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+
+namespace quadloco
+{
+
+namespace ras
+{
+
+	//! Policy for values in the apron around a PaddedGrid
+	enum class PadMode
+	{
+		  Replicate //!< Apron cells repeat the nearest edge cell
+		, Mirror //!< Apron cells reflect interior (edge cell not repeated)
+		, Null //!< Apron cells are pix::null<Type>()
+	};
+
+	/*! \brief Grid with an apron (border) of padSize cells all around.
+	 *
+	 * The interior (of size hwSize()) holds a copy of the source values.
+	 * The apron is filled according to PadMode, such that window
+	 * operations that extend at most padSize() cells beyond the
+	 * interior can read every needed value without bounds checks
+	 * (and, for Replicate or Mirror, produce results at the edges of
+	 * the interior instead of null values).
+	 *
+	 * Interior (row,col) corresponds to fullGrid() cell (row+pad,col+pad).
+	 *
+	 * \par Example
+	 * \snippet test/test_rasPaddedGrid.cpp DoxyExample01
+	 */
+	template <typename Type>
+	class PaddedGrid
+	{
+		//! Interior values surrounded by apron
+		ras::Grid<Type> theFullGrid{};
+
+		//! Thickness of apron (in cells)
+		std::size_t thePadSize{ 0u };
+
+		//! Policy with which apron was filled
+		PadMode thePadMode{ PadMode::Replicate };
+
+	public:
+
+		/*! \brief Interior index from which to fill apron index ndx.
+		 *
+		 * The ndx value is relative to the interior (may be negative or
+		 * not less than size). Not used for PadMode::Null.
+		 */
+		inline
+		static
+		std::size_t
+		sourceIndexFor
+			( std::ptrdiff_t const & ndx
+				//!< Index (of row or col) relative to interior
+			, std::size_t const & size
+				//!< Number of interior cells (in row or col direction)
+			, PadMode const & padMode
+				//!< Replicate or Mirror
+			)
+		{
+			std::ptrdiff_t const last{ static_cast<std::ptrdiff_t>(size) - 1 };
+			std::ptrdiff_t srcNdx{ std::clamp(ndx, std::ptrdiff_t{ 0 }, last) };
+			if ((PadMode::Mirror == padMode) && (0 < last))
+			{
+				// reflect about first and last cells (period 2*last)
+				std::ptrdiff_t const period{ 2 * last };
+				std::ptrdiff_t const mod{ ((ndx % period) + period) % period };
+				srcNdx = (last < mod) ? (period - mod) : mod;
+			}
+			return static_cast<std::size_t>(srcNdx);
+		}
+
+		//! Construct a null instance (isValid() == false)
+		inline
+		PaddedGrid
+			() = default;
+
+		//! Copy srcView into interior and fill apron per padMode
+		inline
+		explicit
+		PaddedGrid
+			( ras::GridView<Type> const & srcView
+				//!< Source values for interior
+			, std::size_t const & padSize
+				//!< Thickness of apron (e.g. half size of largest window)
+			, PadMode const & padMode = PadMode::Replicate
+				//!< Policy for apron values
+			)
+			: theFullGrid{}
+			, thePadSize{ padSize }
+			, thePadMode{ padMode }
+		{
+			if (srcView.isValid())
+			{
+				std::size_t const high{ srcView.high() };
+				std::size_t const wide{ srcView.wide() };
+				std::size_t const fullWide{ wide + 2u * padSize };
+				theFullGrid = ras::Grid<Type>
+					(ras::SizeHW{ high + 2u * padSize, fullWide });
+				constexpr Type nullValue{ pix::null<Type>() };
+
+				// interior rows (with left and right apron portions)
+				std::ptrdiff_t const pad{ (std::ptrdiff_t)padSize };
+				for (std::size_t row{0u} ; row < high ; ++row)
+				{
+					Type * const fullRow{ theFullGrid.beginRow(row + padSize) };
+					std::copy
+						(srcView.cbeginRow(row), srcView.cendRow(row)
+						, fullRow + padSize
+						);
+					for (std::size_t pp{0u} ; pp < padSize ; ++pp)
+					{
+						Type & lft = fullRow[pp];
+						Type & rgt = fullRow[padSize + wide + pp];
+						if (PadMode::Null == padMode)
+						{
+							lft = nullValue;
+							rgt = nullValue;
+						}
+						else
+						{
+							std::ptrdiff_t const ndx{ (std::ptrdiff_t)pp };
+							lft = srcView(row, sourceIndexFor
+								(ndx - pad, wide, padMode));
+							rgt = srcView(row, sourceIndexFor
+								((std::ptrdiff_t)wide + ndx, wide, padMode));
+						}
+					}
+				}
+
+				// top and bottom apron rows (copies of full rows)
+				for (std::size_t pp{0u} ; pp < padSize ; ++pp)
+				{
+					Type * const topRow{ theFullGrid.beginRow(pp) };
+					Type * const botRow
+						{ theFullGrid.beginRow(padSize + high + pp) };
+					if (PadMode::Null == padMode)
+					{
+						std::fill(topRow, topRow + fullWide, nullValue);
+						std::fill(botRow, botRow + fullWide, nullValue);
+					}
+					else
+					{
+						std::ptrdiff_t const ndx{ (std::ptrdiff_t)pp };
+						std::size_t const topSrc
+							{ sourceIndexFor(ndx - pad, high, padMode) };
+						std::size_t const botSrc
+							{ sourceIndexFor
+								((std::ptrdiff_t)high + ndx, high, padMode)
+							};
+						Type const * const topFrom
+							{ theFullGrid.beginRow(topSrc + padSize) };
+						Type const * const botFrom
+							{ theFullGrid.beginRow(botSrc + padSize) };
+						std::copy(topFrom, topFrom + fullWide, topRow);
+						std::copy(botFrom, botFrom + fullWide, botRow);
+					}
+				}
+			}
+		}
+
+		//! Copy srcGrid into interior and fill apron per padMode
+		inline
+		explicit
+		PaddedGrid
+			( ras::Grid<Type> const & srcGrid
+				//!< Source values for interior
+			, std::size_t const & padSize
+				//!< Thickness of apron (e.g. half size of largest window)
+			, PadMode const & padMode = PadMode::Replicate
+				//!< Policy for apron values
+			)
+			: PaddedGrid(ras::GridView<Type>(srcGrid), padSize, padMode)
+		{ }
+
+		//! True if this instance is not null
+		inline
+		bool
+		isValid
+			() const
+		{
+			return theFullGrid.isValid();
+		}
+
+		//! Thickness of apron
+		inline
+		std::size_t
+		padSize
+			() const
+		{
+			return thePadSize;
+		}
+
+		//! Policy with which apron was filled
+		inline
+		PadMode
+		padMode
+			() const
+		{
+			return thePadMode;
+		}
+
+		//! Size of interior (i.e. of source)
+		inline
+		ras::SizeHW
+		hwSize
+			() const
+		{
+			return ras::SizeHW{ high(), wide() };
+		}
+
+		//! Number of interior rows
+		inline
+		std::size_t
+		high
+			() const
+		{
+			return isValid() ? (theFullGrid.high() - 2u * thePadSize) : 0u;
+		}
+
+		//! Number of interior columns
+		inline
+		std::size_t
+		wide
+			() const
+		{
+			return isValid() ? (theFullGrid.wide() - 2u * thePadSize) : 0u;
+		}
+
+		//! Interior and apron values (interior starts at (pad,pad))
+		inline
+		ras::Grid<Type> const &
+		fullGrid
+			() const
+		{
+			return theFullGrid;
+		}
+
+		//! Interior cell (row,col)
+		inline
+		Type const &
+		operator()
+			( std::size_t const & row
+			, std::size_t const & col
+			) const
+		{
+			return theFullGrid(row + thePadSize, col + thePadSize);
+		}
+
+		//! Cell relative to interior: row,col in [-padSize, high/wide+pad)
+		inline
+		Type const &
+		valueAt
+			( std::ptrdiff_t const & row
+			, std::ptrdiff_t const & col
+			) const
+		{
+			std::ptrdiff_t const pad{ (std::ptrdiff_t)thePadSize };
+			return theFullGrid
+				( static_cast<std::size_t>(row + pad)
+				, static_cast<std::size_t>(col + pad)
+				);
+		}
+
+		//! View of interior (reads up to padSize() beyond it are valid)
+		inline
+		ras::GridView<Type>
+		view
+			() const &
+		{
+			ras::GridView<Type> interior{};
+			if (isValid())
+			{
+				interior = ras::GridView<Type>(theFullGrid)
+					.subViewFor(ras::ChipSpec{ outerRowCol(0u), hwSize() });
+			}
+			return interior;
+		}
+
+		//! No view of a temporary (its data would not outlive the view)
+		ras::GridView<Type>
+		view
+			() const && = delete;
+
+		//! View of interior plus margin (<= padSize()) all around
+		inline
+		ras::GridView<Type>
+		viewWithMargin
+			( std::size_t const & margin
+			) const &
+		{
+			ras::GridView<Type> outer{};
+			if (isValid() && (! (thePadSize < margin)))
+			{
+				ras::SizeHW const hwOuter
+					{ high() + 2u * margin, wide() + 2u * margin };
+				outer = ras::GridView<Type>(theFullGrid)
+					.subViewFor(ras::ChipSpec{ outerRowCol(margin), hwOuter });
+			}
+			return outer;
+		}
+
+		//! No view of a temporary (its data would not outlive the view)
+		ras::GridView<Type>
+		viewWithMargin
+			( std::size_t const & margin
+			) const && = delete;
+
+		//! Location in fullGrid() of first cell with margin around interior
+		inline
+		ras::RowCol
+		outerRowCol
+			( std::size_t const & margin
+			) const
+		{
+			std::size_t const offset{ thePadSize - margin };
+			return ras::RowCol{ offset, offset };
+		}
+
+		/*! \brief Bilinear interpolation at (interior) spot location.
+		 *
+		 * Spots near (and beyond, up to the apron) the interior edges
+		 * are interpolated from apron values.
+		 */
+		inline
+		Type
+		bilinValueAt
+			( img::Spot const & atSpot
+			) const
+		{
+			double const pad{ (double)thePadSize };
+			img::Spot const fullSpot{ atSpot[0] + pad, atSpot[1] + pad };
+			return ras::grid::bilinValueAt<Type>(theFullGrid, fullSpot);
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss
+				<< "hwSize: " << hwSize()
+				<< ' '
+				<< "padSize: " << padSize()
+				<< ' '
+				<< "padMode: " << static_cast<int>(padMode())
+				;
+			return oss.str();
+		}
+
+	}; // PaddedGrid
+
+} // [ras]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	template <typename Type>
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::ras::PaddedGrid<Type> const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	template <typename Type>
+	inline
+	bool
+	isValid
+		( quadloco::ras::PaddedGrid<Type> const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
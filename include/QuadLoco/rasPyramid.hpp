@@ -0,0 +1,349 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::ras::Pyramid (multi-resolution grids)
+ *
+ */
+
+
+#include "QuadLoco/pix.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
+#include "QuadLoco/rasRowCol.hpp"
+#include "QuadLoco/rasSizeHW.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace quadloco
+{
+
+namespace ras
+{
+
+	/*! \brief Sequence of grids each (about) half the size of the previous.
+	 *
+	 * Level 0 is the source view itself (not copied - the source data
+	 * must remain valid for the life of the pyramid). Each subsequent
+	 * level is produced by decimatedGridFor() from the level before it.
+	 *
+	 * Cell (row,col) at level L corresponds to cell
+	 * (scaleFor(L)*row, scaleFor(L)*col) at level 0 (ref fullRowColFor()).
+	 *
+	 * \par Example
+	 * \snippet test/test_rasPyramid.cpp DoxyExample01
+	 */
+	class Pyramid
+	{
+		//! Source (full resolution) values
+		ras::GridView<float> theBaseView{};
+
+		//! Levels [1,numLevels) - theCoarseGrids[L-1] is level L
+		std::vector<ras::Grid<float> > theCoarseGrids{};
+
+	public:
+
+		/*! \brief Anti-aliased 2x decimation of srcView.
+		 *
+		 * Output cell (row,col) is the [1,2,1]x[1,2,1]/16 (binomial)
+		 * weighted average of the srcView cells about (2*row,2*col).
+		 * Source cells beyond the edges are replicated from the edge.
+		 * Null source values are excluded from the average (with
+		 * weights renormalized) and output cells for which all nine
+		 * source values are null are set to null.
+		 *
+		 * The result has size ((high+1)/2, (wide+1)/2).
+		 */
+		inline
+		static
+		ras::Grid<float>
+		decimatedGridFor
+			( ras::GridView<float> const & srcView
+				//!< Source values to decimate
+			)
+		{
+			ras::Grid<float> outGrid{};
+			if (srcView.isValid())
+			{
+				std::size_t const srcHigh{ srcView.high() };
+				std::size_t const srcWide{ srcView.wide() };
+				std::size_t const outHigh{ (srcHigh + 1u) / 2u };
+				std::size_t const outWide{ (srcWide + 1u) / 2u };
+				outGrid = ras::Grid<float>(outHigh, outWide);
+
+				constexpr std::array<float, 3u> wgts{ 1.f, 2.f, 1.f };
+				for (std::size_t outRow{0u} ; outRow < outHigh ; ++outRow)
+				{
+					// source rows (clamped to edges)
+					std::size_t const midRow{ 2u * outRow };
+					std::array<std::size_t, 3u> const srcRows
+						{ (0u < midRow) ? (midRow - 1u) : 0u
+						, midRow
+						, std::min(midRow + 1u, srcHigh - 1u)
+						};
+					for (std::size_t outCol{0u} ; outCol < outWide ; ++outCol)
+					{
+						std::size_t const midCol{ 2u * outCol };
+						std::array<std::size_t, 3u> const srcCols
+							{ (0u < midCol) ? (midCol - 1u) : 0u
+							, midCol
+							, std::min(midCol + 1u, srcWide - 1u)
+							};
+						float sumWgtVals{ 0.f };
+						float sumWgts{ 0.f };
+						for (std::size_t wr{0u} ; wr < 3u ; ++wr)
+						{
+							for (std::size_t wc{0u} ; wc < 3u ; ++wc)
+							{
+								float const & srcVal
+									= srcView(srcRows[wr], srcCols[wc]);
+								if (pix::isValid(srcVal))
+								{
+									float const wgt{ wgts[wr] * wgts[wc] };
+									sumWgtVals += wgt * srcVal;
+									sumWgts += wgt;
+								}
+							}
+						}
+						float outVal{ pix::null<float>() };
+						if (0.f < sumWgts)
+						{
+							outVal = sumWgtVals / sumWgts;
+						}
+						outGrid(outRow, outCol) = outVal;
+					}
+				}
+			}
+			return outGrid;
+		}
+
+		//! Construct a null instance (isValid() == false)
+		inline
+		Pyramid
+			() = default;
+
+		/*! \brief Build up to numLevels levels (including srcView itself).
+		 *
+		 * Decimation stops early if a level would have fewer than
+		 * minSize rows or columns (i.e. numLevels() may be less than
+		 * requested).
+		 */
+		inline
+		explicit
+		Pyramid
+			( ras::GridView<float> const & srcView
+				//!< Full resolution source (level 0) - must outlive this
+			, std::size_t const & numLevels
+				//!< Requested number of levels (e.g. 1 is srcView only)
+			, std::size_t const & minSize = 8u
+				//!< Minimum number of rows/columns in coarsest level
+			)
+			: theBaseView{ srcView }
+			, theCoarseGrids{}
+		{
+			if (srcView.isValid() && (1u < numLevels))
+			{
+				theCoarseGrids.reserve(numLevels - 1u);
+				ras::GridView<float> prevView{ srcView };
+				for (std::size_t level{1u} ; level < numLevels ; ++level)
+				{
+					std::size_t const nextHigh{ (prevView.high() + 1u) / 2u };
+					std::size_t const nextWide{ (prevView.wide() + 1u) / 2u };
+					if ((nextHigh < minSize) || (nextWide < minSize))
+					{
+						break;
+					}
+					theCoarseGrids.emplace_back(decimatedGridFor(prevView));
+					prevView = ras::GridView<float>(theCoarseGrids.back());
+				}
+			}
+		}
+
+		//! Build pyramid with srcGrid as level 0 (srcGrid must outlive this)
+		inline
+		explicit
+		Pyramid
+			( ras::Grid<float> const & srcGrid
+				//!< Full resolution source (level 0) - must outlive this
+			, std::size_t const & numLevels
+				//!< Requested number of levels (e.g. 1 is srcGrid only)
+			, std::size_t const & minSize = 8u
+				//!< Minimum number of rows/columns in coarsest level
+			)
+			: Pyramid(ras::GridView<float>(srcGrid), numLevels, minSize)
+		{ }
+
+		//! No pyramid over a temporary grid (level 0 would dangle)
+		Pyramid
+			( ras::Grid<float> && srcGrid
+			, std::size_t const & numLevels
+			, std::size_t const & minSize = 8u
+			) = delete;
+
+		//! True if this instance is not null
+		inline
+		bool
+		isValid
+			() const
+		{
+			return theBaseView.isValid();
+		}
+
+		//! Number of levels (including level 0, zero if not valid)
+		inline
+		std::size_t
+		numLevels
+			() const
+		{
+			std::size_t num{ 0u };
+			if (isValid())
+			{
+				num = 1u + theCoarseGrids.size();
+			}
+			return num;
+		}
+
+		//! View into the grid at level (null view if level is not present)
+		inline
+		ras::GridView<float>
+		view
+			( std::size_t const & level
+			) const &
+		{
+			ras::GridView<float> levelView{};
+			if (0u == level)
+			{
+				levelView = theBaseView;
+			}
+			else
+			if (level < numLevels())
+			{
+				levelView = ras::GridView<float>(theCoarseGrids[level - 1u]);
+			}
+			return levelView;
+		}
+
+		//! No view into a temporary (coarse levels would not outlive it)
+		ras::GridView<float>
+		view
+			( std::size_t const & level
+			) const && = delete;
+
+		//! Size of grid at level (zero size if level is not present)
+		inline
+		ras::SizeHW
+		hwSize
+			( std::size_t const & level
+			) const
+		{
+			return view(level).hwSize();
+		}
+
+		//! Number of level 0 cells spanned by one cell at level
+		inline
+		static
+		std::size_t
+		scaleFor
+			( std::size_t const & level
+			)
+		{
+			return (std::size_t{ 1u } << level);
+		}
+
+		//! Level 0 cell corresponding with (levelRC) cell at level
+		inline
+		static
+		ras::RowCol
+		fullRowColFor
+			( std::size_t const & level
+			, ras::RowCol const & levelRC
+			)
+		{
+			std::size_t const scale{ scaleFor(level) };
+			return ras::RowCol{ scale * levelRC.row(), scale * levelRC.col() };
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss << "numLevels: " << numLevels();
+			for (std::size_t level{0u} ; level < numLevels() ; ++level)
+			{
+				oss << '\n' << "  level: " << level << ' ' << hwSize(level);
+			}
+			return oss.str();
+		}
+
+	}; // Pyramid
+
+} // [ras]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::ras::Pyramid const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+	//! True if item is not null
+	inline
+	bool
+	isValid
+		( quadloco::ras::Pyramid const & item
+		)
+	{
+		return item.isValid();
+	}
+
+} // [anon/global]
+
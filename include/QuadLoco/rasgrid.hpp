@@ -40,13 +40,16 @@
 #include "QuadLoco/pix.hpp"
 #include "QuadLoco/rasChipSpec.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
 #include "QuadLoco/rasRowCol.hpp"
+#include "QuadLoco/rassimd.hpp"
 #include "QuadLoco/valSpan.hpp"
 
 #include <Engabra> // TODO - temp
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <utility>
 
 
@@ -60,6 +63,22 @@ namespace ras
  */
 namespace grid
 {
+	//! Elements between row starts: rowPitch if non-zero else hwSize.wide()
+	inline
+	std::size_t
+	pitchFor
+		( ras::SizeHW const & hwSize
+		, std::size_t const & rowPitch
+		)
+	{
+		std::size_t pitch{ hwSize.wide() };
+		if (0u < rowPitch)
+		{
+			pitch = rowPitch;
+		}
+		return pitch;
+	}
+
 	//! Put value into the *FIRST* nRows after beg assuming dimensions hwSize
 	template <typename FwdIter, typename Type>
 	inline
@@ -69,13 +88,16 @@ namespace grid
 		, ras::SizeHW const & hwSize
 		, std::size_t const & nRows
 		, Type const & value
+		, std::size_t const & rowPitch = 0u
+			//!< Elements between row starts (0: hwSize.wide())
 		)
 	{
-		std::fill
-			( beg
-			, beg + nRows * hwSize.wide()
-			, value
-			);
+		std::size_t const pitch{ pitchFor(hwSize, rowPitch) };
+		for (std::size_t row{0u} ; row < nRows ; ++row)
+		{
+			FwdIter const rowBeg{ beg + (row * pitch) };
+			std::fill(rowBeg, rowBeg + hwSize.wide(), value);
+		}
 	}
 
 	//! Put value into the *LAST* nRows assuming dimensions hwSize from beg
@@ -85,15 +107,19 @@ namespace grid
 	fillLastRows
 		( FwdIter const & beg
 		, ras::SizeHW const & hwSize
-		, std::size_t const & nCols
+		, std::size_t const & nRows
 		, Type const & value
+		, std::size_t const & rowPitch = 0u
+			//!< Elements between row starts (0: hwSize.wide())
 		)
 	{
-		std::fill
-			( beg + hwSize.size() - nCols * hwSize.wide()
-			, beg + hwSize.size()
-			, value
-			);
+		std::size_t const pitch{ pitchFor(hwSize, rowPitch) };
+		std::size_t const rowEnd{ hwSize.high() };
+		for (std::size_t row{rowEnd - nRows} ; row < rowEnd ; ++row)
+		{
+			FwdIter const rowBeg{ beg + (row * pitch) };
+			std::fill(rowBeg, rowBeg + hwSize.wide(), value);
+		}
 	}
 
 	//! Put value into the *FIRST* nCols from beg assuming hwSize
@@ -105,11 +131,14 @@ namespace grid
 		, ras::SizeHW const & hwSize
 		, std::size_t const & nCols
 		, Type const & value
+		, std::size_t const & rowPitch = 0u
+			//!< Elements between row starts (0: hwSize.wide())
 		)
 	{
+		std::size_t const pitch{ pitchFor(hwSize, rowPitch) };
 		for (std::size_t row{0u} ; row < hwSize.high() ; ++row)
 		{
-			FwdIter const colBeg{ beg + (row * hwSize.wide()) };
+			FwdIter const colBeg{ beg + (row * pitch) };
 			FwdIter const colEnd{ colBeg + nCols };
 			std::fill(colBeg, colEnd, value);
 		}
@@ -124,12 +153,15 @@ namespace grid
 		, ras::SizeHW const & hwSize
 		, std::size_t const & nCols
 		, Type const & value
+		, std::size_t const & rowPitch = 0u
+			//!< Elements between row starts (0: hwSize.wide())
 		)
 	{
+		std::size_t const pitch{ pitchFor(hwSize, rowPitch) };
 		std::size_t const colOffset{ hwSize.wide() - nCols };
 		for (std::size_t row{0u} ; row < hwSize.high() ; ++row)
 		{
-			FwdIter const colBeg{ beg + (row * hwSize.wide() + colOffset) };
+			FwdIter const colBeg{ beg + (row * pitch + colOffset) };
 			FwdIter const colEnd{ colBeg + nCols };
 			std::fill(colBeg, colEnd, value);
 		}
@@ -144,25 +176,62 @@ namespace grid
 		, ras::SizeHW const & hwSize
 		, std::size_t const & nPad
 		, Type const & value
+		, std::size_t const & rowPitch = 0u
+			//!< Elements between row starts (0: hwSize.wide())
 		)
 	{
+		if (! (0u < nPad))
+		{
+			return;
+		}
+
+		std::size_t const pitch{ pitchFor(hwSize, rowPitch) };
+
 		//! fill initial rows
-		fillInitRows(beg, hwSize, nPad, value);
+		fillInitRows(beg, hwSize, nPad, value, pitch);
 
 		// fill columns (as contiguous values over end(row) and start(row+1)
+		// when rows are contiguous, else as separate end/start segments)
 		std::size_t const midSkip{ hwSize.wide() - 2*nPad };
 		std::size_t const rowBeg{ nPad - 1u};
 		std::size_t const rowEnd{ hwSize.high() - nPad };
-		std::size_t const rowDelta{ hwSize.wide() };
+		bool const isContiguous{ (pitch == hwSize.wide()) };
 		for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
 		{
-			FwdIter const itBeg{ beg + (row*rowDelta) + nPad + midSkip };
-			FwdIter const itEnd{ itBeg + 2*nPad };
-			std::fill(itBeg, itEnd, value);
+			FwdIter const itBeg{ beg + (row*pitch) + nPad + midSkip };
+			if (isContiguous)
+			{
+				std::fill(itBeg, itBeg + 2*nPad, value);
+			}
+			else
+			{
+				FwdIter const nextBeg{ beg + ((row + 1u)*pitch) };
+				std::fill(itBeg, itBeg + nPad, value);
+				std::fill(nextBeg, nextBeg + nPad, value);
+			}
 		}
 
 		//! fill final rows
-		fillLastRows(beg, hwSize, nPad, value);
+		fillLastRows(beg, hwSize, nPad, value, pitch);
+	}
+
+	//! Put value into *BORDER* nPad thick within *ptGrid (any layout)
+	template <typename Type>
+	inline
+	void
+	fillBorder
+		( ras::Grid<Type> * const & ptGrid
+		, std::size_t const & nPad
+		, Type const & value
+		)
+	{
+		if (ptGrid && ptGrid->isValid())
+		{
+			fillBorder
+				( ptGrid->beginRow(0u), ptGrid->hwSize(), nPad, value
+				, ptGrid->rowPitch()
+				);
+		}
 	}
 
 	//! Iterators to (not null) min/max *valid* elements in collection
@@ -243,6 +312,41 @@ namespace grid
 		return minmax;
 	}
 
+	//! Min/Max values over grid cells (only) with isValid() inputs considered
+	template <typename PixType>
+	inline
+	std::pair<PixType, PixType>
+	validMinMaxValues
+		( ras::Grid<PixType> const & grid
+		)
+	{
+		std::pair<PixType, PixType> minmax
+			{ pix::null<PixType>(), pix::null<PixType>() };
+		PixType & min = minmax.first;
+		PixType & max = minmax.second;
+		using InIt = typename ras::Grid<PixType>::const_iterator;
+		// consider one row at a time (excluding any row pad cells)
+		for (std::size_t row{0u} ; row < grid.high() ; ++row)
+		{
+			std::pair<PixType, PixType> const rowMinMax
+				{ validMinMaxValues<InIt, PixType>
+					(grid.cbeginRow(row), grid.cendRow(row))
+				};
+			if (pix::isValid(rowMinMax.first))
+			{
+				if ((! pix::isValid(min)) || (rowMinMax.first < min))
+				{
+					min = rowMinMax.first;
+				}
+				if ((! pix::isValid(max)) || (max < rowMinMax.second))
+				{
+					max = rowMinMax.second;
+				}
+			}
+		}
+		return minmax;
+	}
+
 	//! Span with begin/end at smallest/largest (valid) values in fGrid
 	template <typename PixType>
 	inline
@@ -252,7 +356,7 @@ namespace grid
 		)
 	{
 		std::pair<PixType, PixType> const fMinMax
-			{ validMinMaxValues(fGrid.cbegin(), fGrid.cend()) };
+			{ validMinMaxValues(fGrid) };
 		PixType const & fMin = fMinMax.first;
 		// bump max by a tiny amount so that largest value *is* included
 		PixType const & fMax = fMinMax.second;
@@ -262,39 +366,115 @@ namespace grid
 		return quadloco::val::Span{ (double)fMin, (double)useMax };
 	}
 
-	//! \brief Convert grid elements to float
-	template <typename PixType>
+	/*! \brief Convert viewed elements to float (e.g. from a mapped image)
+	 *
+	 * SrcType is an unsigned integer pixel type (e.g. uint8_t or
+	 * uint16_t). Values are converted at full source precision.
+	 *
+	 * Each row is converted with ras::simd::convertRow() (vectorized
+	 * where supported). Null handling is decided once per call: when
+	 * treatAsNull is in range, a separate (branch free) pass marks
+	 * matching cells as null.
+	 */
+	template <typename PixType, typename SrcType>
 	inline
 	ras::Grid<PixType>
 	realGridOf
-		( ras::Grid<uint8_t> const & uGrid
-			//!< Input source grid
+		( ras::GridView<SrcType> const & uView
+			//!< Input source data
 		, int const & treatAsNull = -1
-			//!< If value in range [0,255], then corresponding output is null
+			//!< If value in range [0,maxOf(SrcType)], output is null
+		, ras::GridLayout const & layout = {}
+			//!< Storage layout for the returned grid
 		)
 	{
-		typename ras::Grid<PixType> fGrid(uGrid.hwSize());
-		ras::Grid<uint8_t>::const_iterator inIter{ uGrid.cbegin() };
-		typename ras::Grid<PixType>::iterator outIter{ fGrid.begin() };
-		while (uGrid.cend() != inIter)
+		typename ras::Grid<PixType> fGrid(uView.hwSize(), layout);
+		constexpr int maxSrc{ std::numeric_limits<SrcType>::max() };
+		bool const checkForNull
+			{ (! (treatAsNull < 0)) && (! (maxSrc < treatAsNull)) };
+		SrcType const nullValue{ static_cast<SrcType>(treatAsNull) };
+		std::size_t const wide{ uView.wide() };
+		for (std::size_t row{0u} ; row < uView.high() ; ++row)
 		{
-			uint8_t const & inVal = *inIter;
-			PixType rtVal{ static_cast<PixType>(inVal) };
-			bool const checkForNull{ ! (treatAsNull < 0) };
+			SrcType const * const srcRow{ &(*(uView.cbeginRow(row))) };
+			PixType * const dstRow{ &(*(fGrid.beginRow(row))) };
+			simd::convertRow(srcRow, wide, dstRow);
 			if (checkForNull)
 			{
-				if (treatAsNull == inVal)
-				{
-					rtVal = std::numeric_limits<PixType>::quiet_NaN();
-				}
+				simd::nullifyRow(srcRow, wide, dstRow, nullValue);
 			}
-			*outIter = rtVal;
-			inIter++;
-			outIter++;
 		}
 		return fGrid;
 	}
 
+	//! \brief Convert grid elements (e.g. uint8_t, uint16_t) to float
+	template <typename PixType, typename SrcType>
+	inline
+	ras::Grid<PixType>
+	realGridOf
+		( ras::Grid<SrcType> const & uGrid
+			//!< Input source grid
+		, int const & treatAsNull = -1
+			//!< If value in range [0,maxOf(SrcType)], output is null
+		)
+	{
+		// Output uses same alignment as input (rows processed individually)
+		ras::GridLayout const layout{ uGrid.layout().theAlignBytes, 0u };
+		return realGridOf<PixType, SrcType>
+			(ras::GridView<SrcType>(uGrid), treatAsNull, layout);
+	}
+
+	/*! \brief Convert only the chipSpec region of uView to float.
+	 *
+	 * Equivalent to realGridOf(subGridValuesFrom(...)) but reads
+	 * source rows directly (i.e. without first converting or copying
+	 * the full source). Returns a null grid if chipSpec does not fit
+	 * within uView.
+	 *
+	 * \par Example
+	 * \snippet test/test_rasgrid.cpp DoxyExample08
+	 */
+	template <typename PixType, typename SrcType>
+	inline
+	ras::Grid<PixType>
+	realGridOf
+		( ras::GridView<SrcType> const & uView
+			//!< Input source data (e.g. full frame)
+		, ras::ChipSpec const & chipSpec
+			//!< Region within uView to convert
+		, int const & treatAsNull = -1
+			//!< If value in range [0,maxOf(SrcType)], output is null
+		, ras::GridLayout const & layout = {}
+			//!< Storage layout for the returned grid
+		)
+	{
+		ras::Grid<PixType> fGrid{};
+		ras::GridView<SrcType> const chipView{ uView.subViewFor(chipSpec) };
+		if (chipView.isValid())
+		{
+			fGrid = realGridOf<PixType, SrcType>
+				(chipView, treatAsNull, layout);
+		}
+		return fGrid;
+	}
+
+	//! \brief Convert only the chipSpec region of uGrid to float.
+	template <typename PixType, typename SrcType>
+	inline
+	ras::Grid<PixType>
+	realGridOf
+		( ras::Grid<SrcType> const & uGrid
+			//!< Input source grid (e.g. full frame)
+		, ras::ChipSpec const & chipSpec
+			//!< Region within uGrid to convert
+		, int const & treatAsNull = -1
+			//!< If value in range [0,maxOf(SrcType)], output is null
+		)
+	{
+		return realGridOf<PixType, SrcType>
+			(ras::GridView<SrcType>(uGrid), chipSpec, treatAsNull);
+	}
+
 	//! \brief A Larger grid produced with (nearest neighbor) up sampling.
 	template <typename PixType>
 	inline
@@ -338,11 +518,14 @@ namespace grid
 		)
 	{
 		ras::Grid<float> outGrid(gradGrid.hwSize());
-		std::transform
-			( gradGrid.cbegin(), gradGrid.cend()
-			, outGrid.begin()
-			, funcOfGrad
-			);
+		for (std::size_t row{0u} ; row < gradGrid.high() ; ++row)
+		{
+			std::transform
+				( gradGrid.cbeginRow(row), gradGrid.cendRow(row)
+				, outGrid.beginRow(row)
+				, funcOfGrad
+				);
+		}
 		return outGrid;
 	}
 
@@ -360,11 +543,15 @@ namespace grid
 	{
 		ras::Grid<uint8_t> ugrid{ fgrid.hwSize() };
 
-		typename ras::Grid<RealType>::const_iterator itIn{ fgrid.cbegin() };
-		ras::Grid<uint8_t>::iterator itOut{ ugrid.begin() };
-		while (ugrid.end() != itOut)
+		for (std::size_t row{0u} ; row < fgrid.high() ; ++row)
 		{
-			*itOut++ = pix::uPix8<RealType>(*itIn++, fSpan);
+			typename ras::Grid<RealType>::const_iterator itIn
+				{ fgrid.cbeginRow(row) };
+			ras::Grid<uint8_t>::iterator itOut{ ugrid.beginRow(row) };
+			while (ugrid.endRow(row) != itOut)
+			{
+				*itOut++ = pix::uPix8<RealType>(*itIn++, fSpan);
+			}
 		}
 		return ugrid;
 	}
@@ -466,11 +653,10 @@ namespace grid
 			ras::Grid<PixType> & grid = *ptGrid;
 
 			// find min max
-			using InIt = typename ras::Grid<PixType>::const_iterator;
-			std::pair<InIt, InIt> const iterMM
-				{ minmax_valid(grid.cbegin(), grid.cend()) };
-			PixType const min{ *(iterMM.first) };
-			PixType const max{ *(iterMM.second) };
+			std::pair<PixType, PixType> const minMax
+				{ validMinMaxValues(grid) };
+			PixType const min{ minMax.first };
+			PixType const max{ minMax.second };
 
 			// boundary clipping
 			img::Area const clipArea
@@ -676,19 +862,23 @@ namespace grid
 		return value;
 	}
 
-	//! Specialization of bilinValueAt() for uint8_t input grid data.
-	template <>
+	/*! Bilinear interpolation for unsigned integer grid data.
+	 *
+	 * Interpolation is performed in double precision and the result is
+	 * cast (truncated) back to the (integer) input grid type.
+	 */
+	template <typename UIntType>
 	inline
-	uint8_t
-	bilinValueAt
-		( ras::Grid<uint8_t> const & grid
+	UIntType
+	bilinValueAtUInt
+		( ras::Grid<UIntType> const & grid
 		, img::Spot const & atSpot
 		)
 	{
-		uint8_t value{ pix::null<uint8_t>() };
+		UIntType value{ pix::null<UIntType>() };
 
 		InterpBound const interBound
-			{ InterpBound::from<uint8_t>(grid, atSpot) };
+			{ InterpBound::from<UIntType>(grid, atSpot) };
 		if (interBound.isValid())
 		{
 			// get values at corners of interpolation boundary
@@ -710,12 +900,36 @@ namespace grid
 			double const val0{ dVal0 + valA };
 
 			// cast value back to input grid type
-			value = static_cast<uint8_t>(val0);
+			value = static_cast<UIntType>(val0);
 		}
 
 		return value;
 	}
 
+	//! Specialization of bilinValueAt() for uint8_t input grid data.
+	template <>
+	inline
+	uint8_t
+	bilinValueAt
+		( ras::Grid<uint8_t> const & grid
+		, img::Spot const & atSpot
+		)
+	{
+		return bilinValueAtUInt<uint8_t>(grid, atSpot);
+	}
+
+	//! Specialization of bilinValueAt() for uint16_t input grid data.
+	template <>
+	inline
+	uint16_t
+	bilinValueAt
+		( ras::Grid<uint16_t> const & grid
+		, img::Spot const & atSpot
+		)
+	{
+		return bilinValueAtUInt<uint16_t>(grid, atSpot);
+	}
+
 
 } // [grid]
 
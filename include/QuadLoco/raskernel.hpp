@@ -36,6 +36,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <vector>
 
 
 namespace quadloco
@@ -62,13 +63,19 @@ namespace kernel
 			};
 	}
 
-	//! A filter containing a (unit integral) Gaussian response
+	/*! \brief A filter containing a (unit integral) Gaussian response
+	 *
+	 * Filter values are proportional to exp(-r^2/sigma). Note that
+	 * sigma is not the standard deviation, which is sqrt(sigma/2).
+	 */
 	template <typename Type>
 	inline
 	ras::Grid<Type>
 	gauss
 		( std::size_t const & halfSize
+			//!< Filter size is 2*halfSize+1 in each direction
 		, double const & sigma
+			//!< Kernel exp(-r^2/sigma) parameter (stdDev is sqrt(sigma/2))
 		)
 	{
 		// minimum filter size is 1,1 (for halfSize of zero)
@@ -109,6 +116,46 @@ namespace kernel
 		return filter;
 	}
 
+	/*! \brief One dimensional (unit sum) Gaussian weights.
+	 *
+	 * Uses the same form as gauss() such that the outer product of
+	 * two of these is (to within roundoff) equal to gauss() for the
+	 * same halfSize and sigma. I.e. the 2D kernel is separable.
+	 */
+	template <typename Type>
+	inline
+	std::vector<Type>
+	gaussWeights
+		( std::size_t const & halfSize
+		, double const & sigma
+		)
+	{
+		std::vector<Type> weights(1u + 2u * halfSize);
+
+		// set initial (unweighted) values
+		double const xx0{ static_cast<double>(halfSize) };
+		std::vector<double> values(weights.size());
+		double sum{ 0. };
+		for (std::size_t nn{0u} ; nn < values.size() ; ++nn)
+		{
+			double const xx{ static_cast<double>(nn) - xx0 };
+			values[nn] = std::exp(-(xx*xx) / sigma);
+			sum += values[nn];
+		}
+
+		// normalize to unit sum
+		if (0. < sum)
+		{
+			double const scl{ 1. / sum };
+			for (std::size_t nn{0u} ; nn < values.size() ; ++nn)
+			{
+				weights[nn] = static_cast<Type>(scl * values[nn]);
+			}
+		}
+
+		return weights;
+	}
+
 } // [kernel]
 
 
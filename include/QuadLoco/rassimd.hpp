@@ -0,0 +1,1054 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::ras::simd (vectorized row kernels)
+ *
+ * Row kernels operate on contiguous runs of cells (e.g. one row of a
+ * ras::Grid or ras::GridView). Each kernel has a portable version plus
+ * (where available, ref sys::cpu) SSE2 and AVX2 versions. The public
+ * functions dispatch at runtime to the most capable supported version
+ * unless a specific level is requested (e.g. for testing).
+ */
+
+
+#include "QuadLoco/syscpu.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <type_traits>
+
+#if defined(QuadLoco_SIMD_X86)
+#	include <immintrin.h>
+#endif
+
+
+namespace quadloco
+{
+
+namespace ras
+{
+
+/*! \brief Vectorized (SIMD) kernels for processing runs of raster cells
+ */
+namespace simd
+{
+	//! Portable conversion of numElem source values to PixType
+	template <typename PixType, typename SrcType>
+	inline
+	void
+	convertRowScalar
+		( SrcType const * const & src
+		, std::size_t const & numElem
+		, PixType * const & dst
+		)
+	{
+		for (std::size_t ndx{0u} ; ndx < numElem ; ++ndx)
+		{
+			dst[ndx] = static_cast<PixType>(src[ndx]);
+		}
+	}
+
+#if defined(QuadLoco_SIMD_X86)
+
+	//! SSE2 conversion of uint8_t to float (16 values per step)
+	inline
+	void
+	convertRowSSE2
+		( std::uint8_t const * const & src
+		, std::size_t const & numElem
+		, float * const & dst
+		)
+	{
+		__m128i const zero{ _mm_setzero_si128() };
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 16u) <= numElem ; ndx += 16u)
+		{
+			__m128i const u8s{ _mm_loadu_si128
+				(reinterpret_cast<__m128i const *>(src + ndx)) };
+			__m128i const u16Lo{ _mm_unpacklo_epi8(u8s, zero) };
+			__m128i const u16Hi{ _mm_unpackhi_epi8(u8s, zero) };
+			_mm_storeu_ps
+				( dst + ndx + 0u
+				, _mm_cvtepi32_ps(_mm_unpacklo_epi16(u16Lo, zero))
+				);
+			_mm_storeu_ps
+				( dst + ndx + 4u
+				, _mm_cvtepi32_ps(_mm_unpackhi_epi16(u16Lo, zero))
+				);
+			_mm_storeu_ps
+				( dst + ndx + 8u
+				, _mm_cvtepi32_ps(_mm_unpacklo_epi16(u16Hi, zero))
+				);
+			_mm_storeu_ps
+				( dst + ndx + 12u
+				, _mm_cvtepi32_ps(_mm_unpackhi_epi16(u16Hi, zero))
+				);
+		}
+		convertRowScalar(src + ndx, numElem - ndx, dst + ndx);
+	}
+
+	//! SSE2 conversion of uint16_t to float (8 values per step)
+	inline
+	void
+	convertRowSSE2
+		( std::uint16_t const * const & src
+		, std::size_t const & numElem
+		, float * const & dst
+		)
+	{
+		__m128i const zero{ _mm_setzero_si128() };
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 8u) <= numElem ; ndx += 8u)
+		{
+			__m128i const u16s{ _mm_loadu_si128
+				(reinterpret_cast<__m128i const *>(src + ndx)) };
+			_mm_storeu_ps
+				( dst + ndx + 0u
+				, _mm_cvtepi32_ps(_mm_unpacklo_epi16(u16s, zero))
+				);
+			_mm_storeu_ps
+				( dst + ndx + 4u
+				, _mm_cvtepi32_ps(_mm_unpackhi_epi16(u16s, zero))
+				);
+		}
+		convertRowScalar(src + ndx, numElem - ndx, dst + ndx);
+	}
+
+	//! AVX2 conversion of uint8_t to float (16 values per step)
+	__attribute__((target("avx2")))
+	inline
+	void
+	convertRowAVX2
+		( std::uint8_t const * const & src
+		, std::size_t const & numElem
+		, float * const & dst
+		)
+	{
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 16u) <= numElem ; ndx += 16u)
+		{
+			__m128i const u8s{ _mm_loadu_si128
+				(reinterpret_cast<__m128i const *>(src + ndx)) };
+			_mm256_storeu_ps
+				( dst + ndx + 0u
+				, _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(u8s))
+				);
+			_mm256_storeu_ps
+				( dst + ndx + 8u
+				, _mm256_cvtepi32_ps
+					(_mm256_cvtepu8_epi32(_mm_srli_si128(u8s, 8)))
+				);
+		}
+		convertRowScalar(src + ndx, numElem - ndx, dst + ndx);
+	}
+
+	//! AVX2 conversion of uint16_t to float (16 values per step)
+	__attribute__((target("avx2")))
+	inline
+	void
+	convertRowAVX2
+		( std::uint16_t const * const & src
+		, std::size_t const & numElem
+		, float * const & dst
+		)
+	{
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 16u) <= numElem ; ndx += 16u)
+		{
+			__m128i const u16Lo{ _mm_loadu_si128
+				(reinterpret_cast<__m128i const *>(src + ndx)) };
+			__m128i const u16Hi{ _mm_loadu_si128
+				(reinterpret_cast<__m128i const *>(src + ndx + 8u)) };
+			_mm256_storeu_ps
+				( dst + ndx + 0u
+				, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(u16Lo))
+				);
+			_mm256_storeu_ps
+				( dst + ndx + 8u
+				, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(u16Hi))
+				);
+		}
+		convertRowScalar(src + ndx, numElem - ndx, dst + ndx);
+	}
+
+#endif // QuadLoco_SIMD_X86
+
+	/*! \brief Convert numElem source values to PixType values in dst.
+	 *
+	 * Vector code paths are used for float output from uint8_t or
+	 * uint16_t sources (other combinations use portable code). The
+	 * level argument limits the instruction set used (e.g. for testing)
+	 * and is reduced to the level supported by the processor.
+	 */
+	template <typename PixType, typename SrcType>
+	inline
+	void
+	convertRow
+		( SrcType const * const & src
+			//!< Start of source values
+		, std::size_t const & numElem
+			//!< Number of values to convert
+		, PixType * const & dst
+			//!< Start of destination (must not overlap with source)
+		, sys::cpu::SimdLevel const & level = sys::cpu::simdLevel()
+			//!< Most capable instruction set to use
+		)
+	{
+		bool done{ false };
+#	if defined(QuadLoco_SIMD_X86)
+		if constexpr
+			(  std::is_same_v<PixType, float>
+			&& (  std::is_same_v<SrcType, std::uint8_t>
+			   || std::is_same_v<SrcType, std::uint16_t>
+			   )
+			)
+		{
+			using sys::cpu::SimdLevel;
+			if ( (SimdLevel::AVX2 == level)
+			  && sys::cpu::supports(SimdLevel::AVX2)
+			   )
+			{
+				convertRowAVX2(src, numElem, dst);
+				done = true;
+			}
+			else
+			if (! (SimdLevel::Scalar == level))
+			{
+				convertRowSSE2(src, numElem, dst);
+				done = true;
+			}
+		}
+#	else
+		(void)level;
+#	endif
+		if (! done)
+		{
+			convertRowScalar(src, numElem, dst);
+		}
+	}
+
+	/*! \brief Set dst to NaN everywhere that src is equal to nullValue.
+	 *
+	 * Written as simple (branch free) loop for compiler vectorization.
+	 */
+	template <typename PixType, typename SrcType>
+	inline
+	void
+	nullifyRow
+		( SrcType const * const & src
+			//!< Start of source values
+		, std::size_t const & numElem
+			//!< Number of values to check
+		, PixType * const & dst
+			//!< Start of destination values (e.g. from convertRow())
+		, SrcType const & nullValue
+			//!< Source value that indicates null
+		)
+	{
+		constexpr PixType nan{ std::numeric_limits<PixType>::quiet_NaN() };
+		for (std::size_t ndx{0u} ; ndx < numElem ; ++ndx)
+		{
+			dst[ndx] = (nullValue == src[ndx]) ? nan : dst[ndx];
+		}
+	}
+
+	//! Filter weights used by gradientRowBy8x() (ref opsgrid.hpp)
+	struct GradWeights8x
+	{
+		//! Corner weight (1/sqrt(2) relative to edge) - normalized
+		static constexpr float theCorner
+			{ float((1./std::numbers::sqrt2_v<double>)
+				/ (4.*(1./std::numbers::sqrt2_v<double>) + 2.))
+			};
+
+		//! Edge weight - normalized
+		static constexpr float theEdge
+			{ float(1. / (4.*(1./std::numbers::sqrt2_v<double>) + 2.)) };
+	};
+
+	//! Portable evaluation of 8-neighbor gradient along a row
+	inline
+	void
+	gradientRowBy8xScalar
+		( float const * const & rowT
+		, float const * const & rowM
+		, float const * const & rowB
+		, std::size_t const & numElem
+		, float * const & gRow
+		, float * const & gCol
+		)
+	{
+		constexpr float wC{ GradWeights8x::theCorner };
+		constexpr float wE{ GradWeights8x::theEdge };
+		for (std::size_t ndx{0u} ; ndx < numElem ; ++ndx)
+		{
+			float const * const pT{ rowT + ndx };
+			float const * const pM{ rowM + ndx };
+			float const * const pB{ rowB + ndx };
+			gRow[ndx]
+				= wC * (pB[0] - pT[0])
+				+ wE * (pB[1] - pT[1])
+				+ wC * (pB[2] - pT[2]);
+			gCol[ndx]
+				= wC * (pT[2] - pT[0])
+				+ wE * (pM[2] - pM[0])
+				+ wC * (pB[2] - pB[0]);
+		}
+	}
+
+#if defined(QuadLoco_SIMD_X86)
+
+	//! SSE2 evaluation of 8-neighbor gradient along a row (4 per step)
+	inline
+	void
+	gradientRowBy8xSSE2
+		( float const * const & rowT
+		, float const * const & rowM
+		, float const * const & rowB
+		, std::size_t const & numElem
+		, float * const & gRow
+		, float * const & gCol
+		)
+	{
+		__m128 const wC{ _mm_set1_ps(GradWeights8x::theCorner) };
+		__m128 const wE{ _mm_set1_ps(GradWeights8x::theEdge) };
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 4u) <= numElem ; ndx += 4u)
+		{
+			__m128 const T0{ _mm_loadu_ps(rowT + ndx) };
+			__m128 const T1{ _mm_loadu_ps(rowT + ndx + 1u) };
+			__m128 const T2{ _mm_loadu_ps(rowT + ndx + 2u) };
+			__m128 const M0{ _mm_loadu_ps(rowM + ndx) };
+			__m128 const M2{ _mm_loadu_ps(rowM + ndx + 2u) };
+			__m128 const B0{ _mm_loadu_ps(rowB + ndx) };
+			__m128 const B1{ _mm_loadu_ps(rowB + ndx + 1u) };
+			__m128 const B2{ _mm_loadu_ps(rowB + ndx + 2u) };
+			__m128 const valRow
+				{ _mm_add_ps
+					( _mm_add_ps
+						( _mm_mul_ps(wC, _mm_sub_ps(B0, T0))
+						, _mm_mul_ps(wE, _mm_sub_ps(B1, T1))
+						)
+					, _mm_mul_ps(wC, _mm_sub_ps(B2, T2))
+					)
+				};
+			__m128 const valCol
+				{ _mm_add_ps
+					( _mm_add_ps
+						( _mm_mul_ps(wC, _mm_sub_ps(T2, T0))
+						, _mm_mul_ps(wE, _mm_sub_ps(M2, M0))
+						)
+					, _mm_mul_ps(wC, _mm_sub_ps(B2, B0))
+					)
+				};
+			_mm_storeu_ps(gRow + ndx, valRow);
+			_mm_storeu_ps(gCol + ndx, valCol);
+		}
+		gradientRowBy8xScalar
+			( rowT + ndx, rowM + ndx, rowB + ndx
+			, numElem - ndx, gRow + ndx, gCol + ndx
+			);
+	}
+
+	//! AVX2 evaluation of 8-neighbor gradient along a row (8 per step)
+	__attribute__((target("avx2")))
+	inline
+	void
+	gradientRowBy8xAVX2
+		( float const * const & rowT
+		, float const * const & rowM
+		, float const * const & rowB
+		, std::size_t const & numElem
+		, float * const & gRow
+		, float * const & gCol
+		)
+	{
+		__m256 const wC{ _mm256_set1_ps(GradWeights8x::theCorner) };
+		__m256 const wE{ _mm256_set1_ps(GradWeights8x::theEdge) };
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 8u) <= numElem ; ndx += 8u)
+		{
+			__m256 const T0{ _mm256_loadu_ps(rowT + ndx) };
+			__m256 const T1{ _mm256_loadu_ps(rowT + ndx + 1u) };
+			__m256 const T2{ _mm256_loadu_ps(rowT + ndx + 2u) };
+			__m256 const M0{ _mm256_loadu_ps(rowM + ndx) };
+			__m256 const M2{ _mm256_loadu_ps(rowM + ndx + 2u) };
+			__m256 const B0{ _mm256_loadu_ps(rowB + ndx) };
+			__m256 const B1{ _mm256_loadu_ps(rowB + ndx + 1u) };
+			__m256 const B2{ _mm256_loadu_ps(rowB + ndx + 2u) };
+			__m256 const valRow
+				{ _mm256_add_ps
+					( _mm256_add_ps
+						( _mm256_mul_ps(wC, _mm256_sub_ps(B0, T0))
+						, _mm256_mul_ps(wE, _mm256_sub_ps(B1, T1))
+						)
+					, _mm256_mul_ps(wC, _mm256_sub_ps(B2, T2))
+					)
+				};
+			__m256 const valCol
+				{ _mm256_add_ps
+					( _mm256_add_ps
+						( _mm256_mul_ps(wC, _mm256_sub_ps(T2, T0))
+						, _mm256_mul_ps(wE, _mm256_sub_ps(M2, M0))
+						)
+					, _mm256_mul_ps(wC, _mm256_sub_ps(B2, B0))
+					)
+				};
+			_mm256_storeu_ps(gRow + ndx, valRow);
+			_mm256_storeu_ps(gCol + ndx, valCol);
+		}
+		gradientRowBy8xScalar
+			( rowT + ndx, rowM + ndx, rowB + ndx
+			, numElem - ndx, gRow + ndx, gCol + ndx
+			);
+	}
+
+#endif // QuadLoco_SIMD_X86
+
+	/*! \brief Eight neighbor gradient components for numElem cells.
+	 *
+	 * Computes the (float precision) equivalent of
+	 * ops::grid::responseGradientBy8x() for numElem consecutive cells.
+	 * The rowT, rowM and rowB pointers refer to the cell *left* of the
+	 * first output cell in the rows above, at and below the output row
+	 * (i.e. numElem+2 values are read from each row). Results are
+	 * written into separate row (gRow) and column (gCol) component
+	 * arrays.
+	 *
+	 * All levels perform the same arithmetic operations in the same
+	 * order (no fused multiply-add) and therefore produce identical
+	 * values.
+	 */
+	inline
+	void
+	gradientRowBy8x
+		( float const * const & rowT
+			//!< Row above (starting at column left of first output)
+		, float const * const & rowM
+			//!< Row through output cells (starting left of first output)
+		, float const * const & rowB
+			//!< Row below (starting at column left of first output)
+		, std::size_t const & numElem
+			//!< Number of output cells
+		, float * const & gRow
+			//!< Row direction gradient components (numElem values)
+		, float * const & gCol
+			//!< Column direction gradient components (numElem values)
+		, sys::cpu::SimdLevel const & level = sys::cpu::simdLevel()
+			//!< Most capable instruction set to use
+		)
+	{
+#	if defined(QuadLoco_SIMD_X86)
+		using sys::cpu::SimdLevel;
+		if ( (SimdLevel::AVX2 == level)
+		  && sys::cpu::supports(SimdLevel::AVX2)
+		   )
+		{
+			gradientRowBy8xAVX2(rowT, rowM, rowB, numElem, gRow, gCol);
+		}
+		else
+		if (! (SimdLevel::Scalar == level))
+		{
+			gradientRowBy8xSSE2(rowT, rowM, rowB, numElem, gRow, gCol);
+		}
+		else
+		{
+			gradientRowBy8xScalar(rowT, rowM, rowB, numElem, gRow, gCol);
+		}
+#	else
+		(void)level;
+		gradientRowBy8xScalar(rowT, rowM, rowB, numElem, gRow, gCol);
+#	endif
+	}
+
+	/*! \brief Portable accumulation of ring pair statistics along a row
+	 *
+	 * Ref ringPairStatsRow().
+	 */
+	inline
+	void
+	ringPairStatsRowScalar
+		( float const * const & srcBeg
+		, std::size_t const & numElem
+		, std::ptrdiff_t const * const & offsets1
+		, std::ptrdiff_t const * const & offsets2
+		, std::size_t const & numPairs
+		, float const & midValue
+		, float * const & mins
+		, float * const & maxs
+		, double * const & sumSqDifs
+		, std::uint32_t * const & numNegs
+		)
+	{
+		constexpr float big{ std::numeric_limits<float>::infinity() };
+		for (std::size_t ndx{0u} ; ndx < numElem ; ++ndx)
+		{
+			float const * const src{ srcBeg + ndx };
+			float min{ big };
+			float max{ -big };
+			double sumSqDif{ 0. };
+			std::uint32_t numNeg{ 0u };
+			for (std::size_t nn{0u} ; nn < numPairs ; ++nn)
+			{
+				float const delta1{ src[offsets1[nn]] - midValue };
+				float const delta2{ src[offsets2[nn]] - midValue };
+				min = std::min(min, std::min(delta1, delta2));
+				max = std::max(max, std::max(delta1, delta2));
+				double const valDif{ (double)delta2 - (double)delta1 };
+				sumSqDif += valDif * valDif;
+				if ((delta1 + delta2) < 0.f)
+				{
+					++numNeg;
+				}
+			}
+			mins[ndx] = min;
+			maxs[ndx] = max;
+			sumSqDifs[ndx] = sumSqDif;
+			numNegs[ndx] = numNeg;
+		}
+	}
+
+#if defined(QuadLoco_SIMD_X86)
+
+	//! SSE2 accumulation of ring pair statistics (4 cells per step)
+	inline
+	void
+	ringPairStatsRowSSE2
+		( float const * const & srcBeg
+		, std::size_t const & numElem
+		, std::ptrdiff_t const * const & offsets1
+		, std::ptrdiff_t const * const & offsets2
+		, std::size_t const & numPairs
+		, float const & midValue
+		, float * const & mins
+		, float * const & maxs
+		, double * const & sumSqDifs
+		, std::uint32_t * const & numNegs
+		)
+	{
+		constexpr float big{ std::numeric_limits<float>::infinity() };
+		__m128 const mid{ _mm_set1_ps(midValue) };
+		__m128 const zero{ _mm_setzero_ps() };
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 4u) <= numElem ; ndx += 4u)
+		{
+			float const * const src{ srcBeg + ndx };
+			__m128 min{ _mm_set1_ps(big) };
+			__m128 max{ _mm_set1_ps(-big) };
+			__m128d sumLo{ _mm_setzero_pd() };
+			__m128d sumHi{ _mm_setzero_pd() };
+			__m128i numNeg{ _mm_setzero_si128() };
+			for (std::size_t nn{0u} ; nn < numPairs ; ++nn)
+			{
+				__m128 const delta1
+					{ _mm_sub_ps(_mm_loadu_ps(src + offsets1[nn]), mid) };
+				__m128 const delta2
+					{ _mm_sub_ps(_mm_loadu_ps(src + offsets2[nn]), mid) };
+				min = _mm_min_ps(min, _mm_min_ps(delta1, delta2));
+				max = _mm_max_ps(max, _mm_max_ps(delta1, delta2));
+				__m128d const difLo
+					{ _mm_sub_pd(_mm_cvtps_pd(delta2), _mm_cvtps_pd(delta1)) };
+				__m128d const difHi
+					{ _mm_sub_pd
+						( _mm_cvtps_pd(_mm_movehl_ps(delta2, delta2))
+						, _mm_cvtps_pd(_mm_movehl_ps(delta1, delta1))
+						)
+					};
+				sumLo = _mm_add_pd(sumLo, _mm_mul_pd(difLo, difLo));
+				sumHi = _mm_add_pd(sumHi, _mm_mul_pd(difHi, difHi));
+				// (all bits set) mask is -1 as integer
+				__m128 const isNeg
+					{ _mm_cmplt_ps(_mm_add_ps(delta1, delta2), zero) };
+				numNeg = _mm_sub_epi32(numNeg, _mm_castps_si128(isNeg));
+			}
+			_mm_storeu_ps(mins + ndx, min);
+			_mm_storeu_ps(maxs + ndx, max);
+			_mm_storeu_pd(sumSqDifs + ndx, sumLo);
+			_mm_storeu_pd(sumSqDifs + ndx + 2u, sumHi);
+			_mm_storeu_si128
+				(reinterpret_cast<__m128i *>(numNegs + ndx), numNeg);
+		}
+		ringPairStatsRowScalar
+			( srcBeg + ndx, numElem - ndx, offsets1, offsets2, numPairs
+			, midValue, mins + ndx, maxs + ndx, sumSqDifs + ndx, numNegs + ndx
+			);
+	}
+
+	//! AVX2 accumulation of ring pair statistics (8 cells per step)
+	__attribute__((target("avx2")))
+	inline
+	void
+	ringPairStatsRowAVX2
+		( float const * const & srcBeg
+		, std::size_t const & numElem
+		, std::ptrdiff_t const * const & offsets1
+		, std::ptrdiff_t const * const & offsets2
+		, std::size_t const & numPairs
+		, float const & midValue
+		, float * const & mins
+		, float * const & maxs
+		, double * const & sumSqDifs
+		, std::uint32_t * const & numNegs
+		)
+	{
+		constexpr float big{ std::numeric_limits<float>::infinity() };
+		__m256 const mid{ _mm256_set1_ps(midValue) };
+		__m256 const zero{ _mm256_setzero_ps() };
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 8u) <= numElem ; ndx += 8u)
+		{
+			float const * const src{ srcBeg + ndx };
+			__m256 min{ _mm256_set1_ps(big) };
+			__m256 max{ _mm256_set1_ps(-big) };
+			__m256d sumLo{ _mm256_setzero_pd() };
+			__m256d sumHi{ _mm256_setzero_pd() };
+			__m256i numNeg{ _mm256_setzero_si256() };
+			for (std::size_t nn{0u} ; nn < numPairs ; ++nn)
+			{
+				__m256 const delta1
+					{ _mm256_sub_ps(_mm256_loadu_ps(src + offsets1[nn]), mid) };
+				__m256 const delta2
+					{ _mm256_sub_ps(_mm256_loadu_ps(src + offsets2[nn]), mid) };
+				min = _mm256_min_ps(min, _mm256_min_ps(delta1, delta2));
+				max = _mm256_max_ps(max, _mm256_max_ps(delta1, delta2));
+				__m256d const difLo
+					{ _mm256_sub_pd
+						( _mm256_cvtps_pd(_mm256_castps256_ps128(delta2))
+						, _mm256_cvtps_pd(_mm256_castps256_ps128(delta1))
+						)
+					};
+				__m256d const difHi
+					{ _mm256_sub_pd
+						( _mm256_cvtps_pd(_mm256_extractf128_ps(delta2, 1))
+						, _mm256_cvtps_pd(_mm256_extractf128_ps(delta1, 1))
+						)
+					};
+				sumLo = _mm256_add_pd(sumLo, _mm256_mul_pd(difLo, difLo));
+				sumHi = _mm256_add_pd(sumHi, _mm256_mul_pd(difHi, difHi));
+				// (all bits set) mask is -1 as integer
+				__m256 const isNeg
+					{ _mm256_cmp_ps
+						(_mm256_add_ps(delta1, delta2), zero, _CMP_LT_OQ)
+					};
+				numNeg = _mm256_sub_epi32(numNeg, _mm256_castps_si256(isNeg));
+			}
+			_mm256_storeu_ps(mins + ndx, min);
+			_mm256_storeu_ps(maxs + ndx, max);
+			_mm256_storeu_pd(sumSqDifs + ndx, sumLo);
+			_mm256_storeu_pd(sumSqDifs + ndx + 4u, sumHi);
+			_mm256_storeu_si256
+				(reinterpret_cast<__m256i *>(numNegs + ndx), numNeg);
+		}
+		ringPairStatsRowScalar
+			( srcBeg + ndx, numElem - ndx, offsets1, offsets2, numPairs
+			, midValue, mins + ndx, maxs + ndx, sumSqDifs + ndx, numNegs + ndx
+			);
+	}
+
+#endif // QuadLoco_SIMD_X86
+
+	/*! \brief Statistics of opposite ring pair values for numElem cells.
+	 *
+	 * For each of numElem consecutive (output) cells starting with the
+	 * one at srcBeg, the ring of numPairs source value pairs at linear
+	 * offsets (offsets1[nn], offsets2[nn]) from the cell is considered.
+	 * With deltas (value - midValue) for each pair member, results are:
+	 * \arg mins, maxs: Min/max of all deltas in the ring
+	 * \arg sumSqDifs: Sum of squared (delta2 - delta1) in double
+	 * \arg numNegs: Number of pairs with (delta1 + delta2) < 0
+	 *
+	 * Adjacent cells use adjacent source values for each ring sample,
+	 * so vector versions evaluate several cells per (unaligned) load.
+	 * All source values must be valid (not null). All levels produce
+	 * identical values (sums are accumulated in the same order).
+	 */
+	inline
+	void
+	ringPairStatsRow
+		( float const * const & srcBeg
+			//!< Source value at first output cell
+		, std::size_t const & numElem
+			//!< Number of (consecutive) output cells
+		, std::ptrdiff_t const * const & offsets1
+			//!< Linear offsets (dRow*rowStride + dCol) to first of pairs
+		, std::ptrdiff_t const * const & offsets2
+			//!< Linear offsets to (radially opposite) second of pairs
+		, std::size_t const & numPairs
+			//!< Number of values in offsets1 (and in offsets2)
+		, float const & midValue
+			//!< Value subtracted from source values
+		, float * const & mins
+			//!< Minimum delta (numElem values)
+		, float * const & maxs
+			//!< Maximum delta (numElem values)
+		, double * const & sumSqDifs
+			//!< Sum of squared pair differences (numElem values)
+		, std::uint32_t * const & numNegs
+			//!< Number of pairs with negative sum (numElem values)
+		, sys::cpu::SimdLevel const & level = sys::cpu::simdLevel()
+			//!< Most capable instruction set to use
+		)
+	{
+#	if defined(QuadLoco_SIMD_X86)
+		using sys::cpu::SimdLevel;
+		if ( (SimdLevel::AVX2 == level)
+		  && sys::cpu::supports(SimdLevel::AVX2)
+		   )
+		{
+			ringPairStatsRowAVX2
+				( srcBeg, numElem, offsets1, offsets2, numPairs, midValue
+				, mins, maxs, sumSqDifs, numNegs
+				);
+		}
+		else
+		if (! (SimdLevel::Scalar == level))
+		{
+			ringPairStatsRowSSE2
+				( srcBeg, numElem, offsets1, offsets2, numPairs, midValue
+				, mins, maxs, sumSqDifs, numNegs
+				);
+		}
+		else
+		{
+			ringPairStatsRowScalar
+				( srcBeg, numElem, offsets1, offsets2, numPairs, midValue
+				, mins, maxs, sumSqDifs, numNegs
+				);
+		}
+#	else
+		(void)level;
+		ringPairStatsRowScalar
+			( srcBeg, numElem, offsets1, offsets2, numPairs, midValue
+			, mins, maxs, sumSqDifs, numNegs
+			);
+#	endif
+	}
+
+	/*! \brief Scalar accumulation of ring pair statistics at scattered cells.
+	 *
+	 * Ref ringPairStatsCells().
+	 */
+	inline
+	void
+	ringPairStatsCellsScalar
+		( float const * const & srcOrig
+		, std::ptrdiff_t const * const & cellOffsets
+		, std::size_t const & numElem
+		, std::ptrdiff_t const * const & offsets1
+		, std::ptrdiff_t const * const & offsets2
+		, std::size_t const & numPairs
+		, float const & midValue
+		, float * const & mins
+		, float * const & maxs
+		, double * const & sumSqDifs
+		, std::uint32_t * const & numNegs
+		)
+	{
+		for (std::size_t ndx{0u} ; ndx < numElem ; ++ndx)
+		{
+			ringPairStatsRowScalar
+				( srcOrig + cellOffsets[ndx], 1u
+				, offsets1, offsets2, numPairs, midValue
+				, mins + ndx, maxs + ndx, sumSqDifs + ndx, numNegs + ndx
+				);
+		}
+	}
+
+#if defined(QuadLoco_SIMD_X86)
+
+	//! SSE2 accumulation of ring pair statistics (4 cells per step)
+	inline
+	void
+	ringPairStatsCellsSSE2
+		( float const * const & srcOrig
+		, std::ptrdiff_t const * const & cellOffsets
+		, std::size_t const & numElem
+		, std::ptrdiff_t const * const & offsets1
+		, std::ptrdiff_t const * const & offsets2
+		, std::size_t const & numPairs
+		, float const & midValue
+		, float * const & mins
+		, float * const & maxs
+		, double * const & sumSqDifs
+		, std::uint32_t * const & numNegs
+		)
+	{
+		constexpr float big{ std::numeric_limits<float>::infinity() };
+		__m128 const mid{ _mm_set1_ps(midValue) };
+		__m128 const zero{ _mm_setzero_ps() };
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 4u) <= numElem ; ndx += 4u)
+		{
+			float const * const src0{ srcOrig + cellOffsets[ndx] };
+			float const * const src1{ srcOrig + cellOffsets[ndx + 1u] };
+			float const * const src2{ srcOrig + cellOffsets[ndx + 2u] };
+			float const * const src3{ srcOrig + cellOffsets[ndx + 3u] };
+			__m128 min{ _mm_set1_ps(big) };
+			__m128 max{ _mm_set1_ps(-big) };
+			__m128d sumLo{ _mm_setzero_pd() };
+			__m128d sumHi{ _mm_setzero_pd() };
+			__m128i numNeg{ _mm_setzero_si128() };
+			for (std::size_t nn{0u} ; nn < numPairs ; ++nn)
+			{
+				std::ptrdiff_t const & off1 = offsets1[nn];
+				std::ptrdiff_t const & off2 = offsets2[nn];
+				__m128 const val1
+					{ _mm_setr_ps
+						(src0[off1], src1[off1], src2[off1], src3[off1])
+					};
+				__m128 const val2
+					{ _mm_setr_ps
+						(src0[off2], src1[off2], src2[off2], src3[off2])
+					};
+				__m128 const delta1{ _mm_sub_ps(val1, mid) };
+				__m128 const delta2{ _mm_sub_ps(val2, mid) };
+				min = _mm_min_ps(min, _mm_min_ps(delta1, delta2));
+				max = _mm_max_ps(max, _mm_max_ps(delta1, delta2));
+				__m128d const difLo
+					{ _mm_sub_pd(_mm_cvtps_pd(delta2), _mm_cvtps_pd(delta1)) };
+				__m128d const difHi
+					{ _mm_sub_pd
+						( _mm_cvtps_pd(_mm_movehl_ps(delta2, delta2))
+						, _mm_cvtps_pd(_mm_movehl_ps(delta1, delta1))
+						)
+					};
+				sumLo = _mm_add_pd(sumLo, _mm_mul_pd(difLo, difLo));
+				sumHi = _mm_add_pd(sumHi, _mm_mul_pd(difHi, difHi));
+				// (all bits set) mask is -1 as integer
+				__m128 const isNeg
+					{ _mm_cmplt_ps(_mm_add_ps(delta1, delta2), zero) };
+				numNeg = _mm_sub_epi32(numNeg, _mm_castps_si128(isNeg));
+			}
+			_mm_storeu_ps(mins + ndx, min);
+			_mm_storeu_ps(maxs + ndx, max);
+			_mm_storeu_pd(sumSqDifs + ndx, sumLo);
+			_mm_storeu_pd(sumSqDifs + ndx + 2u, sumHi);
+			_mm_storeu_si128
+				(reinterpret_cast<__m128i *>(numNegs + ndx), numNeg);
+		}
+		ringPairStatsCellsScalar
+			( srcOrig, cellOffsets + ndx, numElem - ndx
+			, offsets1, offsets2, numPairs
+			, midValue, mins + ndx, maxs + ndx, sumSqDifs + ndx, numNegs + ndx
+			);
+	}
+
+	//! Gather 8 values at srcOrig[cell offsets (lo,hi) + offset]
+	__attribute__((target("avx2")))
+	inline
+	__m256
+	gatherCellsAVX2
+		( float const * const & srcOrig
+		, __m256i const & cellsLo
+		, __m256i const & cellsHi
+		, std::ptrdiff_t const & offset
+		)
+	{
+		__m256i const off{ _mm256_set1_epi64x((long long)offset) };
+		__m128 const valLo
+			{ _mm256_i64gather_ps(srcOrig, _mm256_add_epi64(cellsLo, off), 4) };
+		__m128 const valHi
+			{ _mm256_i64gather_ps(srcOrig, _mm256_add_epi64(cellsHi, off), 4) };
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(valLo), valHi, 1);
+	}
+
+	//! AVX2 accumulation of ring pair statistics (8 gathered cells per step)
+	__attribute__((target("avx2")))
+	inline
+	void
+	ringPairStatsCellsAVX2
+		( float const * const & srcOrig
+		, std::ptrdiff_t const * const & cellOffsets
+		, std::size_t const & numElem
+		, std::ptrdiff_t const * const & offsets1
+		, std::ptrdiff_t const * const & offsets2
+		, std::size_t const & numPairs
+		, float const & midValue
+		, float * const & mins
+		, float * const & maxs
+		, double * const & sumSqDifs
+		, std::uint32_t * const & numNegs
+		)
+	{
+		static_assert(8u == sizeof(std::ptrdiff_t));
+		constexpr float big{ std::numeric_limits<float>::infinity() };
+		__m256 const mid{ _mm256_set1_ps(midValue) };
+		__m256 const zero{ _mm256_setzero_ps() };
+		std::size_t ndx{ 0u };
+		for ( ; (ndx + 8u) <= numElem ; ndx += 8u)
+		{
+			__m256i const cellsLo
+				{ _mm256_loadu_si256
+					(reinterpret_cast<__m256i const *>(cellOffsets + ndx))
+				};
+			__m256i const cellsHi
+				{ _mm256_loadu_si256
+					(reinterpret_cast<__m256i const *>(cellOffsets + ndx + 4u))
+				};
+			__m256 min{ _mm256_set1_ps(big) };
+			__m256 max{ _mm256_set1_ps(-big) };
+			__m256d sumLo{ _mm256_setzero_pd() };
+			__m256d sumHi{ _mm256_setzero_pd() };
+			__m256i numNeg{ _mm256_setzero_si256() };
+			for (std::size_t nn{0u} ; nn < numPairs ; ++nn)
+			{
+				__m256 const val1
+					{ gatherCellsAVX2
+						(srcOrig, cellsLo, cellsHi, offsets1[nn])
+					};
+				__m256 const val2
+					{ gatherCellsAVX2
+						(srcOrig, cellsLo, cellsHi, offsets2[nn])
+					};
+				__m256 const delta1{ _mm256_sub_ps(val1, mid) };
+				__m256 const delta2{ _mm256_sub_ps(val2, mid) };
+				min = _mm256_min_ps(min, _mm256_min_ps(delta1, delta2));
+				max = _mm256_max_ps(max, _mm256_max_ps(delta1, delta2));
+				__m256d const difLo
+					{ _mm256_sub_pd
+						( _mm256_cvtps_pd(_mm256_castps256_ps128(delta2))
+						, _mm256_cvtps_pd(_mm256_castps256_ps128(delta1))
+						)
+					};
+				__m256d const difHi
+					{ _mm256_sub_pd
+						( _mm256_cvtps_pd(_mm256_extractf128_ps(delta2, 1))
+						, _mm256_cvtps_pd(_mm256_extractf128_ps(delta1, 1))
+						)
+					};
+				sumLo = _mm256_add_pd(sumLo, _mm256_mul_pd(difLo, difLo));
+				sumHi = _mm256_add_pd(sumHi, _mm256_mul_pd(difHi, difHi));
+				// (all bits set) mask is -1 as integer
+				__m256 const isNeg
+					{ _mm256_cmp_ps
+						(_mm256_add_ps(delta1, delta2), zero, _CMP_LT_OQ)
+					};
+				numNeg = _mm256_sub_epi32(numNeg, _mm256_castps_si256(isNeg));
+			}
+			_mm256_storeu_ps(mins + ndx, min);
+			_mm256_storeu_ps(maxs + ndx, max);
+			_mm256_storeu_pd(sumSqDifs + ndx, sumLo);
+			_mm256_storeu_pd(sumSqDifs + ndx + 4u, sumHi);
+			_mm256_storeu_si256
+				(reinterpret_cast<__m256i *>(numNegs + ndx), numNeg);
+		}
+		ringPairStatsCellsScalar
+			( srcOrig, cellOffsets + ndx, numElem - ndx
+			, offsets1, offsets2, numPairs
+			, midValue, mins + ndx, maxs + ndx, sumSqDifs + ndx, numNegs + ndx
+			);
+	}
+
+#endif // QuadLoco_SIMD_X86
+
+	/*! \brief Statistics of opposite ring pair values at scattered cells.
+	 *
+	 * Same as ringPairStatsRow() except that output cell ndx is at
+	 * (linear offset) srcOrig + cellOffsets[ndx] rather than at
+	 * consecutive source locations. Vector versions evaluate several
+	 * cells at once (using gathered loads for AVX2). All levels produce
+	 * identical values (and identical with ringPairStatsRow()).
+	 */
+	inline
+	void
+	ringPairStatsCells
+		( float const * const & srcOrig
+			//!< Source origin (for cellOffsets)
+		, std::ptrdiff_t const * const & cellOffsets
+			//!< Linear offsets (row*rowStride + col) of output cells
+		, std::size_t const & numElem
+			//!< Number of output cells (in cellOffsets)
+		, std::ptrdiff_t const * const & offsets1
+			//!< Linear offsets (dRow*rowStride + dCol) to first of pairs
+		, std::ptrdiff_t const * const & offsets2
+			//!< Linear offsets to (radially opposite) second of pairs
+		, std::size_t const & numPairs
+			//!< Number of values in offsets1 (and in offsets2)
+		, float const & midValue
+			//!< Value subtracted from source values
+		, float * const & mins
+			//!< Minimum delta (numElem values)
+		, float * const & maxs
+			//!< Maximum delta (numElem values)
+		, double * const & sumSqDifs
+			//!< Sum of squared pair differences (numElem values)
+		, std::uint32_t * const & numNegs
+			//!< Number of pairs with negative sum (numElem values)
+		, sys::cpu::SimdLevel const & level = sys::cpu::simdLevel()
+			//!< Most capable instruction set to use
+		)
+	{
+#	if defined(QuadLoco_SIMD_X86)
+		using sys::cpu::SimdLevel;
+		if ( (SimdLevel::AVX2 == level)
+		  && sys::cpu::supports(SimdLevel::AVX2)
+		   )
+		{
+			ringPairStatsCellsAVX2
+				( srcOrig, cellOffsets, numElem
+				, offsets1, offsets2, numPairs, midValue
+				, mins, maxs, sumSqDifs, numNegs
+				);
+		}
+		else
+		if (! (SimdLevel::Scalar == level))
+		{
+			ringPairStatsCellsSSE2
+				( srcOrig, cellOffsets, numElem
+				, offsets1, offsets2, numPairs, midValue
+				, mins, maxs, sumSqDifs, numNegs
+				);
+		}
+		else
+		{
+			ringPairStatsCellsScalar
+				( srcOrig, cellOffsets, numElem
+				, offsets1, offsets2, numPairs, midValue
+				, mins, maxs, sumSqDifs, numNegs
+				);
+		}
+#	else
+		(void)level;
+		ringPairStatsCellsScalar
+			( srcOrig, cellOffsets, numElem
+			, offsets1, offsets2, numPairs, midValue
+			, mins, maxs, sumSqDifs, numNegs
+			);
+#	endif
+	}
+
+} // [simd]
+
+} // [ras]
+
+} // [quadloco]
+
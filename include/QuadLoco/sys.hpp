@@ -32,6 +32,8 @@
  */
 
 
+#include "QuadLoco/syscpu.hpp"
+#include "QuadLoco/sysThreadPool.hpp"
 #include "QuadLoco/sysTimer.hpp"
 
 
@@ -0,0 +1,341 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::sys::ThreadPool (parallel row bands)
+ *
+ */
+
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+namespace quadloco
+{
+
+namespace sys
+{
+
+	//! Execution policy for grid-wide operations
+	enum class Exec
+	{
+		  Serial //!< Run on the calling thread only
+		, Parallel //!< Partition into row bands run on ThreadPool::shared()
+	};
+
+	/*! \brief Fixed set of worker threads for running (row band) tasks.
+	 *
+	 * Work is submitted via forEachBand() which partitions an index
+	 * range into contiguous bands, runs them on the workers (and on the
+	 * calling thread) and returns after all bands are complete. While
+	 * waiting, the calling thread also runs queued tasks, so that
+	 * forEachBand() may be safely called from within a task (nested).
+	 *
+	 * Band functions must not throw.
+	 *
+	 * A process-wide instance (with one thread per hardware thread)
+	 * is available via shared().
+	 *
+	 * \par Example
+	 * \snippet test/test_sysThreadPool.cpp DoxyExample01
+	 */
+	class ThreadPool
+	{
+		//! Threads that run tasks from theTasks
+		std::vector<std::thread> theWorkers{};
+
+		//! Tasks waiting to be run
+		std::deque<std::function<void()>> theTasks{};
+
+		//! Guard for theTasks and theStop
+		std::mutex theMutex{};
+
+		//! Signal for workers (new task or stop)
+		std::condition_variable theTaskCV{};
+
+		//! Signal for forEachBand() callers (a task finished)
+		std::condition_variable theDoneCV{};
+
+		//! Set on destruction to have workers exit
+		bool theStop{ false };
+
+		//! Worker thread: run tasks until stopped
+		inline
+		void
+		workerLoop
+			()
+		{
+			for (;;)
+			{
+				std::function<void()> task{};
+				{
+					std::unique_lock<std::mutex> lock(theMutex);
+					theTaskCV.wait
+						(lock, [this] ()
+							{ return (theStop || (! theTasks.empty())); }
+						);
+					if (theStop && theTasks.empty())
+					{
+						break;
+					}
+					task = std::move(theTasks.front());
+					theTasks.pop_front();
+				}
+				task();
+			}
+		}
+
+	public:
+
+		//! Number of hardware threads (at least 1)
+		inline
+		static
+		std::size_t
+		hardwareSize
+			()
+		{
+			std::size_t const numHard
+				{ (std::size_t)std::thread::hardware_concurrency() };
+			return std::max(std::size_t{ 1u }, numHard);
+		}
+
+		//! Process-wide pool (created on first use)
+		inline
+		static
+		ThreadPool &
+		shared
+			()
+		{
+			static ThreadPool pool(hardwareSize());
+			return pool;
+		}
+
+		//! Start pool with numThreads total (workers plus calling thread)
+		inline
+		explicit
+		ThreadPool
+			( std::size_t const & numThreads = hardwareSize()
+			)
+		{
+			// the calling thread runs bands too
+			std::size_t const numWorkers
+				{ (1u < numThreads) ? (numThreads - 1u) : 0u };
+			theWorkers.reserve(numWorkers);
+			for (std::size_t nn{0u} ; nn < numWorkers ; ++nn)
+			{
+				theWorkers.emplace_back([this] () { workerLoop(); });
+			}
+		}
+
+		// no copies (workers refer to this instance)
+		ThreadPool(ThreadPool const &) = delete;
+		ThreadPool & operator=(ThreadPool const &) = delete;
+
+		//! Finish queued tasks and join workers
+		inline
+		~ThreadPool
+			()
+		{
+			{
+				std::lock_guard<std::mutex> const lock(theMutex);
+				theStop = true;
+			}
+			theTaskCV.notify_all();
+			for (std::thread & worker : theWorkers)
+			{
+				worker.join();
+			}
+		}
+
+		//! Number of threads that run bands (workers plus caller)
+		inline
+		std::size_t
+		size
+			() const
+		{
+			return (theWorkers.size() + 1u);
+		}
+
+		/*! \brief Run bandFunc(beg, end) over bands covering [ndxBeg,ndxEnd)
+		 *
+		 * The range is split into (about 4 per thread for load balance)
+		 * contiguous bands of at least minBand indices. Each band is
+		 * processed by exactly one call to bandFunc, which should have
+		 * signature compatible with:
+		 * \arg void bandFunc(std::size_t const & beg, std::size_t const & end)
+		 *
+		 * Returns after all bands have been processed.
+		 */
+		template <typename BandFunc>
+		inline
+		void
+		forEachBand
+			( std::size_t const & ndxBeg
+			, std::size_t const & ndxEnd
+			, BandFunc const & bandFunc
+			, std::size_t const & minBand = 8u
+			)
+		{
+			std::size_t const numNdx
+				{ (ndxBeg < ndxEnd) ? (ndxEnd - ndxBeg) : 0u };
+			std::size_t const one{ 1u };
+			std::size_t const maxBands
+				{ std::max(numNdx / std::max(minBand, one), one) };
+			std::size_t const numBands{ std::min(4u * size(), maxBands) };
+			if ((numBands < 2u) || (size() < 2u))
+			{
+				if (0u < numNdx)
+				{
+					bandFunc(ndxBeg, ndxEnd);
+				}
+			}
+			else
+			{
+				// queue bands (except the first) for workers
+				std::size_t numPending{ numBands - 1u };
+				{
+					std::lock_guard<std::mutex> const lock(theMutex);
+					for (std::size_t band{1u} ; band < numBands ; ++band)
+					{
+						std::size_t const beg
+							{ ndxBeg + (band * numNdx) / numBands };
+						std::size_t const end
+							{ ndxBeg + ((band + 1u) * numNdx) / numBands };
+						theTasks.emplace_back
+							( [this, &bandFunc, &numPending, beg, end] ()
+								{
+									bandFunc(beg, end);
+									std::lock_guard<std::mutex> const
+										lock(theMutex);
+									--numPending;
+									theDoneCV.notify_all();
+								}
+							);
+					}
+				}
+				theTaskCV.notify_all();
+
+				// caller processes the first band
+				bandFunc(ndxBeg, ndxBeg + numNdx / numBands);
+
+				// help with queued tasks until all bands are done
+				std::unique_lock<std::mutex> lock(theMutex);
+				while (0u < numPending)
+				{
+					if (! theTasks.empty())
+					{
+						std::function<void()> task
+							{ std::move(theTasks.front()) };
+						theTasks.pop_front();
+						lock.unlock();
+						task();
+						lock.lock();
+					}
+					else
+					{
+						theDoneCV.wait(lock);
+					}
+				}
+			}
+		}
+
+		//! Descriptive information about this instance.
+		inline
+		std::string
+		infoString
+			( std::string const & title = {}
+			) const
+		{
+			std::ostringstream oss;
+			if (! title.empty())
+			{
+				oss << title << ' ';
+			}
+			oss << "size: " << size();
+			return oss.str();
+		}
+
+	}; // ThreadPool
+
+	/*! \brief Run bandFunc over [ndxBeg,ndxEnd) per the exec policy.
+	 *
+	 * For Exec::Serial, this is a single call bandFunc(ndxBeg, ndxEnd).
+	 * For Exec::Parallel, bands are run on ThreadPool::shared(). Ref
+	 * ThreadPool::forEachBand().
+	 */
+	template <typename BandFunc>
+	inline
+	void
+	forEachBand
+		( std::size_t const & ndxBeg
+		, std::size_t const & ndxEnd
+		, Exec const & exec
+		, BandFunc const & bandFunc
+		)
+	{
+		if (Exec::Parallel == exec)
+		{
+			ThreadPool::shared().forEachBand(ndxBeg, ndxEnd, bandFunc);
+		}
+		else
+		if (ndxBeg < ndxEnd)
+		{
+			bandFunc(ndxBeg, ndxEnd);
+		}
+	}
+
+} // [sys]
+
+} // [quadloco]
+
+
+namespace
+{
+	//! Put item.infoString() to stream
+	inline
+	std::ostream &
+	operator<<
+		( std::ostream & ostrm
+		, quadloco::sys::ThreadPool const & item
+		)
+	{
+		ostrm << item.infoString();
+		return ostrm;
+	}
+
+} // [anon/global]
+
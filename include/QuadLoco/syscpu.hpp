@@ -0,0 +1,127 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+#pragma once
+
+
+/*! \file
+ * \brief Declarations for quadloco::sys::cpu (runtime CPU feature queries)
+ *
+ * Vector instruction code paths are compiled (on x86-64 with GCC
+ * or Clang) and selected at runtime based on detected processor
+ * capabilities. SIMD code paths may be excluded from the build
+ * entirely by defining QuadLoco_NO_SIMD.
+ */
+
+
+#include <string>
+
+
+#if defined(__x86_64__) \
+	&& (defined(__GNUC__) || defined(__clang__)) \
+	&& (! defined(QuadLoco_NO_SIMD))
+	//! Defined if x86 intrinsic code paths are available in this build
+#	define QuadLoco_SIMD_X86 1
+#endif
+
+
+namespace quadloco
+{
+
+namespace sys
+{
+
+/*! \brief Processor capability queries (e.g. for SIMD code dispatch)
+ */
+namespace cpu
+{
+	//! Vector instruction set levels (in order of increasing capability)
+	enum class SimdLevel : int
+	{
+		  Scalar = 0 //!< Portable (compiler generated) code only
+		, SSE2 = 1 //!< 128-bit SSE2 (baseline for all x86-64)
+		, AVX2 = 2 //!< 256-bit AVX2
+	};
+
+	//! Name associated with SIMD level
+	inline
+	std::string
+	nameFor
+		( SimdLevel const & level
+		)
+	{
+		std::string name{ "Scalar" };
+		if (SimdLevel::SSE2 == level)
+		{
+			name = "SSE2";
+		}
+		else
+		if (SimdLevel::AVX2 == level)
+		{
+			name = "AVX2";
+		}
+		return name;
+	}
+
+	//! Highest SIMD level supported by both this build and this processor
+	inline
+	SimdLevel
+	simdLevel
+		()
+	{
+		static SimdLevel const level
+			{ [] ()
+				{
+					SimdLevel detected{ SimdLevel::Scalar };
+#				if defined(QuadLoco_SIMD_X86)
+					detected = SimdLevel::SSE2;
+					__builtin_cpu_init();
+					if (__builtin_cpu_supports("avx2"))
+					{
+						detected = SimdLevel::AVX2;
+					}
+#				endif
+					return detected;
+				} ()
+			};
+		return level;
+	}
+
+	//! True if level is not more capable than simdLevel()
+	inline
+	bool
+	supports
+		( SimdLevel const & level
+		)
+	{
+		return (! (static_cast<int>(simdLevel()) < static_cast<int>(level)));
+	}
+
+} // [cpu]
+
+} // [sys]
+
+} // [quadloco]
+
@@ -0,0 +1,518 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::app::center
+*/
+
+
+#include "QuadLoco/appcenter.hpp"
+
+#include "QuadLoco/opsSymRing.hpp"
+#include "QuadLoco/pix.hpp"
+#include "QuadLoco/prbStats.hpp"
+#include "QuadLoco/rasgrid.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
+#include "QuadLoco/rasPeakRCV.hpp"
+#include "QuadLoco/simRender.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	//! Peaks in row/col order (e.g. for comparing collections)
+	std::vector<quadloco::ras::PeakRCV>
+	rowColOrdered
+		( std::vector<quadloco::ras::PeakRCV> peaks
+		)
+	{
+		using quadloco::ras::PeakRCV;
+		std::sort
+			( peaks.begin(), peaks.end()
+			, [] (PeakRCV const & pA, PeakRCV const & pB)
+				{
+					return
+						(  (pA.theRowCol.row() < pB.theRowCol.row())
+						|| (  (pA.theRowCol.row() == pB.theRowCol.row())
+						   && (pA.theRowCol.col() < pB.theRowCol.col())
+						   )
+						);
+				}
+			);
+		return peaks;
+	}
+
+	//! True if both collections have same locations and values
+	bool
+	samePeaks
+		( std::vector<quadloco::ras::PeakRCV> const & peaksA
+		, std::vector<quadloco::ras::PeakRCV> const & peaksB
+		)
+	{
+		using quadloco::ras::PeakRCV;
+		std::vector<PeakRCV> const ordA{ rowColOrdered(peaksA) };
+		std::vector<PeakRCV> const ordB{ rowColOrdered(peaksB) };
+		return
+			(  (ordA.size() == ordB.size())
+			&& std::equal
+				( ordA.cbegin(), ordA.cend(), ordB.cbegin()
+				, [] (PeakRCV const & pA, PeakRCV const & pB)
+					{
+						return
+							(  (pA.theRowCol == pB.theRowCol)
+							&& (pA.theValue == pB.theValue)
+							);
+					}
+				)
+			);
+	}
+
+	//! Check banded (streaming) peak detection
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(48u, 16u) };
+		ras::Grid<float> const & srcGrid = simQuadData.theGrid;
+		prb::Stats<float> const srcStats(srcGrid.cbegin(), srcGrid.cend());
+		std::vector<std::size_t> const ringHalfSizes{ 5u, 3u };
+
+		// peaks computed over full image
+		std::vector<ras::PeakRCV> const expPeaks
+			{ app::center::multiSymRingPeaks
+				(srcGrid, srcStats, ringHalfSizes)
+			};
+
+		// [DoxyExample01]
+
+		// rows are requested in order - e.g. from a streaming source
+		auto const fillRow
+			{ [&srcGrid] (std::size_t const & row, float * const & rowBeg)
+				{
+					std::copy
+						(srcGrid.cbeginRow(row), srcGrid.cendRow(row), rowBeg);
+				}
+			};
+
+		// process in bands of (here) 10 rows (plus halo rows)
+		std::size_t const bandHigh{ 10u };
+		std::vector<ras::PeakRCV> const gotPeaks
+			{ app::center::multiSymRingPeaksBanded
+				(srcGrid.hwSize(), fillRow, srcStats, ringHalfSizes, bandHigh)
+			};
+
+		// [DoxyExample01]
+
+		if (expPeaks.empty())
+		{
+			oss << "Failure of non-empty expPeaks test\n";
+		}
+
+		if (! samePeaks(gotPeaks, expPeaks))
+		{
+			oss << "Failure of banded peak test\n";
+			oss << "exp.size: " << expPeaks.size() << '\n';
+			oss << "got.size: " << gotPeaks.size() << '\n';
+		}
+		else
+		if (! (gotPeaks.front().theRowCol == expPeaks.front().theRowCol))
+		{
+			oss << "Failure of banded largest peak test\n";
+			oss << "exp: " << expPeaks.front() << '\n';
+			oss << "got: " << gotPeaks.front() << '\n';
+		}
+
+		// various band sizes (including single row and larger than image)
+		std::vector<std::size_t> const bandSizes{ 1u, 3u, 17u, 1000u };
+		for (std::size_t const & bandSize : bandSizes)
+		{
+			std::vector<ras::PeakRCV> const bandPeaks
+				{ app::center::multiSymRingPeaksBanded
+					( srcGrid.hwSize(), fillRow, srcStats
+					, ringHalfSizes, bandSize
+					)
+				};
+			if (! samePeaks(bandPeaks, expPeaks))
+			{
+				oss << "Failure of banded peak test for bandSize: "
+					<< bandSize << '\n';
+			}
+		}
+	}
+
+	//! Check banded processing of 8-bit view (e.g. mapped image)
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(48u, 16u) };
+		ras::Grid<uint8_t> const uGrid
+			{ ras::grid::uGrid8(simQuadData.theGrid, val::Span{ 0., 1. }) };
+		ras::Grid<float> const fGrid{ ras::grid::realGridOf<float>(uGrid) };
+		prb::Stats<float> const srcStats(fGrid.cbegin(), fGrid.cend());
+		std::vector<std::size_t> const ringHalfSizes{ 5u, 3u };
+
+		std::vector<ras::PeakRCV> const expPeaks
+			{ app::center::multiSymRingPeaks(fGrid, srcStats, ringHalfSizes) };
+
+		std::vector<ras::PeakRCV> const gotPeaks
+			{ app::center::multiSymRingPeaksBanded
+				(ras::GridView<uint8_t>(uGrid), srcStats, ringHalfSizes, 8u)
+			};
+
+		if (! samePeaks(gotPeaks, expPeaks))
+		{
+			oss << "Failure of uint8_t view banded peak test\n";
+			oss << "exp.size: " << expPeaks.size() << '\n';
+			oss << "got.size: " << gotPeaks.size() << '\n';
+		}
+	}
+
+	//! Check coarse-to-fine (pyramid) peak detection
+	void
+	test3
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(96u, 16u) };
+		ras::Grid<float> const & srcGrid = simQuadData.theGrid;
+		prb::Stats<float> const srcStats(srcGrid.cbegin(), srcGrid.cend());
+		std::vector<std::size_t> const ringHalfSizes{ 5u, 3u };
+
+		// peaks computed over full image
+		std::vector<ras::PeakRCV> const expPeaks
+			{ app::center::multiSymRingPeaks
+				(srcGrid, srcStats, ringHalfSizes)
+			};
+
+		// [DoxyExample02]
+
+		// candidates from half resolution, evaluated in 17x17 windows
+		std::size_t const numLevels{ 2u };
+		std::size_t const windowHalf{ 8u };
+		std::size_t const numCandidates{ 4u };
+		std::vector<ras::PeakRCV> const gotPeaks
+			{ app::center::multiSymRingPeaksPyramid
+				( srcGrid, srcStats, ringHalfSizes
+				, numLevels, windowHalf, numCandidates
+				)
+			};
+
+		// [DoxyExample02]
+
+		if (expPeaks.empty() || gotPeaks.empty())
+		{
+			oss << "Failure of non-empty pyramid peaks test\n";
+			oss << "exp.size: " << expPeaks.size() << '\n';
+			oss << "got.size: " << gotPeaks.size() << '\n';
+		}
+		else
+		{
+			// strongest peak should be the same
+			if (! ( (gotPeaks.front().theRowCol == expPeaks.front().theRowCol)
+				 && (gotPeaks.front().theValue == expPeaks.front().theValue)
+				  ))
+			{
+				oss << "Failure of pyramid largest peak test\n";
+				oss << "exp: " << expPeaks.front() << '\n';
+				oss << "got: " << gotPeaks.front() << '\n';
+			}
+
+			// every pyramid peak is also a full resolution peak
+			std::size_t numMissing{ 0u };
+			for (ras::PeakRCV const & gotPeak : gotPeaks)
+			{
+				bool const found
+					{ expPeaks.cend() != std::find_if
+						( expPeaks.cbegin(), expPeaks.cend()
+						, [&gotPeak] (ras::PeakRCV const & expPeak)
+							{
+								return
+									(  (gotPeak.theRowCol == expPeak.theRowCol)
+									&& (gotPeak.theValue == expPeak.theValue)
+									);
+							}
+						)
+					};
+				numMissing += found ? 0u : 1u;
+			}
+			if (! (0u == numMissing))
+			{
+				oss << "Failure of pyramid peak subset test\n";
+				oss << "numMissing: " << numMissing << '\n';
+			}
+			if (! (gotPeaks.size() < expPeaks.size()))
+			{
+				oss << "Failure of pyramid windowed evaluation test\n";
+				oss << "exp.size: " << expPeaks.size() << '\n';
+				oss << "got.size: " << gotPeaks.size() << '\n';
+			}
+		}
+
+		// single level pyramid is the same as full resolution
+		std::vector<ras::PeakRCV> const onePeaks
+			{ app::center::multiSymRingPeaksPyramid
+				(srcGrid, srcStats, ringHalfSizes, 1u)
+			};
+		if (! samePeaks(onePeaks, expPeaks))
+		{
+			oss << "Failure of single level pyramid test\n";
+		}
+	}
+
+	//! Check bounded (top-K, threshold) secondary evaluation
+	void
+	test4
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(64u, 16u) };
+		ras::Grid<float> const & srcGrid = simQuadData.theGrid;
+		prb::Stats<float> const srcStats(srcGrid.cbegin(), srcGrid.cend());
+		std::vector<std::size_t> const ringHalfSizes{ 5u, 3u, 2u };
+
+		// all peaks (unbounded)
+		std::vector<ras::PeakRCV> const allPeaks
+			{ app::center::multiSymRingPeaks
+				(srcGrid, srcStats, ringHalfSizes)
+			};
+
+		// [DoxyExample03]
+
+		// only the (up to) 5 largest combined peaks
+		std::size_t const maxNumPeaks{ 5u };
+		std::vector<ras::PeakRCV> const topPeaks
+			{ app::center::multiSymRingPeaks
+				(srcGrid, srcStats, ringHalfSizes, maxNumPeaks)
+			};
+
+		// only combined peaks at least 5% of the largest first peak
+		double const minRelValue{ .05 };
+		std::vector<ras::PeakRCV> const bigPeaks
+			{ app::center::multiSymRingPeaks
+				(srcGrid, srcStats, ringHalfSizes, 1000u, 0., minRelValue)
+			};
+
+		// [DoxyExample03]
+
+		if (! (maxNumPeaks < allPeaks.size()))
+		{
+			oss << "Failure of bounded test setup (too few peaks)\n";
+			oss << "allPeaks.size: " << allPeaks.size() << '\n';
+		}
+		else
+		{
+			// top-K values are the largest of all combined peaks
+			bool same{ (maxNumPeaks == topPeaks.size()) };
+			for (std::size_t nn{0u} ; same && (nn < maxNumPeaks) ; ++nn)
+			{
+				same = (topPeaks[nn].theValue == allPeaks[nn].theValue);
+			}
+			if (! same)
+			{
+				oss << "Failure of bounded top-K value test\n";
+				oss << "topPeaks.size: " << topPeaks.size() << '\n';
+			}
+			else
+			if (! (topPeaks.front().theRowCol == allPeaks.front().theRowCol))
+			{
+				oss << "Failure of bounded top-K location test\n";
+				oss << "exp: " << allPeaks.front() << '\n';
+				oss << "got: " << topPeaks.front() << '\n';
+			}
+		}
+
+		// threshold keeps exactly those combined peaks that qualify
+		if (! allPeaks.empty())
+		{
+			// largest first peak (is the first filter response there)
+			ras::Grid<float> const gridA
+				{ ops::symRingGridFor(srcGrid, ringHalfSizes.front()) };
+			double const maxA
+				{ (double)*std::max_element
+					( gridA.cbegin(), gridA.cend()
+					, [] (float const & v1, float const & v2)
+						{
+							return
+								( (! pix::isValid(v1))
+								|| (pix::isValid(v2) && (v1 < v2))
+								);
+						}
+					)
+				};
+			double const minValue{ minRelValue * maxA };
+			std::vector<ras::PeakRCV> expPeaks;
+			for (ras::PeakRCV const & peak : allPeaks)
+			{
+				if (! (peak.theValue < minValue))
+				{
+					expPeaks.emplace_back(peak);
+				}
+			}
+			if (! (samePeaks(bigPeaks, expPeaks) && (! bigPeaks.empty())))
+			{
+				oss << "Failure of bounded threshold test\n";
+				oss << "exp.size: " << expPeaks.size() << '\n';
+				oss << "got.size: " << bigPeaks.size() << '\n';
+			}
+		}
+
+		// no peaks requested
+		std::vector<ras::PeakRCV> const noPeaks
+			{ app::center::multiSymRingPeaks
+				(srcGrid, srcStats, ringHalfSizes, 0u)
+			};
+		if (! noPeaks.empty())
+		{
+			oss << "Failure of zero maxNumPeaks test\n";
+		}
+	}
+
+	//! Check that padded (aligned) grid produces same peaks as dense
+	void
+	test5
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// (odd size so that aligned rows are padded)
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(45u, 16u) };
+		ras::Grid<float> const & denseGrid = simQuadData.theGrid;
+		ras::Grid<float> paddedGrid
+			(denseGrid.hwSize(), ras::GridLayout::aligned(64u));
+		for (std::size_t row{0u} ; row < denseGrid.high() ; ++row)
+		{
+			std::copy
+				( denseGrid.cbeginRow(row), denseGrid.cendRow(row)
+				, paddedGrid.beginRow(row)
+				);
+		}
+		std::vector<std::size_t> const ringHalfSizes{ 5u, 3u };
+
+		std::vector<ras::PeakRCV> const expPeaks
+			{ app::center::multiSymRingPeaks(denseGrid, ringHalfSizes) };
+		std::vector<ras::PeakRCV> const gotPeaks
+			{ app::center::multiSymRingPeaks(paddedGrid, ringHalfSizes) };
+
+		if (! ( (! paddedGrid.isContiguous())
+			 && (! expPeaks.empty())
+			 && samePeaks(gotPeaks, expPeaks)
+			  ))
+		{
+			oss << "Failure of padded grid peak test\n";
+			oss << "exp.size: " << expPeaks.size() << '\n';
+			oss << "got.size: " << gotPeaks.size() << '\n';
+		}
+	}
+
+	//! Check that bounded evaluation does not return invalid peaks
+	void
+	test6
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(40u, 16u) };
+		ras::Grid<float> srcGrid
+			{ ras::Grid<float>::copyOf(simQuadData.theGrid) };
+		// null pixel (sampled by secondary ring near some initial peaks)
+		srcGrid(12u, 20u) = pix::null<float>();
+		ras::GridView<float> const srcView(srcGrid);
+		prb::Stats<float> const srcStats{ ops::statsFor(srcView) };
+		std::vector<std::size_t> const ringHalfSizes{ 5u, 3u };
+
+		std::vector<ras::PeakRCV> const gotPeaks
+			{ app::center::multiSymRingPeaks
+				(srcView, srcStats, ringHalfSizes, 1000000u, 1.e-9, 0.)
+			};
+
+		std::size_t numBad{ 0u };
+		for (ras::PeakRCV const & gotPeak : gotPeaks)
+		{
+			if (! pix::isValid(gotPeak.theValue))
+			{
+				++numBad;
+			}
+		}
+		if (gotPeaks.empty() || (0u < numBad))
+		{
+			oss << "Failure of bounded peaks with null pixel test\n";
+			oss << "got.size: " << gotPeaks.size() << '\n';
+			oss << "  numBad: " << numBad << '\n';
+		}
+	}
+
+}
+
+//! Check behavior of app::center functions
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+	test3(oss);
+	test4(oss);
+	test5(oss);
+	test6(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
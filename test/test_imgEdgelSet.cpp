@@ -0,0 +1,141 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::img::EdgelSet
+*/
+
+
+#include "QuadLoco/imgEdgelSet.hpp"
+
+#include "QuadLoco/imgEdgel.hpp"
+
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	//! Check construction and batch evaluation
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// [DoxyExample01]
+
+		// collect edgels (e.g. from gradient grid)
+		img::EdgelSet edgelSet{};
+		edgelSet.add(10.f, 20.f, 3.f, 4.f);
+		edgelSet.add(11.f, 21.f, 0.f, -2.f);
+
+		// evaluate magnitudes and angles for all edgels (in batch)
+		std::vector<double> mags;
+		std::vector<double> angles;
+		edgelSet.magnitudesInto(&mags);
+		edgelSet.anglesInto(&angles);
+
+		// access individual edgels (e.g. for compatibility)
+		img::Edgel const edgel1{ edgelSet.edgelAt(1u) };
+
+		// [DoxyExample01]
+
+		if (! ((2u == edgelSet.size()) && (2u == mags.size())))
+		{
+			oss << "Failure of size test\n";
+			oss << "edgelSet: " << edgelSet << '\n';
+		}
+		else
+		{
+			img::Edgel const expEdgel0
+				{ img::Spot{ 10., 20. }, img::Grad{ 3., 4. } };
+			img::Edgel const expEdgel1
+				{ img::Spot{ 11., 21. }, img::Grad{ 0., -2. } };
+			constexpr double tol{ 4. * std::numeric_limits<double>::epsilon() };
+			if (! ( engabra::g3::nearlyEquals(mags[0], 5., tol)
+				&& engabra::g3::nearlyEquals(mags[1], 2., tol)
+				&& engabra::g3::nearlyEquals(angles[0], expEdgel0.angle(), tol)
+				&& engabra::g3::nearlyEquals(angles[1], expEdgel1.angle(), tol)
+				&& expEdgel1.nearlyEquals(edgel1, tol)
+				) )
+			{
+				oss << "Failure of batch value test\n";
+				oss << "mags[0]: " << mags[0] << '\n';
+				oss << "mags[1]: " << mags[1] << '\n';
+				oss << "angles[0]: " << angles[0] << '\n';
+				oss << "angles[1]: " << angles[1] << '\n';
+				oss << "edgel1: " << edgel1 << '\n';
+			}
+		}
+
+		// conversion from (AoS) edgels and clear
+		std::vector<img::Edgel> const edgels
+			{ img::Edgel{ img::Spot{ 1., 2. }, img::Grad{ .5, -.25 } }
+			, img::Edgel{ img::Spot{ 3., 4. }, img::Grad{ -1., 1. } }
+			};
+		img::EdgelSet fromSet{ img::EdgelSet::from(edgels) };
+		if (! ( (2u == fromSet.size())
+			&& (3.f == fromSet.rows()[1])
+			&& (4.f == fromSet.cols()[1])
+			&& (-1.f == fromSet.gRows()[1])
+			&& (1.f == fromSet.gCols()[1])
+			) )
+		{
+			oss << "Failure of from() test\n";
+		}
+		fromSet.clear();
+		if (! fromSet.empty())
+		{
+			oss << "Failure of clear() test\n";
+		}
+	}
+
+}
+
+//! Check behavior of img::EdgelSet
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
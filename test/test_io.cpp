@@ -35,9 +35,14 @@
 #include "QuadLoco/valSpan.hpp"
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <iterator>
 #include <sstream>
+#include <string>
 
 
 namespace
@@ -100,6 +105,87 @@ std::filesystem::path tmpFnamePgm("./quadloco_test_io.pgm");
 
 	}
 
+	//! Check 16-bit pgm image i/o
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		// [DoxyExample02]
+
+		using namespace quadloco;
+
+		// e.g. full range 16-bit pixel data
+		ras::Grid<uint16_t> uGridExp(2u, 3u);
+		uGridExp(0, 0) =     0u;
+		uGridExp(0, 1) =   255u;
+		uGridExp(0, 2) =   256u;
+		uGridExp(1, 0) =  4095u;
+		uGridExp(1, 1) = 32769u;
+		uGridExp(1, 2) = 65535u;
+
+		// write and read (big-endian) 16-bit PGM
+		std::filesystem::path tmpFnamePgm("./quadloco_test_io16.pgm");
+		bool const okayWrite{ io::writePGM(tmpFnamePgm, uGridExp) };
+		ras::Grid<uint16_t> const uGridGot{ io::readPGM16(tmpFnamePgm) };
+
+		// [DoxyExample02]
+
+		if (! (okayWrite && uGridGot.isValid()))
+		{
+			oss << "Failure of 16-bit write/read test\n";
+		}
+		else
+		if (! std::equal
+			(uGridExp.cbegin(), uGridExp.cend(), uGridGot.cbegin()))
+		{
+			oss << "Failure of 16-bit reload pixel test\n";
+			oss << uGridExp.infoStringContents("uGridExp", "%6u") << '\n';
+			oss << uGridGot.infoStringContents("uGridGot", "%6u") << '\n';
+		}
+
+		// check file byte order is big-endian (per PGM spec)
+		{
+			std::ifstream ifs(tmpFnamePgm, std::ios_base::binary);
+			std::string const content
+				{ std::istreambuf_iterator<char>(ifs)
+				, std::istreambuf_iterator<char>()
+				};
+			// last sample (65535) preceded by 32769 == 0x8001
+			std::string const tail{ content.substr(content.size() - 4u) };
+			std::string const expTail{ "\x80\x01\xff\xff" };
+			if (! (expTail == tail))
+			{
+				oss << "Failure of 16-bit big-endian file content test\n";
+			}
+		}
+
+		// 8-bit files are widened (and not rescaled)
+		ras::Grid<uint8_t> uGrid8(1u, 2u);
+		uGrid8(0, 0) = 7u;
+		uGrid8(0, 1) = 255u;
+		std::filesystem::path tmpFnamePgm8("./quadloco_test_io8.pgm");
+		(void)io::writePGM(tmpFnamePgm8, uGrid8);
+		ras::Grid<uint16_t> const uGridWide{ io::readPGM16(tmpFnamePgm8) };
+		if (! ( uGridWide.isValid()
+			 && (7u == uGridWide(0, 0))
+			 && (255u == uGridWide(0, 1))
+			 )
+		   )
+		{
+			oss << "Failure of 8-bit readPGM16 widening test\n";
+		}
+
+		// 8-bit reader rejects 16-bit files
+		if (io::readPGM(tmpFnamePgm).isValid())
+		{
+			oss << "Failure of 8-bit readPGM rejection test\n";
+		}
+
+		std::filesystem::remove(tmpFnamePgm);
+		std::filesystem::remove(tmpFnamePgm8);
+	}
+
 }
 
 //! Standard test case main wrapper
@@ -111,6 +197,7 @@ main
 	std::stringstream oss;
 
 	test0(oss);
+	test1(oss);
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
 	{
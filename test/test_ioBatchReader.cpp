@@ -0,0 +1,212 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::io::BatchReader
+*/
+
+
+#include "QuadLoco/ioBatchReader.hpp"
+
+#include "QuadLoco/io.hpp"
+#include "QuadLoco/rasGrid.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+	//! Create directory with numImg small pgm files (first pixel == ndx)
+	inline
+	std::vector<std::filesystem::path>
+	makeSampleFiles
+		( std::filesystem::path const & dirPath
+		, std::size_t const & numImg
+		)
+	{
+		using namespace quadloco;
+		std::filesystem::create_directories(dirPath);
+		std::vector<std::filesystem::path> paths;
+		for (std::size_t ndx{0u} ; ndx < numImg ; ++ndx)
+		{
+			std::ostringstream name;
+			name << "img" << (char)('a' + ndx) << ".pgm";
+			std::filesystem::path const path{ dirPath / name.str() };
+			ras::Grid<std::uint8_t> grid(3u + ndx, 4u);
+			std::iota(grid.begin(), grid.end(), (std::uint8_t)ndx);
+			(void)io::writePGM(path, grid);
+			paths.emplace_back(path);
+		}
+		return paths;
+	}
+
+	//! Check in-order loading of directory content
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		std::filesystem::path const dirPath("./quadloco_test_ioBatchReader1");
+		constexpr std::size_t numImg{ 7u };
+		std::vector<std::filesystem::path> const expPaths
+			{ makeSampleFiles(dirPath, numImg) };
+
+		// [DoxyExample01]
+
+		// start background loading (at most 3 frames ahead of consumer)
+		io::BatchReader reader(dirPath, 3u);
+
+		// process frames as they become available
+		std::vector<io::BatchReader::Frame> gotFrames;
+		io::BatchReader::Frame frame{};
+		while (reader.nextFrame(&frame))
+		{
+			// e.g. process frame.theGrid here (while next one loads)
+			gotFrames.emplace_back(std::move(frame));
+		}
+
+		// [DoxyExample01]
+
+		if (! (numImg == gotFrames.size()))
+		{
+			oss << "Failure of directory frame count test\n";
+			oss << "exp: " << numImg << '\n';
+			oss << "got: " << gotFrames.size() << '\n';
+			oss << "reader: " << reader << '\n';
+		}
+		else
+		{
+			for (std::size_t ndx{0u} ; ndx < numImg ; ++ndx)
+			{
+				io::BatchReader::Frame const & gotFrame = gotFrames[ndx];
+				ras::SizeHW const expHW{ 3u + ndx, 4u };
+				if (! ( (expPaths[ndx] == gotFrame.thePath)
+					&& gotFrame.isValid()
+					&& (expHW == gotFrame.theGrid.hwSize())
+					&& (ndx == gotFrame.theGrid(0u, 0u))
+					) )
+				{
+					oss << "Failure of directory frame content test\n";
+					oss << "ndx: " << ndx << '\n';
+					oss << "exp path: " << expPaths[ndx] << '\n';
+					oss << "got path: " << gotFrame.thePath << '\n';
+					break;
+				}
+			}
+		}
+
+		// after completion, no more frames
+		if (reader.nextFrame(&frame))
+		{
+			oss << "Failure of exhausted reader test\n";
+		}
+
+		std::filesystem::remove_all(dirPath);
+	}
+
+	//! Check unreadable files, explicit lists and early destruction
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		std::filesystem::path const dirPath("./quadloco_test_ioBatchReader2");
+		std::vector<std::filesystem::path> paths
+			{ makeSampleFiles(dirPath, 5u) };
+		std::filesystem::path const badPath{ dirPath / "doesNotExist.pgm" };
+		paths.insert(paths.begin() + 2u, badPath);
+
+		// missing file produces null frame (in sequence)
+		{
+			io::BatchReader reader(paths, 1u);
+			std::vector<bool> gotValids;
+			io::BatchReader::Frame frame{};
+			while (reader.nextFrame(&frame))
+			{
+				gotValids.emplace_back(frame.isValid());
+			}
+			std::vector<bool> const expValids
+				{ true, true, false, true, true, true };
+			if (! (expValids == gotValids))
+			{
+				oss << "Failure of missing file null frame test\n";
+				oss << "reader: " << reader << '\n';
+			}
+		}
+
+		// destruction with unconsumed frames should not block
+		{
+			io::BatchReader reader(paths, 2u);
+			io::BatchReader::Frame frame{};
+			(void)reader.nextFrame(&frame);
+		}
+
+		// empty list
+		{
+			io::BatchReader reader(std::vector<std::filesystem::path>{});
+			if (reader.nextFrame(nullptr))
+			{
+				oss << "Failure of empty list test\n";
+			}
+		}
+
+		std::filesystem::remove_all(dirPath);
+	}
+
+}
+
+//! Check behavior of io::BatchReader
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,235 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::io binary grid i/o
+*/
+
+
+#include "QuadLoco/ioBinGrid.hpp"
+
+#include "QuadLoco/imgGrad.hpp"
+#include "QuadLoco/rasGrid.hpp"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <string>
+
+
+namespace
+{
+	//! True if both grids have same size and (bitwise or NaN) values
+	template <typename Type>
+	inline
+	bool
+	sameGrids
+		( quadloco::ras::Grid<Type> const & gridA
+		, quadloco::ras::Grid<Type> const & gridB
+		)
+	{
+		bool same{ gridA.hwSize() == gridB.hwSize() };
+		for (std::size_t row{0u} ; same && (row < gridA.high()) ; ++row)
+		{
+			for (std::size_t col{0u} ; same && (col < gridA.wide()) ; ++col)
+			{
+				Type const & valA = gridA(row, col);
+				Type const & valB = gridB(row, col);
+				same = ( (valA == valB)
+					|| (std::isnan(valA) && std::isnan(valB))
+					);
+			}
+		}
+		return same;
+	}
+
+	//! Check round trip of float and double grids
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		std::filesystem::path const binPath("./quadloco_test_ioBinGrid1.qgrid");
+
+		// [DoxyExample01]
+
+		// e.g. some intermediate result
+		ras::Grid<float> expGrid(5u, 7u);
+		std::iota(expGrid.begin(), expGrid.end(), -3.25f);
+		expGrid(2u, 3u) = std::numeric_limits<float>::quiet_NaN();
+
+		// save in binary form (nulls stored as -1.e6 in file)
+		bool const okaySave{ io::writeBinGrid(binPath, expGrid, -1.e6) };
+
+		// load via memory map (nulls restored as NaN)
+		ras::Grid<float> const gotGrid
+			{ io::readBinGrid<float>(binPath) };
+
+		// [DoxyExample01]
+
+		if (! (okaySave && sameGrids(gotGrid, expGrid)))
+		{
+			oss << "Failure of float grid round trip test\n";
+			oss << "okaySave: " << okaySave << '\n';
+			oss << "expGrid: " << expGrid << '\n';
+			oss << "gotGrid: " << gotGrid << '\n';
+		}
+
+		// padded (non-contiguous) double grid with NaN null in file
+		ras::Grid<double> expDbl
+			(ras::SizeHW{ 3u, 5u }, ras::GridLayout::aligned(64u));
+		for (std::size_t row{0u} ; row < expDbl.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < expDbl.wide() ; ++col)
+			{
+				expDbl(row, col) = (double)row - .125 * (double)col;
+			}
+		}
+		expDbl(0u, 0u) = std::numeric_limits<double>::quiet_NaN();
+		(void)io::writeBinGrid(binPath, expDbl);
+		std::size_t const expFileSize
+			{ io::BinGridHeader::theByteSize + expDbl.size()*sizeof(double) };
+		std::size_t const gotFileSize{ std::filesystem::file_size(binPath) };
+		ras::Grid<double> const gotDbl{ io::readBinGrid<double>(binPath) };
+		if (! (sameGrids(gotDbl, expDbl) && (expFileSize == gotFileSize)))
+		{
+			oss << "Failure of double grid round trip test\n";
+			oss << "expFileSize: " << expFileSize << '\n';
+			oss << "gotFileSize: " << gotFileSize << '\n';
+			oss << "expDbl: " << expDbl << '\n';
+			oss << "gotDbl: " << gotDbl << '\n';
+		}
+
+		std::filesystem::remove(binPath);
+	}
+
+	//! Check img::Grad grids and rejection of mismatched/bad files
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		std::filesystem::path const binPath("./quadloco_test_ioBinGrid2.qgrid");
+
+		ras::Grid<img::Grad> expGrid(4u, 3u);
+		for (std::size_t row{0u} ; row < expGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < expGrid.wide() ; ++col)
+			{
+				expGrid(row, col) = img::Grad{ (double)row, -(double)col };
+			}
+		}
+		expGrid(3u, 1u) = img::Grad{};
+		(void)io::writeBinGrid(binPath, expGrid, 999.);
+		ras::Grid<img::Grad> const gotGrid
+			{ io::readBinGrid<img::Grad>(binPath) };
+
+		bool same{ gotGrid.hwSize() == expGrid.hwSize() };
+		for (std::size_t row{0u} ; same && (row < expGrid.high()) ; ++row)
+		{
+			for (std::size_t col{0u} ; same && (col < expGrid.wide()) ; ++col)
+			{
+				img::Grad const & expGrad = expGrid(row, col);
+				img::Grad const & gotGrad = gotGrid(row, col);
+				if (isValid(expGrad))
+				{
+					same = gotGrad.nearlyEquals(expGrad, 0.);
+				}
+				else
+				{
+					same = (! isValid(gotGrad));
+				}
+			}
+		}
+		if (! same)
+		{
+			oss << "Failure of Grad grid round trip test\n";
+			oss << "expGrid: " << expGrid << '\n';
+			oss << "gotGrid: " << gotGrid << '\n';
+		}
+
+		// type mismatch should produce null grid
+		ras::Grid<double> const badType{ io::readBinGrid<double>(binPath) };
+		if (badType.isValid())
+		{
+			oss << "Failure of type mismatch null test\n";
+		}
+
+		// truncated file should produce null grid
+		std::filesystem::resize_file
+			(binPath, std::filesystem::file_size(binPath) - 1u);
+		ras::Grid<img::Grad> const badSize
+			{ io::readBinGrid<img::Grad>(binPath) };
+		if (badSize.isValid())
+		{
+			oss << "Failure of truncated file null test\n";
+		}
+
+		// non-grid file should produce null grid
+		{
+			std::ofstream ofs(binPath, std::ios::binary);
+			ofs << "P5\n3 2\n255\nabcdef";
+		}
+		ras::Grid<float> const badFile{ io::readBinGrid<float>(binPath) };
+		if (badFile.isValid())
+		{
+			oss << "Failure of non-grid file null test\n";
+		}
+
+		std::filesystem::remove(binPath);
+	}
+
+}
+
+//! Check behavior of io binary grid functions
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
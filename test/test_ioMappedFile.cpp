@@ -0,0 +1,124 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::io::MappedFile
+*/
+
+
+#include "QuadLoco/ioMappedFile.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+
+
+namespace
+{
+	//! Check memory mapped file access
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		std::filesystem::path const tmpPath("./quadloco_test_ioMappedFile.txt");
+		std::string const expData{ "Some file content\nfor mapping test" };
+		{
+			std::ofstream ofs(tmpPath, std::ios_base::binary);
+			ofs << expData;
+		}
+
+		// [DoxyExample01]
+
+		using namespace quadloco;
+
+		// map file content into memory (read only)
+		io::MappedFile const mapped(tmpPath);
+
+		// access data directly within mapped memory
+		std::string const gotData(mapped.cbegin(), mapped.cend());
+
+		// [DoxyExample01]
+
+		if (! isValid(mapped))
+		{
+			oss << "Failure of valid mapping test\n";
+			oss << "mapped: " << mapped << '\n';
+		}
+
+		if (! (gotData == expData))
+		{
+			oss << "Failure of mapped data test\n";
+			oss << "exp: " << expData << '\n';
+			oss << "got: " << gotData << '\n';
+		}
+
+		// move retains mapped address
+		io::MappedFile orig(tmpPath);
+		char const * const expBeg{ orig.cbegin() };
+		io::MappedFile const moved(std::move(orig));
+		if (! (moved.isValid() && (expBeg == moved.cbegin())))
+		{
+			oss << "Failure of move mapping test\n";
+			oss << "moved: " << moved << '\n';
+		}
+
+		// missing file produces null instance
+		io::MappedFile const aNull("./quadloco_no_such_file.txt");
+		if (isValid(aNull))
+		{
+			oss << "Failure of missing file null test\n";
+			oss << "aNull: " << aNull << '\n';
+		}
+
+		std::filesystem::remove(tmpPath);
+	}
+
+}
+
+//! Check behavior of io::MappedFile
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
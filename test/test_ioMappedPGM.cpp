@@ -0,0 +1,173 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::io::MappedPGM
+*/
+
+
+#include "QuadLoco/ioMappedPGM.hpp"
+
+#include "QuadLoco/io.hpp"
+#include "QuadLoco/rasgrid.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+
+
+namespace
+{
+	//! Check zero copy access to pgm data
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// create pgm file for testing
+		std::filesystem::path const pgmPath("./quadloco_test_ioMappedPGM.pgm");
+		ras::Grid<uint8_t> expGrid(5u, 7u);
+		std::iota(expGrid.begin(), expGrid.end(), 10u);
+		(void)io::writePGM(pgmPath, expGrid);
+
+		// [DoxyExample01]
+
+		// map file and access pixels without copying
+		io::MappedPGM const mappedPGM(pgmPath);
+		ras::GridView<uint8_t> const & view = mappedPGM.gridView();
+
+		// e.g. convert directly to float grid for processing
+		ras::Grid<float> const fGrid{ ras::grid::realGridOf<float>(view) };
+
+		// [DoxyExample01]
+
+		if (! isValid(mappedPGM))
+		{
+			oss << "Failure of valid mappedPGM test\n";
+			oss << "mappedPGM: " << mappedPGM << '\n';
+		}
+		else
+		{
+			ras::Grid<uint8_t> const gotGrid
+				{ ras::grid::gridCopyOf<uint8_t>(view) };
+			if (! (  (gotGrid.hwSize() == expGrid.hwSize())
+				  && std::equal
+					(expGrid.cbegin(), expGrid.cend(), gotGrid.cbegin())
+				  )
+			   )
+			{
+				oss << "Failure of mapped pixel values test\n";
+				oss << expGrid.infoStringContents("expGrid", "%4u") << '\n';
+				oss << gotGrid.infoStringContents("gotGrid", "%4u") << '\n';
+			}
+
+			ras::Grid<float> const expF
+				{ ras::grid::realGridOf<float>(expGrid) };
+			if (! nearlyEquals(fGrid, expF))
+			{
+				oss << "Failure of mapped realGridOf test\n";
+			}
+		}
+
+		std::filesystem::remove(pgmPath);
+	}
+
+	//! Check header parsing (with comments) and invalid files
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// header with comment lines and irregular whitespace
+		std::filesystem::path const pgmPath("./quadloco_test_ioMappedPGM2.pgm");
+		{
+			std::ofstream ofs(pgmPath, std::ios_base::binary);
+			ofs << "P5\n# a comment\n3  # inline\n 2\n255\n";
+			ofs << "abcdef";
+		}
+		io::MappedPGM const mappedPGM(pgmPath);
+		ras::SizeHW const expHW{ 2u, 3u };
+		if (! (isValid(mappedPGM) && (expHW == mappedPGM.hwSize())))
+		{
+			oss << "Failure of commented header test\n";
+			oss << "mappedPGM: " << mappedPGM << '\n';
+		}
+		else
+		if (! ('d' == (char)mappedPGM.gridView()(1u, 0u)))
+		{
+			oss << "Failure of commented header data test\n";
+		}
+
+		// truncated pixel data should be rejected
+		std::filesystem::path const badPath("./quadloco_test_ioMappedPGM3.pgm");
+		{
+			std::ofstream ofs(badPath, std::ios_base::binary);
+			ofs << "P5\n3 2\n255\nabc";
+		}
+		io::MappedPGM const badPGM(badPath);
+		if (isValid(badPGM))
+		{
+			oss << "Failure of truncated data null test\n";
+			oss << "badPGM: " << badPGM << '\n';
+		}
+
+		std::filesystem::remove(pgmPath);
+		std::filesystem::remove(badPath);
+	}
+
+}
+
+//! Check behavior of io::MappedPGM
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,168 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::mat::Mat2
+*/
+
+
+#include "QuadLoco/matMat2.hpp"
+
+#include "QuadLoco/imgVector.hpp"
+#include "QuadLoco/matEigen2D.hpp"
+#include "QuadLoco/matfunc.hpp"
+#include "QuadLoco/rasGrid.hpp"
+
+#include <Engabra>
+
+#include <iostream>
+#include <sstream>
+
+
+namespace
+{
+	//! Check basic operations (including at compile time)
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		// [DoxyExample01]
+
+		using namespace quadloco;
+
+		// values are stored on the stack (no heap allocation)
+		constexpr mat::Mat2 matA{ 2., 1., 1., 3. };
+
+		// basic operations can be evaluated at compile time
+		constexpr mat::Mat2 invA{ matA.inverse() };
+		constexpr mat::Mat2 gotIdent{ matA * invA };
+		static_assert(5. == matA.trace());
+		static_assert(5. == matA.determinant());
+		static_assert(isValid(invA));
+		static_assert(! mat::Mat2{}.isValid());
+
+		// singular matrix has a null inverse
+		constexpr mat::Mat2 singular{ 1., 2., 2., 4. };
+		static_assert(! isValid(singular.inverse()));
+
+		// matrix * vector product
+		constexpr img::Vector<double> vec{ 1., -1. };
+		constexpr img::Vector<double> gotVec{ matA * vec };
+		static_assert(1. == gotVec.theData[0]);
+		static_assert(-2. == gotVec.theData[1]);
+
+		// [DoxyExample01]
+
+		constexpr mat::Mat2 expIdent{ mat::Mat2::identity() };
+		constexpr double tol{ 4. * std::numeric_limits<double>::epsilon() };
+		if (! nearlyEquals(gotIdent, expIdent, tol))
+		{
+			oss << "Failure of inverse identity test\n";
+			oss << "exp:\n" << expIdent << '\n';
+			oss << "got:\n" << gotIdent << '\n';
+		}
+
+		// compare with (heap based) Matrix functions
+		mat::Matrix const invGrid{ mat::inverse2x2(matA.matrix()) };
+		mat::Mat2 const invFromGrid{ mat::Mat2::from(invGrid) };
+		if (! nearlyEquals(invFromGrid, invA))
+		{
+			oss << "Failure of Matrix inverse2x2 comparison test\n";
+			oss << "exp:\n" << invA << '\n';
+			oss << "got:\n" << invFromGrid << '\n';
+		}
+
+		// a non-2x2 grid produces a null Mat2
+		mat::Matrix const grid3x3(3u, 3u);
+		if (isValid(mat::Mat2::from(grid3x3)))
+		{
+			oss << "Failure of non-2x2 from() null test\n";
+		}
+	}
+
+	//! Check eigen decomposition of Mat2
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		// [DoxyExample02]
+
+		using namespace quadloco;
+
+		mat::Mat2 const srcMat{ 1.25, -1.50, -1.50, 2.125 };
+		mat::Eigen2D const eigen(srcMat);
+		mat::Mat2 const gotMat{ eigen.mat2() };
+
+		// same decomposition as from (heap based) Matrix
+		mat::Eigen2D const eigGrid(srcMat.matrix());
+		mat::Mat2 const expMat{ mat::Mat2::from(eigGrid.matrix()) };
+
+		// [DoxyExample02]
+
+		if (! nearlyEquals(gotMat, expMat))
+		{
+			oss << "Failure of eigen Mat2/Matrix reconstruction test\n";
+			oss << "exp:\n" << expMat << '\n';
+			oss << "got:\n" << gotMat << '\n';
+		}
+
+		using engabra::g3::nearlyEquals;
+		if (! (  nearlyEquals(eigGrid.valueMin(), eigen.valueMin())
+			  && nearlyEquals(eigGrid.valueMax(), eigen.valueMax())
+			  )
+		   )
+		{
+			oss << "Failure of eigen Mat2/Matrix consistency test\n";
+			oss << "eigen:\n" << eigen << '\n';
+			oss << "eigGrid:\n" << eigGrid << '\n';
+		}
+	}
+
+}
+
+//! Check behavior of mat::Mat2
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -108,6 +108,100 @@ namespace
 
 	}
 
+	//! Check refinement with reusable workspace
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(32u, 16u) };
+		ras::Grid<float> const & srcGrid = simQuadData.theGrid;
+		img::Spot const expCenterSpot{ simQuadData.theImgQuad.centerSpot() };
+		ras::RowCol const nomRC{ cast::rasRowCol(expCenterSpot) };
+
+		// [DoxyExample02]
+
+		ops::CenterRefinerEdge const refiner(srcGrid);
+
+		// scratch memory reused across (many) refinement calls
+		ops::CenterRefinerEdge::Workspace workspace{};
+		img::Hit const hitA{ refiner.imgHitNear(nomRC, 6u, &workspace) };
+		img::Hit const hitB{ refiner.imgHitNear(nomRC, 6u, &workspace) };
+		// different search radius (rebuilds angle tracker)
+		img::Hit const hitC{ refiner.imgHitNear(nomRC, 5u, &workspace) };
+
+		// [DoxyExample02]
+
+		img::Hit const expHitAB{ refiner.imgHitNear(nomRC, 6u) };
+		img::Hit const expHitC{ refiner.imgHitNear(nomRC, 5u) };
+
+		if (! expHitAB.isValid())
+		{
+			oss << "Failure of valid (no workspace) expHitAB test\n";
+		}
+		if (! (  nearlyEquals(hitA, expHitAB)
+			  && nearlyEquals(hitB, expHitAB)
+			  && nearlyEquals(hitC, expHitC)
+			  )
+		   )
+		{
+			oss << "Failure of workspace hit test\n";
+			oss << "expAB: " << expHitAB << '\n';
+			oss << " gotA: " << hitA << '\n';
+			oss << " gotB: " << hitB << '\n';
+			oss << " expC: " << expHitC << '\n';
+			oss << " gotC: " << hitC << '\n';
+		}
+
+	} // test2
+
+	//! Check on-demand gradients produce same hits as precomputed ones
+	void
+	test3
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(96u, 16u) };
+		ras::Grid<float> const & srcGrid = simQuadData.theGrid;
+		std::vector<std::size_t> const ringHalfSizes{ 5u, 3u };
+		std::vector<ras::PeakRCV> const peakRCVs
+			{ app::center::multiSymRingPeaks(srcGrid, ringHalfSizes) };
+
+		// [DoxyExample03]
+
+		// gradients computed only near candidates (srcGrid must persist)
+		ops::CenterRefinerEdge const lazyRefiner
+			(srcGrid, ops::CenterRefinerEdge::GradientMode::OnDemand);
+		std::vector<img::Hit> const gotHits
+			{ lazyRefiner.centerHits(peakRCVs, 6u) };
+
+		// [DoxyExample03]
+
+		ops::CenterRefinerEdge const fullRefiner(srcGrid);
+		std::vector<img::Hit> const expHits
+			{ fullRefiner.centerHits(peakRCVs, 6u) };
+
+		bool same
+			{ (! expHits.empty()) && (expHits.size() == gotHits.size()) };
+		for (std::size_t nn{0u} ; same && (nn < expHits.size()) ; ++nn)
+		{
+			same = gotHits[nn].nearlyEquals(expHits[nn]);
+		}
+		if (! same)
+		{
+			oss << "Failure of on-demand gradient hits test\n";
+			oss << "expHits.size: " << expHits.size() << '\n';
+			oss << "gotHits.size: " << gotHits.size() << '\n';
+		}
+
+	} // test3
+
 }
 
 //! Standard test case main wrapper
@@ -120,6 +214,8 @@ main
 
 //	test0(oss);
 	test1(oss);
+	test2(oss);
+	test3(oss);
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
 	{
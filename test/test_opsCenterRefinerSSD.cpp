@@ -38,6 +38,7 @@
 #include "QuadLoco/opsAllPeaks2D.hpp"
 #include "QuadLoco/opsCenterRefinerSSD.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasNullDistance.hpp"
 #include "QuadLoco/rasPeakRCV.hpp"
 #include "QuadLoco/rasSizeHW.hpp"
 #include "QuadLoco/simConfig.hpp"
@@ -162,6 +163,87 @@ std::cout << "edgCenterSpot: " << edgCenterSpot << '\n';
 
 	} // test1
 
+	//! Check refinement with reusable workspace
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(32u, 16u) };
+		ras::Grid<float> const & srcGrid = simQuadData.theGrid;
+		img::Spot const expCenterSpot{ simQuadData.theImgQuad.centerSpot() };
+		ras::RowCol const nomRC{ cast::rasRowCol(expCenterSpot) };
+
+		// [DoxyExample02]
+
+		ops::CenterRefinerSSD const refiner(&srcGrid, 2u, 6u);
+
+		// scratch memory reused across (many) refinement calls
+		ops::CenterRefinerSSD::Workspace workspace{};
+		img::Hit const hitA{ refiner.fitHitNear(nomRC, &workspace) };
+		img::Hit const hitB{ refiner.fitHitNear(nomRC, &workspace) };
+
+		// [DoxyExample02]
+
+		img::Hit const expHit{ refiner.fitHitNear(nomRC) };
+
+		if (! expHit.isValid())
+		{
+			oss << "Failure of valid (no workspace) expHit test\n";
+		}
+		if (! (nearlyEquals(hitA, expHit) && nearlyEquals(hitB, expHit)))
+		{
+			oss << "Failure of workspace hit test\n";
+			oss << "exp: " << expHit << '\n';
+			oss << "gotA: " << hitA << '\n';
+			oss << "gotB: " << hitB << '\n';
+		}
+
+		ras::SizeHW const expHW{ 5u, 5u };
+		if (! (  (expHW == workspace.theSsdGrid.hwSize())
+			  && (expHW == workspace.theProbGrid.hwSize())
+			  )
+		   )
+		{
+			oss << "Failure of workspace grid size test\n";
+			oss << "theSsdGrid: " << workspace.theSsdGrid << '\n';
+			oss << "theProbGrid: " << workspace.theProbGrid << '\n';
+		}
+
+	} // test2
+
+	//! Check that (optional) null distances do not change results
+	void
+	test3
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		sim::QuadData const simQuadData
+			{ sim::Render::simpleQuadData(32u, 16u) };
+		ras::Grid<float> const & srcGrid = simQuadData.theGrid;
+		img::Spot const expCenterSpot{ simQuadData.theImgQuad.centerSpot() };
+		ras::RowCol const nomRC{ cast::rasRowCol(expCenterSpot) };
+
+		ras::NullDistance const nullDist(srcGrid);
+		ops::CenterRefinerSSD const fastRefiner(&srcGrid, 2u, 6u, &nullDist);
+		ops::CenterRefinerSSD const slowRefiner(&srcGrid, 2u, 6u);
+
+		img::Hit const gotHit{ fastRefiner.fitHitNear(nomRC) };
+		img::Hit const expHit{ slowRefiner.fitHitNear(nomRC) };
+		if (! (expHit.isValid() && nearlyEquals(gotHit, expHit)))
+		{
+			oss << "Failure of null distance hit test\n";
+			oss << "exp: " << expHit << '\n';
+			oss << "got: " << gotHit << '\n';
+		}
+
+	} // test3
+
 }
 
 //! Standard test case main wrapper
@@ -174,6 +256,8 @@ main
 
 //	test0(oss);
 	test1(oss);
+	test2(oss);
+	test3(oss);
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
 	{
@@ -0,0 +1,128 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::ops::GradientGrid
+*/
+
+
+#include "QuadLoco/opsGradientGrid.hpp"
+
+#include "QuadLoco/imgGrad.hpp"
+#include "QuadLoco/opsgrid.hpp"
+#include "QuadLoco/rasGrid.hpp"
+
+#include <iostream>
+#include <sstream>
+
+
+namespace
+{
+	//! Check gradient component grids
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		ras::Grid<float> srcGrid(9u, 13u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((row * row + 5u * col) % 23u);
+			}
+		}
+
+		// [DoxyExample01]
+
+		// compute gradients into (float) component grids
+		ops::GradientGrid const gradGrid(srcGrid);
+
+		// individual components (or combined img::Grad) per cell
+		float const gRow{ gradGrid.rowGrads()(4u, 6u) };
+		img::Grad const grad{ gradGrid(4u, 6u) };
+
+		// [DoxyExample01]
+
+		// same values as (AoS) gradient grid
+		ras::Grid<img::Grad> const expGrads
+			{ ops::grid::gradientGridBy8x(srcGrid) };
+		bool same
+			{ isValid(gradGrid) && (expGrads.hwSize() == gradGrid.hwSize()) };
+		for (std::size_t row{0u} ; same && (row < expGrads.high()) ; ++row)
+		{
+			for (std::size_t col{0u} ; same && (col < expGrads.wide()) ; ++col)
+			{
+				img::Grad const & expGrad = expGrads(row, col);
+				img::Grad const gotGrad{ gradGrid(row, col) };
+				if (isValid(expGrad))
+				{
+					same = expGrad.nearlyEquals(gotGrad, 0.);
+				}
+				else
+				{
+					same = (! isValid(gotGrad));
+				}
+			}
+		}
+		if (! (same && ((double)gRow == grad[0])))
+		{
+			oss << "Failure of GradientGrid value test\n";
+			oss << "gradGrid: " << gradGrid << '\n';
+		}
+
+		// too small for gradients
+		ras::Grid<float> const tinyGrid(2u, 5u);
+		if (isValid(ops::GradientGrid(tinyGrid)))
+		{
+			oss << "Failure of tiny grid null test\n";
+		}
+	}
+
+}
+
+//! Check behavior of ops::GradientGrid
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
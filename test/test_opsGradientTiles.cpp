@@ -0,0 +1,236 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::ops::GradientTiles
+*/
+
+
+#include "QuadLoco/opsGradientTiles.hpp"
+
+#include "QuadLoco/imgGrad.hpp"
+#include "QuadLoco/opsGradientGrid.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/sysThreadPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <sstream>
+
+
+namespace
+{
+	//! Check lazy tile computation and values
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		ras::Grid<float> srcGrid(37u, 29u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((row * row + 5u * col) % 23u);
+			}
+		}
+
+		// [DoxyExample01]
+
+		// setup tiles (no gradients computed yet)
+		constexpr std::size_t tileSize{ 8u };
+		ops::GradientTiles const gradTiles(&srcGrid, tileSize);
+		std::size_t const numAtStart{ gradTiles.numTilesComputed() };
+
+		// compute (only) tiles overlapping area of interest
+		gradTiles.prepareArea(6u, 11u, 12u, 17u); // overlaps 2x2 tiles
+		std::size_t const numAfterOne{ gradTiles.numTilesComputed() };
+
+		// overlapping area reuses already computed tiles
+		gradTiles.prepareArea(7u, 10u, 13u, 16u);
+		std::size_t const numAfterTwo{ gradTiles.numTilesComputed() };
+
+		// access gradient values
+		img::Grad const grad{ gradTiles(9u, 14u) };
+
+		// [DoxyExample01]
+
+		if (! (  (0u == numAtStart)
+			  && (4u == numAfterOne)
+			  && (4u == numAfterTwo)
+			  ))
+		{
+			oss << "Failure of lazy tile count test\n";
+			oss << "numAtStart: " << numAtStart << '\n';
+			oss << "numAfterOne: " << numAfterOne << '\n';
+			oss << "numAfterTwo: " << numAfterTwo << '\n';
+		}
+
+		// unprepared areas are reported as null
+		if (isValid(gradTiles(30u, 3u)))
+		{
+			oss << "Failure of unprepared null test\n";
+		}
+
+		// prepared values are identical to full precomputation
+		ops::GradientGrid const expGrid(srcGrid);
+		gradTiles.prepareArea(0u, srcGrid.high(), 0u, srcGrid.wide());
+		bool same
+			{ isValid(gradTiles)
+			&& (gradTiles.numTiles() == gradTiles.numTilesComputed())
+			&& (expGrid(9u, 14u).nearlyEquals(grad, 0.))
+			};
+		for (std::size_t row{0u} ; same && (row < srcGrid.high()) ; ++row)
+		{
+			for (std::size_t col{0u} ; same && (col < srcGrid.wide()) ; ++col)
+			{
+				img::Grad const expGrad{ expGrid(row, col) };
+				img::Grad const gotGrad{ gradTiles(row, col) };
+				if (isValid(expGrad))
+				{
+					same = expGrad.nearlyEquals(gotGrad, 0.);
+				}
+				else
+				{
+					same = (! isValid(gotGrad));
+				}
+			}
+		}
+		if (! same)
+		{
+			oss << "Failure of GradientTiles value test\n";
+			oss << "gradTiles: " << gradTiles << '\n';
+		}
+
+		// too small for gradients
+		ras::Grid<float> const tinyGrid(2u, 5u);
+		if (isValid(ops::GradientTiles(&tinyGrid)))
+		{
+			oss << "Failure of tiny grid null test\n";
+		}
+	}
+
+	//! Check concurrent preparation and access of a shared instance
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		ras::Grid<float> srcGrid(97u, 83u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((3u * row * col + col) % 31u);
+			}
+		}
+		ops::GradientGrid const expGrid(srcGrid);
+
+		// one (const) instance shared by all threads
+		ops::GradientTiles const gradTiles(&srcGrid, 16u);
+		std::atomic<std::size_t> numBad{ 0u };
+		std::size_t const high{ srcGrid.high() };
+		std::size_t const wide{ srcGrid.wide() };
+		constexpr std::size_t halo{ 3u };
+		sys::ThreadPool pool(4u); // (concurrent even on a single core)
+		pool.forEachBand
+			( 0u, high
+			, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+				{
+					for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+					{
+						// (overlapping) window about each row
+						std::size_t const winBeg{ std::max(row, halo) - halo };
+						std::size_t const winEnd{ row + halo + 1u };
+						gradTiles.prepareArea(winBeg, winEnd, 0u, wide);
+						for (std::size_t col{0u} ; col < wide ; ++col)
+						{
+							img::Grad const expGrad{ expGrid(row, col) };
+							img::Grad const gotGrad{ gradTiles(row, col) };
+							bool const same
+								{ isValid(expGrad)
+								? expGrad.nearlyEquals(gotGrad, 0.)
+								: (! isValid(gotGrad))
+								};
+							if (! same)
+							{
+								++numBad;
+							}
+
+							// cell in area possibly being prepared by
+							// another thread: either null or correct
+							std::size_t const probeRow{ (row + 29u) % high };
+							img::Grad const probeGrad
+								{ gradTiles(probeRow, col) };
+							if ( isValid(probeGrad)
+							  && (! expGrid(probeRow, col)
+								.nearlyEquals(probeGrad, 0.))
+							   )
+							{
+								++numBad;
+							}
+						}
+					}
+				}
+			);
+
+		std::size_t const numComputed{ gradTiles.numTilesComputed() };
+		if (! ((0u == numBad) && (gradTiles.numTiles() == numComputed)))
+		{
+			oss << "Failure of concurrent GradientTiles test\n";
+			oss << "numBad: " << numBad << '\n';
+			oss << "numComputed: " << numComputed << '\n';
+		}
+	}
+
+}
+
+//! Check behavior of ops::GradientTiles
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
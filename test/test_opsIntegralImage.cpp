@@ -0,0 +1,282 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::ops::IntegralImage
+*/
+
+
+#include "QuadLoco/opsIntegralImage.hpp"
+
+#include "QuadLoco/opsfilter.hpp"
+#include "QuadLoco/opsgrid.hpp"
+#include "QuadLoco/rasChipSpec.hpp"
+#include "QuadLoco/rasGrid.hpp"
+
+#include <Engabra>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	//! Check box statistics against brute force evaluation
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		ras::Grid<float> srcGrid(11u, 17u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((3u * row + 7u * col) % 13u);
+			}
+		}
+		srcGrid(5u, 6u) = std::numeric_limits<float>::quiet_NaN();
+
+		// [DoxyExample01]
+
+		// summed area tables (computed once)
+		ops::IntegralImage const integral(srcGrid);
+
+		// statistics for any box in constant time
+		ras::ChipSpec const box{ ras::RowCol{ 3u, 4u }, ras::SizeHW{ 5u, 6u } };
+		std::size_t const gotCount{ integral.count(box) }; // excludes null
+		double const gotSum{ integral.sum(box) };
+		double const gotMean{ integral.mean(box) };
+		double const gotVar{ integral.variance(box) };
+
+		// [DoxyExample01]
+
+		// brute force evaluation
+		std::size_t expCount{ 0u };
+		double expSum{ 0. };
+		double expSumSq{ 0. };
+		for (std::size_t row{box.srcRowBeg()} ; row < box.srcRowEnd() ; ++row)
+		{
+			for (std::size_t col{box.srcColBeg()} ; col < box.srcColEnd()
+				; ++col)
+			{
+				float const & value = srcGrid(row, col);
+				if (engabra::g3::isValid(value))
+				{
+					++expCount;
+					expSum += (double)value;
+					expSumSq += (double)value * (double)value;
+				}
+			}
+		}
+		double const expMean{ expSum / (double)expCount };
+		double const expVar
+			{ expSumSq / (double)expCount - expMean * expMean };
+
+		constexpr double tol{ 1.e-12 };
+		if (! (  (expCount == gotCount)
+			  && (29u == gotCount)
+			  && engabra::g3::nearlyEquals(gotSum, expSum, tol)
+			  && engabra::g3::nearlyEquals(gotMean, expMean, tol)
+			  && engabra::g3::nearlyEquals(gotVar, expVar, tol)
+			  && (! integral.isFull(box))
+			  ))
+		{
+			oss << "Failure of IntegralImage box statistics test\n";
+			oss << "exp: " << expCount << ' ' << expSum
+				<< ' ' << expMean << ' ' << expVar << '\n';
+			oss << "got: " << gotCount << ' ' << gotSum
+				<< ' ' << gotMean << ' ' << gotVar << '\n';
+		}
+
+		// full source area and a (fully valid) single row
+		ras::ChipSpec const allBox{ ras::RowCol{ 0u, 0u }, srcGrid.hwSize() };
+		ras::ChipSpec const rowBox
+			{ ras::RowCol{ 2u, 0u }, ras::SizeHW{ 1u, 17u } };
+		if (! (  ((11u * 17u - 1u) == integral.count(allBox))
+			  && integral.isFull(rowBox)
+			  ))
+		{
+			oss << "Failure of IntegralImage full area test\n";
+		}
+
+		// box extending outside source
+		ras::ChipSpec const outBox
+			{ ras::RowCol{ 8u, 0u }, ras::SizeHW{ 4u, 2u } };
+		if (! ((0u == integral.count(outBox))
+			  && (! engabra::g3::isValid(integral.mean(outBox)))
+			  ))
+		{
+			oss << "Failure of IntegralImage outside box test\n";
+		}
+
+		if (isValid(ops::IntegralImage{}))
+		{
+			oss << "Failure of null IntegralImage test\n";
+		}
+	}
+
+	//! Check precision on large image with large values (high offset)
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using engabra::g3::isValid;
+
+		// small (exactly representable) variations on large offset
+		constexpr float offset{ 100000.f };
+		ras::Grid<float> srcGrid(300u, 260u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				float const delta{ (float)((3u * row + 7u * col) % 13u) };
+				srcGrid(row, col) = offset + .25f * delta;
+			}
+		}
+		srcGrid(130u, 70u) = std::numeric_limits<float>::quiet_NaN();
+
+		// variance (about the box mean) by brute force (in two passes)
+		ops::IntegralImage const integral(srcGrid);
+		std::size_t numBad{ 0u };
+		double maxErr{ 0. };
+		// (within one tile, across tile corners, spanning many tiles)
+		std::vector<ras::ChipSpec> const boxes
+			{ ras::ChipSpec{ ras::RowCol{ 3u, 5u }, ras::SizeHW{ 7u, 9u } }
+			, ras::ChipSpec{ ras::RowCol{ 125u, 62u }, ras::SizeHW{ 9u, 9u } }
+			, ras::ChipSpec{ ras::RowCol{ 250u, 3u }, ras::SizeHW{ 50u, 257u } }
+			, ras::ChipSpec{ ras::RowCol{ 0u, 0u }, srcGrid.hwSize() }
+			};
+		for (ras::ChipSpec const & box : boxes)
+		{
+			std::size_t num{ 0u };
+			double sum{ 0. };
+			for (std::size_t row{box.srcRowBeg()} ; row < box.srcRowEnd()
+				; ++row)
+			{
+				for (std::size_t col{box.srcColBeg()} ; col < box.srcColEnd()
+					; ++col)
+				{
+					float const & value = srcGrid(row, col);
+					if (isValid(value))
+					{
+						++num;
+						sum += (double)value;
+					}
+				}
+			}
+			double const expMean{ sum / (double)num };
+			double sumSqDif{ 0. };
+			for (std::size_t row{box.srcRowBeg()} ; row < box.srcRowEnd()
+				; ++row)
+			{
+				for (std::size_t col{box.srcColBeg()} ; col < box.srcColEnd()
+					; ++col)
+				{
+					float const & value = srcGrid(row, col);
+					if (isValid(value))
+					{
+						double const dif{ (double)value - expMean };
+						sumSqDif += dif * dif;
+					}
+				}
+			}
+			double const expVar{ sumSqDif / (double)num };
+			double const gotVar{ integral.variance(box) };
+			double const err{ std::abs(gotVar - expVar) };
+			maxErr = std::max(maxErr, err);
+			if (! ( (num == integral.count(box))
+				 && (err < 1.e-9)
+				 && (std::abs(integral.mean(box) - expMean) < 1.e-9)
+				  ))
+			{
+				++numBad;
+			}
+		}
+
+		// sum of squared differences against brute force filter
+		ras::SizeHW const hwBox{ 5u, 5u };
+		ras::Grid<float> const gotSsds
+			{ ops::grid::sumSquareDiffGridFor<float>(srcGrid, hwBox) };
+		ops::filter::SumSquareDiff<float> ssdFunc{};
+		ras::Grid<float> const expSsds
+			{ ops::grid::functionResponse<float, float>
+				(srcGrid, hwBox, ssdFunc)
+			};
+		std::size_t numDiff{ 0u };
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				float const & expSsd = expSsds(row, col);
+				float const & gotSsd = gotSsds(row, col);
+				if (isValid(expSsd) && (! (expSsd == gotSsd)))
+				{
+					++numDiff;
+				}
+			}
+		}
+
+		if (! ((0u == numBad) && (0u == numDiff)))
+		{
+			oss << "Failure of IntegralImage high offset precision test\n";
+			oss << "numBad: " << numBad << '\n';
+			oss << "maxErr: " << maxErr << '\n';
+			oss << "numDiff: " << numDiff << '\n';
+		}
+	}
+
+}
+
+//! Check behavior of ops::IntegralImage
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
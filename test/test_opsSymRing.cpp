@@ -35,10 +35,14 @@
 #include "QuadLoco/rasChipSpec.hpp"
 #include "QuadLoco/rasgrid.hpp"
 #include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasNullDistance.hpp"
 #include "QuadLoco/rasPeakRCV.hpp"
 
+#include <algorithm>
 #include <iostream>
+#include <limits>
 #include <sstream>
+#include <vector>
 
 
 namespace
@@ -113,6 +117,571 @@ namespace
 
 	}
 
+	//! Check that (optional) null distances do not change responses
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		ras::Grid<float> srcGrid(24u, 28u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((row * row + 3u * col) % 7u);
+			}
+		}
+		srcGrid(6u, 7u) = std::numeric_limits<float>::quiet_NaN();
+		srcGrid(17u, 20u) = std::numeric_limits<float>::quiet_NaN();
+		prb::Stats<float> const srcStats
+			{ ops::statsFor(ras::GridView<float>(srcGrid)) };
+		std::size_t const halfSize{ 3u };
+
+		// [DoxyExample02]
+
+		// computed once per source, then shared by filters
+		ras::NullDistance const nullDist(srcGrid);
+		ops::SymRing const fastRing(&srcGrid, srcStats, halfSize, &nullDist);
+
+		// [DoxyExample02]
+
+		// null instance: no window is known valid (per-sample checks)
+		ras::NullDistance const noDist{};
+		ops::SymRing const slowRing(&srcGrid, srcStats, halfSize, &noDist);
+		ras::Grid<float> const expGrid
+			{ ops::symRingGridFor(srcGrid, slowRing) };
+		ras::Grid<float> const gotGrid
+			{ ops::symRingGridFor(srcGrid, fastRing) };
+
+		// if not provided, null distances are computed by SymRing itself
+		ops::SymRing const ownRing(&srcGrid, srcStats, halfSize);
+		ras::Grid<float> const ownGrid
+			{ ops::symRingGridFor(srcGrid, ownRing) };
+		bool ownOkay
+			{  ownRing.thePtNullDist
+			&& ownRing.thePtNullDist->isValid()
+			&& (ownRing.thePtNullDist->numNulls() == nullDist.numNulls())
+			};
+		for (std::size_t row{0u} ; ownOkay && (row < srcGrid.high()) ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				float const & ownVal = ownGrid(row, col);
+				float const & gotVal = gotGrid(row, col);
+				ownOkay &=
+					(  (pix::isValid(ownVal) == pix::isValid(gotVal))
+					&& ((! pix::isValid(gotVal)) || (ownVal == gotVal))
+					);
+			}
+		}
+		if (! ownOkay)
+		{
+			oss << "Failure of SymRing owned null distance test\n";
+		}
+
+		bool same{ true };
+		std::size_t numNull{ 0u };
+		for (std::size_t row{0u} ; same && (row < srcGrid.high()) ; ++row)
+		{
+			for (std::size_t col{0u} ; same && (col < srcGrid.wide()) ; ++col)
+			{
+				float const & expVal = expGrid(row, col);
+				float const & gotVal = gotGrid(row, col);
+				if (pix::isValid(expVal))
+				{
+					same = (expVal == gotVal);
+				}
+				else
+				{
+					same = (! pix::isValid(gotVal));
+					++numNull;
+				}
+			}
+		}
+		if (! (same && (0u < numNull)))
+		{
+			oss << "Failure of SymRing null distance test\n";
+		}
+	}
+
+	//! Check compile-time (unrolled) ring sizes
+	void
+	test3
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// unrolled evaluation (compile-time offsets) for these rings
+		std::vector<ras::RelRC> const relRCs3{ ops::annularRelRCs(3u) };
+		std::vector<ras::RelRC> const relRCs5{ ops::annularRelRCs(5u) };
+		std::size_t const gotPairs3{ relRCs3.size() / 2u };
+		std::size_t const gotPairs5{ relRCs5.size() / 2u };
+		bool const sameRCs3
+			{ std::equal
+				( relRCs3.cbegin(), relRCs3.cend()
+				, ops::SymRing::theRelRCsR3.cbegin()
+				, ops::SymRing::theRelRCsR3.cend()
+				)
+			};
+		bool const sameRCs5
+			{ std::equal
+				( relRCs5.cbegin(), relRCs5.cend()
+				, ops::SymRing::theRelRCsR5.cbegin()
+				, ops::SymRing::theRelRCsR5.cend()
+				)
+			};
+		if (! ( (ops::SymRing::theNumPairsR3 == gotPairs3)
+			 && (ops::SymRing::theNumPairsR5 == gotPairs5)
+			 && sameRCs3
+			 && sameRCs5
+			  ))
+		{
+			oss << "Failure of SymRing unrolled ring size test\n";
+			oss << "exp3: " << ops::SymRing::theNumPairsR3 << '\n';
+			oss << "got3: " << gotPairs3 << '\n';
+			oss << "exp5: " << ops::SymRing::theNumPairsR5 << '\n';
+			oss << "got5: " << gotPairs5 << '\n';
+			oss << "sameRCs3: " << sameRCs3 << '\n';
+			oss << "sameRCs5: " << sameRCs5 << '\n';
+		}
+
+		// unrolled (null free) evaluation same as general evaluation
+		ras::Grid<float> srcGrid(32u, 30u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((row * col + 5u * row) % 9u);
+			}
+		}
+		prb::Stats<float> const srcStats
+			{ ops::statsFor(ras::GridView<float>(srcGrid)) };
+		ras::NullDistance const nullDist(srcGrid);
+		for (std::size_t const halfSize : { 3u, 4u, 5u })
+		{
+			ops::SymRing const fastRing
+				(&srcGrid, srcStats, halfSize, &nullDist);
+			std::size_t const ringHalf{ fastRing.halfSize() };
+			std::size_t numDiff{ 0u };
+			for (std::size_t row{ringHalf} ; row + ringHalf < srcGrid.high()
+				; ++row)
+			{
+				for (std::size_t col{ringHalf}
+					; col + ringHalf < srcGrid.wide() ; ++col)
+				{
+					// general (runtime offsets) loop over ring pairs
+					ops::SymRing::RingStats expStats{};
+					for (std::size_t nn{0u} ; nn < fastRing.theHalfRingSize
+						; ++nn)
+					{
+						fastRing.considerPair(&expStats, row, col, nn);
+					}
+					float const expVal{ fastRing.responseFor(expStats) };
+					float const gotVal{ fastRing(row, col) };
+					if (! (expVal == gotVal))
+					{
+						++numDiff;
+					}
+				}
+			}
+			if (! (0u == numDiff))
+			{
+				oss << "Failure of SymRing unrolled evaluation test\n";
+				oss << "halfSize: " << halfSize << '\n';
+				oss << "numDiff: " << numDiff << '\n';
+			}
+		}
+	}
+
+	//! Check row evaluation (SIMD for valid rings) matches operator()
+	void
+	test4
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using sys::cpu::SimdLevel;
+
+		ras::Grid<float> srcGrid(28u, 53u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((row * row + 11u * col) % 13u);
+			}
+		}
+		srcGrid(9u, 30u) = std::numeric_limits<float>::quiet_NaN();
+		prb::Stats<float> const srcStats
+			{ ops::statsFor(ras::GridView<float>(srcGrid)) };
+		ras::NullDistance const nullDist(srcGrid);
+
+		for (std::size_t const halfSize : { 2u, 3u, 5u })
+		{
+			ops::SymRing const symRing
+				(&srcGrid, srcStats, halfSize, &nullDist);
+			std::size_t const beg{ symRing.halfSize() };
+			std::size_t const endRow{ srcGrid.high() - beg };
+			std::size_t const endCol{ srcGrid.wide() - beg };
+
+			// [DoxyExample04]
+
+			// evaluate (a row at a time) with vector instructions
+			std::vector<float> rowVals(endCol - beg);
+			symRing.fillRow(beg + 5u, beg, endCol, rowVals.data());
+
+			// [DoxyExample04]
+
+			// (work space reused for all rows and levels)
+			ops::SymRing::RingScratch scratch{};
+			std::size_t numDiff{ 0u };
+			for (SimdLevel const level
+				: { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				for (std::size_t row{beg} ; row < endRow ; ++row)
+				{
+					symRing.fillRow
+						(row, beg, endCol, rowVals.data(), level, &scratch);
+					for (std::size_t col{beg} ; col < endCol ; ++col)
+					{
+						float const expVal{ symRing(row, col) };
+						float const & gotVal = rowVals[col - beg];
+						bool const same
+							{ (pix::isValid(expVal) == pix::isValid(gotVal))
+							&& ((! pix::isValid(expVal)) || (expVal == gotVal))
+							};
+						if (! same)
+						{
+							++numDiff;
+						}
+					}
+				}
+			}
+			if (! (0u == numDiff))
+			{
+				oss << "Failure of SymRing fillRow test\n";
+				oss << "halfSize: " << halfSize << '\n';
+				oss << "numDiff: " << numDiff << '\n';
+			}
+		}
+	}
+
+	//! Check sliding window min/max against direct evaluation
+	void
+	test5
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		constexpr float inf{ std::numeric_limits<float>::infinity() };
+		std::vector<float> srcVals(37u);
+		for (std::size_t ndx{0u} ; ndx < srcVals.size() ; ++ndx)
+		{
+			srcVals[ndx] = (float)((ndx * 17u) % 11u);
+		}
+		srcVals[6u] = std::numeric_limits<float>::quiet_NaN();
+
+		ops::SlidingMinMax slider{};
+		std::size_t numBad{ 0u };
+		for (std::size_t halfSize{0u} ; halfSize < 7u ; ++halfSize)
+		{
+			// use every other source value (i.e. step of 2)
+			std::size_t const num{ srcVals.size() / 2u };
+			std::vector<float> gotMins(num, -1.f);
+			std::vector<float> gotMaxs(num, -1.f);
+			slider.fill
+				( srcVals.data(), num, 2, halfSize
+				, gotMins.data(), gotMaxs.data()
+				);
+			for (std::size_t ndx{halfSize} ; ndx < (num - halfSize) ; ++ndx)
+			{
+				float expMin{ inf };
+				float expMax{ -inf };
+				for (std::size_t nn{ndx-halfSize} ; nn < ndx+halfSize+1u ; ++nn)
+				{
+					float const & val = srcVals[2u * nn];
+					if (pix::isValid(val))
+					{
+						expMin = std::min(expMin, val);
+						expMax = std::max(expMax, val);
+					}
+				}
+				if (! ((expMin == gotMins[ndx]) && (expMax == gotMaxs[ndx])))
+				{
+					++numBad;
+				}
+			}
+		}
+		if (! (0u == numBad))
+		{
+			oss << "Failure of SlidingMinMax test\n";
+			oss << "numBad: " << numBad << '\n';
+		}
+	}
+
+	//! Check pre-screened evaluation (skip cells with no possible response)
+	void
+	test6
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// flat background with a (four quadrant) target in the middle
+		ras::Grid<float> srcGrid(60u, 80u);
+		std::fill(srcGrid.begin(), srcGrid.end(), .25f);
+		for (std::size_t row{12u} ; row < 28u ; ++row)
+		{
+			for (std::size_t col{17u} ; col < 33u ; ++col)
+			{
+				bool const isHi{ (row < 20u) == (col < 25u) };
+				srcGrid(row, col) = isHi ? 1.f : 0.f;
+			}
+		}
+		srcGrid(3u, 4u) = std::numeric_limits<float>::quiet_NaN();
+		srcGrid(16u, 21u) = std::numeric_limits<float>::quiet_NaN();
+		prb::Stats<float> const srcStats
+			{ ops::statsFor(ras::GridView<float>(srcGrid)) };
+		ras::NullDistance const nullDist(srcGrid);
+		ras::GridView<float> const srcView(srcGrid);
+
+		for (std::size_t const halfSize : { 2u, 3u, 5u })
+		{
+			ops::SymRing const symRing(srcView, srcStats, halfSize, &nullDist);
+			ras::Grid<float> const expGrid
+				{ ops::symRingGridFor(srcView, symRing) };
+
+			// [DoxyExample05]
+
+			// evaluate full ring only where response can be nonzero
+			ops::ScreenStats screenStats{};
+			ras::Grid<float> const gotGrid
+				{ ops::symRingScreenedGridFor
+					(srcView, symRing, 0.f, &screenStats)
+				};
+			double const fracSkip{ screenStats.fractionSkipped() };
+
+			// [DoxyExample05]
+
+			std::size_t numDiff{ 0u };
+			for (std::size_t row{0u} ; row < expGrid.high() ; ++row)
+			{
+				for (std::size_t col{0u} ; col < expGrid.wide() ; ++col)
+				{
+					float const & expVal = expGrid(row, col);
+					float const & gotVal = gotGrid(row, col);
+					bool const same
+						{ (pix::isValid(expVal) == pix::isValid(gotVal))
+						&& ((! pix::isValid(expVal)) || (expVal == gotVal))
+						};
+					numDiff += same ? 0u : 1u;
+				}
+			}
+			if (! (0u == numDiff))
+			{
+				oss << "Failure of screened SymRing grid test\n";
+				oss << "halfSize: " << halfSize << '\n';
+				oss << "numDiff: " << numDiff << '\n';
+			}
+
+			// most of the (flat) background should be skipped
+			if (! (.5 < fracSkip))
+			{
+				oss << "Failure of screen fractionSkipped test\n";
+				oss << "halfSize: " << halfSize << '\n';
+				oss << "screenStats: " << screenStats << '\n';
+			}
+
+			// approximate screening only discards responses below threshold
+			float const minResponse{ .5f };
+			ops::ScreenStats approxStats{};
+			ras::Grid<float> const approxGrid
+				{ ops::symRingScreenedGridFor
+					(srcView, symRing, minResponse, &approxStats)
+				};
+			std::size_t numBig{ 0u };
+			for (std::size_t row{0u} ; row < expGrid.high() ; ++row)
+			{
+				for (std::size_t col{0u} ; col < expGrid.wide() ; ++col)
+				{
+					float const & expVal = expGrid(row, col);
+					float const & gotVal = approxGrid(row, col);
+					if ( pix::isValid(expVal) && (! (expVal == gotVal))
+					  && (! (expVal < minResponse))
+					   )
+					{
+						++numBig;
+					}
+				}
+			}
+			if (! ( (0u == numBig)
+				 && (! (approxStats.theNumSkipped < screenStats.theNumSkipped))
+				  ))
+			{
+				oss << "Failure of approximate screen test\n";
+				oss << "halfSize: " << halfSize << '\n';
+				oss << "numBig: " << numBig << '\n';
+				oss << "approxStats: " << approxStats << '\n';
+			}
+		}
+	}
+
+	//! Check evaluation at scattered cells matches operator()
+	void
+	test7
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using sys::cpu::SimdLevel;
+
+		ras::Grid<float> srcGrid(31u, 43u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((row * col + 7u * col) % 17u);
+			}
+		}
+		srcGrid(12u, 20u) = std::numeric_limits<float>::quiet_NaN();
+		prb::Stats<float> const srcStats
+			{ ops::statsFor(ras::GridView<float>(srcGrid)) };
+		ras::NullDistance const nullDist(srcGrid);
+
+		for (std::size_t const halfSize : { 2u, 3u, 5u })
+		{
+			ops::SymRing const symRing
+				(&srcGrid, srcStats, halfSize, &nullDist);
+			std::size_t const beg{ symRing.halfSize() };
+			std::size_t const numRows{ srcGrid.high() - 2u*beg };
+			std::size_t const numCols{ srcGrid.wide() - 2u*beg };
+			std::vector<ras::RowCol> rowcols;
+			for (std::size_t nn{0u} ; nn < 53u ; ++nn)
+			{
+				rowcols.emplace_back
+					( ras::RowCol
+						{ beg + ((nn * 13u) % numRows)
+						, beg + ((nn * 29u) % numCols)
+						}
+					);
+			}
+
+			// [DoxyExample07]
+
+			// evaluate at (e.g. peak) locations - several at a time
+			std::vector<float> values(rowcols.size());
+			symRing.fillCells(rowcols, values.data());
+
+			// [DoxyExample07]
+
+			// (work space reused for all levels)
+			ops::SymRing::RingScratch scratch{};
+			std::size_t numDiff{ 0u };
+			for (SimdLevel const level
+				: { SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 })
+			{
+				symRing.fillCells(rowcols, values.data(), level, &scratch);
+				for (std::size_t nn{0u} ; nn < rowcols.size() ; ++nn)
+				{
+					float const expVal
+						{ symRing(rowcols[nn].row(), rowcols[nn].col()) };
+					float const & gotVal = values[nn];
+					bool const same
+						{ (pix::isValid(expVal) == pix::isValid(gotVal))
+						&& ((! pix::isValid(expVal)) || (expVal == gotVal))
+						};
+					numDiff += same ? 0u : 1u;
+				}
+			}
+			if (! (0u == numDiff))
+			{
+				oss << "Failure of SymRing fillCells test\n";
+				oss << "halfSize: " << halfSize << '\n';
+				oss << "numDiff: " << numDiff << '\n';
+			}
+		}
+	}
+
+	//! Check fused (streaming) peak finding matches two-step evaluation
+	void
+	test8
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		ras::Grid<float> fullGrid(47u, 61u);
+		for (std::size_t row{0u} ; row < fullGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < fullGrid.wide() ; ++col)
+			{
+				fullGrid(row, col)
+					= (float)((row * row + 5u * col * col) % 23u);
+			}
+		}
+		fullGrid(20u, 30u) = std::numeric_limits<float>::quiet_NaN();
+
+		// full grid, a chip, and (nearly) minimum size chips
+		std::vector<ras::ChipSpec> const chipSpecs
+			{ ras::ChipSpec{ ras::RowCol{ 0u, 0u }, fullGrid.hwSize() }
+			, ras::ChipSpec{ ras::RowCol{ 5u, 7u }, ras::SizeHW{ 31u, 40u } }
+			, ras::ChipSpec{ ras::RowCol{ 3u, 2u }, ras::SizeHW{ 12u, 12u } }
+			, ras::ChipSpec{ ras::RowCol{ 3u, 2u }, ras::SizeHW{ 7u, 9u } }
+			};
+		std::size_t numPeaks{ 0u };
+		for (ras::ChipSpec const & chipSpec : chipSpecs)
+		{
+			ras::GridView<float> const srcView
+				{ ras::GridView<float>(fullGrid).subViewFor(chipSpec) };
+			prb::Stats<float> const srcStats{ ops::statsFor(srcView) };
+			ras::NullDistance const nullDist(srcView);
+			for (std::size_t const halfSize : { 2u, 3u, 5u })
+			{
+				ops::SymRing const symRing
+					(srcView, srcStats, halfSize, &nullDist);
+
+				// two-step: full response grid then peak finding
+				ras::Grid<float> const symGrid
+					{ ops::symRingGridFor(srcView, symRing) };
+				std::vector<ras::PeakRCV> const expPeaks
+					{ ops::AllPeaks2D::unsortedPeakRCVs(symGrid) };
+
+				// [DoxyExample08]
+
+				// fused: rolling three row response window
+				std::vector<ras::PeakRCV> const gotPeaks
+					{ ops::symRingPeaksFor(srcView, symRing) };
+
+				// [DoxyExample08]
+
+				bool same{ (expPeaks.size() == gotPeaks.size()) };
+				for (std::size_t nn{0u} ; same && (nn < expPeaks.size()) ; ++nn)
+				{
+					same =
+						(  (expPeaks[nn].theRowCol == gotPeaks[nn].theRowCol)
+						&& (expPeaks[nn].theValue == gotPeaks[nn].theValue)
+						);
+				}
+				if (! same)
+				{
+					oss << "Failure of fused symRingPeaksFor test\n";
+					oss << "chipSpec: " << chipSpec << '\n';
+					oss << "halfSize: " << halfSize << '\n';
+					oss << "exp.size: " << expPeaks.size() << '\n';
+					oss << "got.size: " << gotPeaks.size() << '\n';
+				}
+				numPeaks += gotPeaks.size();
+			}
+		}
+		if (! (0u < numPeaks))
+		{
+			oss << "Failure of fused test setup (no peaks found)\n";
+		}
+	}
+
 }
 
 //! Standard test case main wrapper
@@ -125,6 +694,13 @@ main
 
 //	test0(oss);
 	test1(oss);
+	test2(oss);
+	test3(oss);
+	test4(oss);
+	test5(oss);
+	test6(oss);
+	test7(oss);
+	test8(oss);
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
 	{
@@ -34,16 +34,63 @@
 #include "QuadLoco/rasgrid.hpp"
 #include "QuadLoco/rasGrid.hpp"
 #include "QuadLoco/raskernel.hpp"
+#include "QuadLoco/rasNullDistance.hpp"
+#include "QuadLoco/rasPaddedGrid.hpp"
 #include "QuadLoco/rasRowCol.hpp"
 #include "QuadLoco/simgrid.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 
 namespace
 {
+	//! True if both are null or if both have identical values
+	inline
+	bool
+	sameValue
+		( double const & valA
+		, double const & valB
+		)
+	{
+		bool const okA{ engabra::g3::isValid(valA) };
+		bool const okB{ engabra::g3::isValid(valB) };
+		return ((okA == okB) && ((! okA) || (valA == valB)));
+	}
+
+	//! True if both are null or if both have identical components
+	inline
+	bool
+	sameValue
+		( quadloco::img::Grad const & gradA
+		, quadloco::img::Grad const & gradB
+		)
+	{
+		return (  sameValue(gradA[0], gradB[0])
+			   && sameValue(gradA[1], gradB[1])
+			   );
+	}
+
+	//! True if grids are same size and all cells are sameValue()
+	template <typename Type>
+	inline
+	bool
+	sameGrids
+		( quadloco::ras::Grid<Type> const & gridA
+		, quadloco::ras::Grid<Type> const & gridB
+		)
+	{
+		bool same{ (gridA.hwSize() == gridB.hwSize()) };
+		for (std::size_t nn{0u} ; same && (nn < gridA.size()) ; ++nn)
+		{
+			same = sameValue(*(gridA.cbegin() + nn), *(gridB.cbegin() + nn));
+		}
+		return same;
+	}
+
 	//! Examples for documentation
 	void
 	test1
@@ -486,6 +533,487 @@ namespace
 		}
 	}
 
+	//! Streaming (fused) linked edgel extraction matches two pass version
+	void
+	test7
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// source with edge (with ramp transition) plus texture and a null
+		ras::SizeHW const hwSize{ 23u, 31u };
+		img::Edgel const edgel
+			{ img::Spot{ 11.5, 15.25 }, img::Grad{ .6, -.8 } };
+		ras::Grid<float> srcGrid
+			{ sim::gridWithEdge(hwSize, edgel, sim::Transition::Ramp) };
+		for (std::size_t row{0u} ; row < hwSize.high() ; row += 3u)
+		{
+			for (std::size_t col{0u} ; col < hwSize.wide() ; col += 5u)
+			{
+				srcGrid(row, col) += .25f * (float)((row + col) % 3u);
+			}
+		}
+		srcGrid(7u, 9u) = std::numeric_limits<float>::quiet_NaN();
+
+		// [DoxyExample07]
+
+		// edgels directly from source (without full gradient grid)
+		std::vector<img::Edgel> const gotEdgels
+			{ ops::grid::linkedEdgelsFrom(srcGrid) };
+
+		// [DoxyExample07]
+
+		// same as two pass evaluation
+		std::vector<img::Edgel> const expEdgels
+			{ ops::grid::linkedEdgelsFrom
+				(ops::grid::gradientGridBy8x(srcGrid))
+			};
+
+		bool same{ (expEdgels.size() == gotEdgels.size()) };
+		for (std::size_t nn{0u} ; same && (nn < expEdgels.size()) ; ++nn)
+		{
+			img::Edgel const & expEdgel = expEdgels[nn];
+			img::Edgel const & gotEdgel = gotEdgels[nn];
+			same = ( nearlyEquals(expEdgel.location(), gotEdgel.location())
+				&& nearlyEquals(expEdgel.gradient(), gotEdgel.gradient())
+				);
+		}
+		if (! (same && (! expEdgels.empty())))
+		{
+			oss << "Failure of streaming linkedEdgelsFrom test\n";
+			oss << "exp.size(): " << expEdgels.size() << '\n';
+			oss << "got.size(): " << gotEdgels.size() << '\n';
+		}
+
+		// too small for any gradients
+		ras::Grid<float> tinyGrid(2u, 9u);
+		std::fill(tinyGrid.begin(), tinyGrid.end(), 1.f);
+		if (! ops::grid::linkedEdgelsFrom(tinyGrid).empty())
+		{
+			oss << "Failure of streaming linkedEdgelsFrom tiny test\n";
+		}
+	}
+
+	//! Check separable and recursive smoothing methods
+	void
+	test8
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using engabra::g3::isValid;
+
+		// smoothly varying source
+		ras::Grid<float> srcGrid(64u, 72u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				double const arg{ .21 * (double)row - .13 * (double)col };
+				srcGrid(row, col) = (float)(5. + 4. * std::sin(arg));
+			}
+		}
+
+		// [DoxyExample08]
+
+		constexpr std::size_t halfSize{ 9u };
+		constexpr double sigma{ 18. }; // std deviation sqrt(sigma/2) == 3
+		using ops::grid::SmoothMethod;
+
+		// full 2D kernel - O(halfSize^2) per cell
+		ras::Grid<float> const directGrid
+			{ ops::grid::smoothGridFor<float>
+				(srcGrid, halfSize, sigma, SmoothMethod::Direct)
+			};
+		// same kernel as row/col passes - O(halfSize) per cell
+		ras::Grid<float> const sepGrid
+			{ ops::grid::smoothGridFor<float>
+				(srcGrid, halfSize, sigma, SmoothMethod::Separable)
+			};
+		// recursive approximation - O(1) per cell
+		ras::Grid<float> const iirGrid
+			{ ops::grid::smoothGridFor<float>
+				(srcGrid, halfSize, sigma, SmoothMethod::Recursive)
+			};
+
+		// [DoxyExample08]
+
+		// compare values in interior (away from differing edge effects)
+		double maxDifSep{ 0. };
+		double maxDifIir{ 0. };
+		std::size_t numNull{ 0u };
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				float const & expVal = directGrid(row, col);
+				float const & sepVal = sepGrid(row, col);
+				if (! (isValid(expVal) == isValid(sepVal)))
+				{
+					++numNull;
+				}
+				bool const inside
+					{ (2u*halfSize <= row) && (row < (64u - 2u*halfSize))
+					&& (2u*halfSize <= col) && (col < (72u - 2u*halfSize))
+					};
+				if (inside)
+				{
+					float const & iirVal = iirGrid(row, col);
+					maxDifSep = std::max
+						(maxDifSep, std::abs((double)(sepVal - expVal)));
+					maxDifIir = std::max
+						(maxDifIir, std::abs((double)(iirVal - expVal)));
+				}
+			}
+		}
+		if (! ((0u == numNull) && (maxDifSep < 1.e-5) && (maxDifIir < .05)))
+		{
+			oss << "Failure of smoothing method comparison test\n";
+			oss << "numNull: " << numNull << '\n';
+			oss << "maxDifSep: " << maxDifSep << '\n';
+			oss << "maxDifIir: " << maxDifIir << '\n';
+		}
+
+		// null-aware normalization: constant source with some nulls
+		ras::Grid<float> constGrid(srcGrid.hwSize());
+		std::fill(constGrid.begin(), constGrid.end(), 7.f);
+		constexpr float nan{ std::numeric_limits<float>::quiet_NaN() };
+		constGrid(30u, 30u) = nan;
+		constGrid(31u, 33u) = nan;
+		for (SmoothMethod const method
+			: { SmoothMethod::Separable, SmoothMethod::Recursive })
+		{
+			ras::Grid<float> const smGrid
+				{ ops::grid::smoothGridFor<float>
+					(constGrid, halfSize, sigma, method)
+				};
+			bool okay
+				{ (! isValid(smGrid(30u, 30u)))
+				&& (! isValid(smGrid(0u, 0u)))
+				};
+			for (std::size_t row{halfSize} ; okay && (row < 64u - halfSize)
+				; ++row)
+			{
+				for (std::size_t col{halfSize} ; okay && (col < 72u - halfSize)
+					; ++col)
+				{
+					float const & gotVal = smGrid(row, col);
+					if (isValid(constGrid(row, col)))
+					{
+						okay = (std::abs(gotVal - 7.f) < 1.e-4f);
+					}
+				}
+			}
+			if (! okay)
+			{
+				oss << "Failure of null-aware smoothing test\n";
+				oss << "method: " << (int)method << '\n';
+			}
+		}
+	}
+
+	//! Check box filters (computed via integral image)
+	void
+	test9
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using engabra::g3::isValid;
+
+		ras::Grid<float> srcGrid(19u, 23u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((row * col + 3u * row) % 11u);
+			}
+		}
+		// flat area
+		ras::grid::setSubGridValues
+			( &srcGrid
+			, ras::ChipSpec{ ras::RowCol{ 10u, 2u }, ras::SizeHW{ 7u, 7u } }
+			, 4.f
+			);
+		srcGrid(3u, 15u) = std::numeric_limits<float>::quiet_NaN();
+
+		// [DoxyExample09]
+
+		// O(1) per cell regardless of window size
+		ras::SizeHW const hwBox{ 5u, 5u };
+		ras::Grid<float> const ssdGrid
+			{ ops::grid::sumSquareDiffGridFor<float>(srcGrid, hwBox) };
+		ras::Grid<float> const varGrid
+			{ ops::grid::localVarianceGridFor<float>(srcGrid, hwBox) };
+
+		// [DoxyExample09]
+
+		// compare with brute force evaluation
+		ops::filter::SumSquareDiff<float> bFunc{};
+		ras::Grid<float> const expSsdGrid
+			{ ops::grid::functionResponse<float, float>
+				(srcGrid, hwBox, bFunc)
+			};
+		bool same{ (expSsdGrid.hwSize() == ssdGrid.hwSize()) };
+		for (std::size_t row{0u} ; same && (row < srcGrid.high()) ; ++row)
+		{
+			for (std::size_t col{0u} ; same && (col < srcGrid.wide()) ; ++col)
+			{
+				float const & expSsd = expSsdGrid(row, col);
+				float const & gotSsd = ssdGrid(row, col);
+				same = (isValid(expSsd) == isValid(gotSsd));
+				if (same && isValid(expSsd))
+				{
+					same = (std::abs(gotSsd - expSsd) < 1.e-3f);
+				}
+			}
+		}
+		if (! same)
+		{
+			oss << "Failure of integral image sumSquareDiff test\n";
+		}
+
+		// zero variance in center of flat area
+		// valid (null-aware) variance adjacent to null
+		if (! (  (0.f == varGrid(13u, 5u))
+			  && (0.f < varGrid(3u, 14u))
+			  && (! isValid(varGrid(3u, 15u)))
+			  && (! isValid(varGrid(0u, 0u)))
+			  ))
+		{
+			oss << "Failure of localVarianceGridFor test\n";
+		}
+	}
+
+	//! Check parallel execution gives results identical to serial
+	void
+	test10
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		ras::Grid<float> srcGrid(101u, 87u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((row * col + 7u * col) % 13u);
+			}
+		}
+		srcGrid(40u, 50u) = std::numeric_limits<float>::quiet_NaN();
+
+		// [DoxyExample10]
+
+		// grid-wide operations run in row bands on sys::ThreadPool::shared()
+		using sys::Exec;
+		using ops::grid::SmoothMethod;
+		std::size_t const halfSize{ 3u };
+		double const sigma{ 4. };
+		ras::Grid<float> const smGrid
+			{ ops::grid::smoothGridFor<float>
+				(srcGrid, halfSize, sigma, SmoothMethod::Direct, Exec::Parallel)
+			};
+
+		// [DoxyExample10]
+
+		// each band has its own working data: results identical to serial
+		bool const okDirect{ sameGrids
+			( smGrid
+			, ops::grid::smoothGridFor<float>(srcGrid, halfSize, sigma)
+			) };
+		bool okSmooth{ true };
+		for (SmoothMethod const method
+			: { SmoothMethod::Separable, SmoothMethod::Recursive })
+		{
+			okSmooth = okSmooth && sameGrids
+				( ops::grid::smoothGridFor<float>
+					(srcGrid, halfSize, sigma, method, Exec::Serial)
+				, ops::grid::smoothGridFor<float>
+					(srcGrid, halfSize, sigma, method, Exec::Parallel)
+				);
+		}
+		ras::SizeHW const hwBox{ 5u, 7u };
+		bool const okBox{ sameGrids
+			( ops::grid::sumSquareDiffGridFor<float>
+				(srcGrid, hwBox, Exec::Serial)
+			, ops::grid::sumSquareDiffGridFor<float>
+				(srcGrid, hwBox, Exec::Parallel)
+			) };
+		bool const okGrad{ sameGrids
+			( ops::grid::gradientGridBy8x(srcGrid, Exec::Serial)
+			, ops::grid::gradientGridBy8x(srcGrid, Exec::Parallel)
+			) && sameGrids
+			( ops::grid::gradientGridBy4x(srcGrid, 2u, Exec::Serial)
+			, ops::grid::gradientGridBy4x(srcGrid, 2u, Exec::Parallel)
+			) };
+
+		if (! (okDirect && okSmooth && okBox && okGrad))
+		{
+			oss << "Failure of parallel/serial consistency test\n";
+			oss << "okDirect: " << okDirect << '\n';
+			oss << "okSmooth: " << okSmooth << '\n';
+			oss << "   okBox: " << okBox << '\n';
+			oss << "  okGrad: " << okGrad << '\n';
+		}
+	}
+
+	//! Check compile-time (fixed size) window evaluation
+	void
+	test11
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		ras::Grid<float> srcGrid(31u, 37u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((3u * row + col * col) % 17u);
+			}
+		}
+		srcGrid(12u, 20u) = std::numeric_limits<float>::quiet_NaN();
+		ras::Grid<float> const filter{ ras::kernel::gauss<float>(3u, 5.) };
+
+		// [DoxyExample11]
+
+		// window size known at compile time: loops fully unrolled
+		// (3x3 and 5x5 windows are unrolled with the runtime hwBox too)
+		ops::filter::WeightedSum<float, float> bFunc{ &filter };
+		ras::Grid<float> const fixGrid
+			{ ops::grid::functionResponse<float, float, 7u, 7u>
+				(srcGrid, bFunc)
+			};
+
+		// [DoxyExample11]
+
+		ras::Grid<float> const runGrid
+			{ ops::grid::functionResponse<float, float>
+				(srcGrid, filter.hwSize(), bFunc)
+			};
+		ops::filter::SumSquareDiff<float> ssdFunc{};
+		bool const okSsd{ sameGrids
+			( ops::grid::functionResponse<float, float, 3u, 5u>
+				(srcGrid, ssdFunc)
+			, ops::grid::functionResponse<float, float>
+				(srcGrid, ras::SizeHW{ 3u, 5u }, ssdFunc)
+			) };
+		// one null distance shared by several filters of same source
+		ras::NullDistance const nullDist(srcGrid);
+		ras::Grid<float> const shareGrid
+			{ ops::grid::functionResponse<float, float>
+				( ras::GridView<float>(srcGrid), filter.hwSize(), nullDist
+				, bFunc
+				)
+			};
+		bool const okShare
+			{  sameGrids(shareGrid, runGrid)
+			&& sameGrids
+				( ops::grid::filtered(srcGrid, nullDist, filter)
+				, ops::grid::filtered(srcGrid, filter)
+				)
+			&& sameGrids
+				( ops::grid::smoothGridFor<float>(srcGrid, nullDist, 2u, 3.)
+				, ops::grid::smoothGridFor<float>(srcGrid, 2u, 3.)
+				)
+			};
+		if (! (sameGrids(runGrid, fixGrid) && okSsd && okShare))
+		{
+			oss << "Failure of fixed size functionResponse test\n";
+			oss << "okSsd: " << okSsd << '\n';
+			oss << "okShare: " << okShare << '\n';
+		}
+	}
+
+	//! Check filters using a padded (apron) source grid
+	void
+	test12
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using engabra::g3::isValid;
+
+		ras::Grid<float> srcGrid(23u, 19u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((row * row + 2u * col) % 7u);
+			}
+		}
+
+		// [DoxyExample12]
+
+		// apron replicates edge values: results valid up to the edges
+		ras::PaddedGrid<float> const padGrid
+			(srcGrid, 2u, ras::PadMode::Replicate);
+		ras::Grid<img::Grad> const padGrads
+			{ ops::grid::gradientGridBy8x(padGrid) };
+		ops::filter::SumSquareDiff<float> ssdFunc{};
+		ras::Grid<float> const padSsds
+			{ ops::grid::functionResponse<float, float>
+				(padGrid, ras::SizeHW{ 5u, 5u }, ssdFunc)
+			};
+
+		// [DoxyExample12]
+
+		// same as unpadded evaluation within the interior
+		ras::Grid<img::Grad> const expGrads
+			{ ops::grid::gradientGridBy8x(srcGrid) };
+		ras::Grid<float> const expSsds
+			{ ops::grid::functionResponse<float, float>
+				(srcGrid, ras::SizeHW{ 5u, 5u }, ssdFunc)
+			};
+		std::size_t numDiff{ 0u };
+		std::size_t numNull{ 0u };
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				img::Grad const & expGrad = expGrads(row, col);
+				img::Grad const & gotGrad = padGrads(row, col);
+				float const & expSsd = expSsds(row, col);
+				float const & gotSsd = padSsds(row, col);
+				if (! (gotGrad.isValid() && isValid(gotSsd)))
+				{
+					++numNull;
+				}
+				if (expGrad.isValid() && (! sameValue(expGrad, gotGrad)))
+				{
+					++numDiff;
+				}
+				if (isValid(expSsd) && (! sameValue(expSsd, gotSsd)))
+				{
+					++numDiff;
+				}
+			}
+		}
+		if (! ( (srcGrid.hwSize() == padGrads.hwSize())
+			 && (srcGrid.hwSize() == padSsds.hwSize())
+			 && (0u == numNull)
+			 && (0u == numDiff)
+			  ))
+		{
+			oss << "Failure of padded grid filter test\n";
+			oss << "numNull: " << numNull << '\n';
+			oss << "numDiff: " << numDiff << '\n';
+		}
+
+		// apron too thin for window
+		ras::Grid<float> const thinSsds
+			{ ops::grid::functionResponse<float, float>
+				(padGrid, ras::SizeHW{ 7u, 7u }, ssdFunc)
+			};
+		if (thinSsds.isValid())
+		{
+			oss << "Failure of thin apron null return test\n";
+		}
+	}
+
 }
 
 //! Standard test case main wrapper
@@ -503,6 +1031,12 @@ main
 	test4(oss);
 	test5(oss);
 	test6(oss);
+	test7(oss);
+	test8(oss);
+	test9(oss);
+	test10(oss);
+	test11(oss);
+	test12(oss);
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
 	{
@@ -31,6 +31,8 @@
 #include "QuadLoco/rasGrid.hpp"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <numeric>
@@ -243,6 +245,138 @@ namespace
 		// [DoxyExample02]
 
 	}
+	//! Check aligned (row padded) storage layout
+	void
+	test3
+		( std::ostream & oss
+		)
+	{
+		// [DoxyExample03]
+
+		using namespace quadloco;
+
+		// Dense grid for reference
+		ras::SizeHW const hwSize{ 5u, 7u };
+		ras::Grid<float> dense(hwSize);
+		std::iota(dense.begin(), dense.end(), 0.f);
+
+		// Grid with each row starting on a 32-byte boundary
+		constexpr std::size_t alignBytes{ 32u };
+		ras::Grid<float> aligned(hwSize, ras::GridLayout::aligned(alignBytes));
+		for (std::size_t row{0u} ; row < aligned.high() ; ++row)
+		{
+			std::copy
+				( dense.cbeginRow(row), dense.cendRow(row)
+				, aligned.beginRow(row)
+				);
+		}
+
+		// Each row padded to multiple of 8 floats (32 bytes)
+		std::size_t const expPitch{ 8u };
+		std::size_t const gotPitch{ aligned.rowPitch() };
+
+		// Copy retains the layout
+		ras::Grid<float> const copy{ ras::Grid<float>::copyOf(aligned) };
+
+		// [DoxyExample03]
+
+		if (! (expPitch == gotPitch))
+		{
+			oss << "Failure of aligned rowPitch test\n";
+			oss << "exp: " << expPitch << '\n';
+			oss << "got: " << gotPitch << '\n';
+		}
+
+		if (! dense.isContiguous())
+		{
+			oss << "Failure of dense isContiguous test\n";
+		}
+		if (  aligned.isContiguous()
+		   || (! (aligned.hwSize() == hwSize))
+		   || (! (aligned.storageSize() == (hwSize.high() * expPitch)))
+		   )
+		{
+			oss << "Failure of aligned geometry test\n";
+			oss << "aligned: " << aligned << '\n';
+		}
+
+		// every row must start on an alignment boundary
+		for (std::size_t row{0u} ; row < aligned.high() ; ++row)
+		{
+			std::uintptr_t const addr
+				{ reinterpret_cast<std::uintptr_t>(aligned.cbeginRow(row)) };
+			if (! (0u == (addr % alignBytes)))
+			{
+				oss << "Failure of row alignment test: row = " << row << '\n';
+				break;
+			}
+		}
+
+		// element access and comparison are independent of layout
+		if (! (aligned(3u, 4u) == dense(3u, 4u)))
+		{
+			oss << "Failure of aligned element access test\n";
+		}
+		if (! nearlyEquals(aligned, dense))
+		{
+			oss << "Failure of aligned/dense nearlyEquals test\n";
+			oss << dense.infoStringContents("dense", "%5.1f") << '\n';
+			oss << aligned.infoStringContents("aligned", "%5.1f") << '\n';
+		}
+		if (! ((copy.rowPitch() == gotPitch) && nearlyEquals(copy, dense)))
+		{
+			oss << "Failure of aligned copyOf test\n";
+		}
+
+		// pad cells (after each row) are value initialized
+		float padSum{ 0.f };
+		for (std::size_t row{0u} ; row < aligned.high() ; ++row)
+		{
+			padSum = std::accumulate
+				( aligned.cendRow(row), aligned.cbeginRow(row) + gotPitch
+				, padSum
+				);
+		}
+		if (! (0.f == padSum))
+		{
+			oss << "Failure of pad cell initialization test\n";
+			oss << "padSum: " << padSum << '\n';
+		}
+
+		// iterator position maps back to row/col
+		ras::RowCol const expRC{ 2u, 6u };
+		ras::RowCol const gotRC
+			{ aligned.rasRowColFor(aligned.citerAt(expRC.row(), expRC.col())) };
+		if (! (gotRC == expRC))
+		{
+			oss << "Failure of aligned rasRowColFor test\n";
+			oss << "exp: " << expRC << '\n';
+			oss << "got: " << gotRC << '\n';
+		}
+
+		// element size that does not divide alignment (e.g. img::Grad)
+		using Elem24 = std::array<double, 3u>;
+		ras::Grid<Elem24> const grid24(hwSize, ras::GridLayout::aligned(64u));
+		bool rowsOkay24{ (8u == grid24.rowPitch()) };
+		for (std::size_t row{0u} ; rowsOkay24 && (row < grid24.high()) ; ++row)
+		{
+			std::uintptr_t const addr
+				{ reinterpret_cast<std::uintptr_t>(grid24.cbeginRow(row)) };
+			rowsOkay24 = (0u == (addr % 64u));
+		}
+		if (! rowsOkay24)
+		{
+			oss << "Failure of 24-byte element row alignment test\n";
+			oss << "rowPitch: " << grid24.rowPitch() << '\n';
+		}
+
+		// explicit minimum pitch (without alignment)
+		ras::Grid<std::uint8_t> const wider(hwSize, ras::GridLayout{ 0u, 10u });
+		if (! (10u == wider.rowPitch()))
+		{
+			oss << "Failure of minimum row pitch test\n";
+		}
+	}
 }
 
 //! Check behavior of NS
@@ -256,6 +390,7 @@ main
 	test0(oss);
 	test1(oss);
 	test2(oss);
+	test3(oss);
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
 	{
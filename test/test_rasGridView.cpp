@@ -0,0 +1,236 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::ras::GridView
+*/
+
+
+#include "QuadLoco/opsgrid.hpp"
+#include "QuadLoco/opsSymRing.hpp"
+#include "QuadLoco/rasChipSpec.hpp"
+#include "QuadLoco/rasgrid.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/rasGridView.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+
+
+namespace
+{
+	//! True if subGridViewFrom() accepts a (temporary) GridType argument
+	template <typename GridType>
+	constexpr bool theViewsFromTemps
+		{ requires
+			{ quadloco::ras::grid::subGridViewFrom
+				(std::declval<GridType>(), quadloco::ras::ChipSpec{});
+			}
+		};
+
+	//! Examples for documentation
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		// [DoxyExample01]
+
+		using namespace quadloco;
+
+		// a source grid with distinct values in each cell
+		ras::Grid<float> fullGrid(7u, 9u);
+		std::iota(fullGrid.begin(), fullGrid.end(), 0.f);
+
+		// view into a sub area of the full grid (no data are copied)
+		ras::ChipSpec const chipSpec
+			{ ras::RowCol{ 2u, 3u }
+			, ras::SizeHW{ 4u, 5u }
+			};
+		ras::GridView<float> const chipView
+			{ ras::grid::subGridViewFrom(fullGrid, chipSpec) };
+
+		// view cells are the same as the full grid cells
+		float const & gotValue = chipView(1u, 2u);
+		float const & expValue = fullGrid(2u+1u, 3u+2u);
+
+		// a (deep) copy can be made if contiguous storage is needed
+		ras::Grid<float> const chipCopy
+			{ ras::grid::gridCopyOf<float>(chipView) };
+
+		// [DoxyExample01]
+
+		// views are not made from temporary grids (data would dangle)
+		static_assert
+			(! std::is_constructible_v
+				<ras::GridView<float>, ras::Grid<float> &&>
+			);
+		static_assert(theViewsFromTemps<ras::Grid<float> const &>);
+		static_assert(! theViewsFromTemps<ras::Grid<float> &&>);
+
+		if (! chipView.isValid())
+		{
+			oss << "Failure of chipView.isValid() test\n";
+		}
+		if (! (chipView.hwSize() == chipSpec.hwSize()))
+		{
+			oss << "Failure of chipView.hwSize() test\n";
+			oss << "exp: " << chipSpec.hwSize() << '\n';
+			oss << "got: " << chipView.hwSize() << '\n';
+		}
+		if (chipView.isContiguous())
+		{
+			oss << "Failure of chipView.isContiguous() test\n";
+		}
+		if (! (&gotValue == &expValue))
+		{
+			oss << "Failure of view cell address test\n";
+		}
+
+		ras::Grid<float> const expCopy
+			{ ras::grid::subGridValuesFrom<float>(fullGrid, chipSpec) };
+		if (! nearlyEquals(chipCopy, expCopy))
+		{
+			oss << "Failure of gridCopyOf() test\n";
+			oss << expCopy.infoStringContents("expCopy", "%5.1f") << '\n';
+			oss << chipCopy.infoStringContents("chipCopy", "%5.1f") << '\n';
+		}
+
+		// chip that does not fit produces a null view
+		ras::ChipSpec const badSpec
+			{ ras::RowCol{ 5u, 5u }
+			, ras::SizeHW{ 4u, 5u }
+			};
+		ras::GridView<float> const badView
+			{ ras::grid::subGridViewFrom(fullGrid, badSpec) };
+		if (badView.isValid())
+		{
+			oss << "Failure of null badView test\n";
+		}
+	}
+
+	//! Check processing of view is same as processing of copied chip
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// checkerboard like pattern (quad target) with a bit of ramp
+		ras::Grid<float> fullGrid(40u, 50u);
+		for (std::size_t row{0u} ; row < fullGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < fullGrid.wide() ; ++col)
+			{
+				bool const isTop{ row < 21u };
+				bool const isLft{ col < 26u };
+				float const value{ (isTop == isLft) ? 10.f : 100.f };
+				fullGrid(row, col) = value + (float)(row + col)/16.f;
+			}
+		}
+
+		ras::ChipSpec const chipSpec
+			{ ras::RowCol{ 7u, 11u }
+			, ras::SizeHW{ 27u, 29u }
+			};
+		ras::GridView<float> const chipView
+			{ ras::grid::subGridViewFrom(fullGrid, chipSpec) };
+		ras::Grid<float> const chipCopy
+			{ ras::grid::subGridValuesFrom<float>(fullGrid, chipSpec) };
+
+		// symmetry filter response
+		constexpr std::size_t halfSize{ 3u };
+		ras::Grid<float> const expSym
+			{ ops::symRingGridFor(chipCopy, halfSize) };
+		ras::Grid<float> const gotSym
+			{ ops::symRingGridFor(chipView, halfSize) };
+		// (compare with NaN border cells replaced)
+		auto const fixNull
+			{ [] (ras::Grid<float> const & grid)
+				{
+					ras::Grid<float> fix{ ras::Grid<float>::copyOf(grid) };
+					std::replace_if
+						( fix.begin(), fix.end()
+						, [] (float const & val) { return std::isnan(val); }
+						, -1.f
+						);
+					return fix;
+				}
+			};
+		if (! nearlyEquals(fixNull(gotSym), fixNull(expSym)))
+		{
+			oss << "Failure of symRingGridFor(view) test\n";
+		}
+
+		// box filter response
+		ras::Grid<float> const box{ ras::kernel::gauss<float>(1u, 1.) };
+		ops::filter::WeightedSum<float, float> expFunc{ &box };
+		ops::filter::WeightedSum<float, float> gotFunc{ &box };
+		ras::Grid<float> const expBox
+			{ ops::grid::functionResponse<float, float>
+				(chipCopy, box.hwSize(), expFunc)
+			};
+		ras::Grid<float> const gotBox
+			{ ops::grid::functionResponse<float, float>
+				(chipView, box.hwSize(), gotFunc)
+			};
+		if (! nearlyEquals(fixNull(gotBox), fixNull(expBox)))
+		{
+			oss << "Failure of functionResponse(view) test\n";
+		}
+	}
+
+}
+
+//! Standard test case main wrapper
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+//	test0(oss);
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
+
@@ -0,0 +1,153 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::ras::NullDistance
+*/
+
+
+#include "QuadLoco/rasNullDistance.hpp"
+
+#include "QuadLoco/rasGrid.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+
+namespace
+{
+	//! Check distances against brute force evaluation
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		constexpr float nan{ std::numeric_limits<float>::quiet_NaN() };
+		ras::Grid<float> srcGrid(13u, 17u);
+		std::fill(srcGrid.begin(), srcGrid.end(), 1.f);
+		srcGrid(3u, 4u) = nan;
+		srcGrid(9u, 14u) = nan;
+		srcGrid(12u, 0u) = nan;
+
+		// [DoxyExample01]
+
+		// computed once for source grid
+		ras::NullDistance const nullDist(srcGrid);
+
+		// window (halfSize of 2) centered at (6,6) contains no nulls
+		bool const okayA{ nullDist.isWindowValid(6u, 6u, 2u, 2u) };
+		// window (halfSize of 3) centered at (6,6) includes null at (3,4)
+		bool const okayB{ nullDist.isWindowValid(6u, 6u, 3u, 3u) };
+
+		// [DoxyExample01]
+
+		if (! (okayA && (! okayB) && (3u == nullDist.numNulls())))
+		{
+			oss << "Failure of isWindowValid example test\n";
+			oss << "okayA: " << okayA << '\n';
+			oss << "okayB: " << okayB << '\n';
+			oss << "nullDist: " << nullDist << '\n';
+		}
+
+		// brute force (chessboard) distance to nearest null
+		std::size_t numBad{ 0u };
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				std::size_t expDist{ ras::NullDistance::maxDistance() };
+				for (std::size_t nr{0u} ; nr < srcGrid.high() ; ++nr)
+				{
+					for (std::size_t nc{0u} ; nc < srcGrid.wide() ; ++nc)
+					{
+						if (! engabra::g3::isValid(srcGrid(nr, nc)))
+						{
+							std::size_t const dRow
+								{ (std::size_t)std::abs((int)nr - (int)row) };
+							std::size_t const dCol
+								{ (std::size_t)std::abs((int)nc - (int)col) };
+							expDist = std::min(expDist, std::max(dRow, dCol));
+						}
+					}
+				}
+				if (! (expDist == nullDist.distanceAt(row, col)))
+				{
+					++numBad;
+				}
+			}
+		}
+		if (0u < numBad)
+		{
+			oss << "Failure of distanceAt test: numBad = " << numBad << '\n';
+		}
+
+		// windows extending outside of source are not valid
+		if (nullDist.isWindowValid(1u, 8u, 2u, 2u))
+		{
+			oss << "Failure of outside window test\n";
+		}
+
+		// source without nulls
+		ras::Grid<float> okayGrid(5u, 6u);
+		std::fill(okayGrid.begin(), okayGrid.end(), 0.f);
+		ras::NullDistance const okayDist(okayGrid);
+		std::size_t const gotMax{ okayDist.distanceAt(0u, 0u) };
+		if (! ( okayDist.isWindowValid(2u, 2u, 2u, 2u)
+			 && (! nullDist.isValidAt(3u, 4u))
+			 && (ras::NullDistance::maxDistance() == gotMax)
+			 ))
+		{
+			oss << "Failure of no-null source test\n";
+		}
+	}
+
+}
+
+//! Check behavior of ras::NullDistance
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,205 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::ras::PaddedGrid
+*/
+
+
+#include "QuadLoco/rasPaddedGrid.hpp"
+
+#include "QuadLoco/rasGrid.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+#include <vector>
+
+
+namespace
+{
+	//! True if views can be requested from a PadType instance
+	template <typename PadType>
+	constexpr bool theViewsFrom
+		{ requires (PadType && padGrid)
+			{ static_cast<PadType &&>(padGrid).view();
+			  static_cast<PadType &&>(padGrid).viewWithMargin(0u);
+			}
+		};
+
+	//! Examples for documentation
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// source with values 10*row + col
+		ras::Grid<float> srcGrid(3u, 4u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)(10u * row + col);
+			}
+		}
+
+		// [DoxyExample01]
+
+		// two cell apron all around (e.g. for up to 5x5 windows)
+		ras::PaddedGrid<float> const repGrid
+			(srcGrid, 2u, ras::PadMode::Replicate);
+		ras::PaddedGrid<float> const mirGrid
+			(srcGrid, 2u, ras::PadMode::Mirror);
+		ras::PaddedGrid<float> const nulGrid
+			(srcGrid, 2u, ras::PadMode::Null);
+
+		// interior is same as source
+		float const gotIn{ repGrid(1u, 2u) }; // == srcGrid(1,2) == 12
+
+		// apron values are accessible relative to interior
+		float const gotRep{ repGrid.valueAt(-2, 5) }; // srcGrid(0,3) == 3
+		float const gotMir{ mirGrid.valueAt(-2, 5) }; // srcGrid(2,1) == 21
+		float const gotNul{ nulGrid.valueAt(-2, 5) }; // null
+
+		// interior view - reads up to padSize() outside are valid
+		ras::GridView<float> const view{ repGrid.view() };
+
+		// [DoxyExample01]
+
+		// no views of temporaries (data would not outlive the view)
+		static_assert(theViewsFrom<ras::PaddedGrid<float> const &>);
+		static_assert(! theViewsFrom<ras::PaddedGrid<float> >);
+
+		if (! ( (12.f == gotIn)
+			 && (3.f == gotRep)
+			 && (21.f == gotMir)
+			 && (! pix::isValid(gotNul))
+			  ))
+		{
+			oss << "Failure of PaddedGrid example test\n";
+			oss << "gotIn: " << gotIn << '\n';
+			oss << "gotRep: " << gotRep << '\n';
+			oss << "gotMir: " << gotMir << '\n';
+			oss << "gotNul: " << gotNul << '\n';
+		}
+
+		if (! ( (srcGrid.hwSize() == view.hwSize())
+			 && (srcGrid(2u, 3u) == view(2u, 3u))
+			 && (srcGrid.hwSize() == repGrid.hwSize())
+			 && (ras::SizeHW{ 7u, 8u } == repGrid.fullGrid().hwSize())
+			  ))
+		{
+			oss << "Failure of PaddedGrid view/size test\n";
+			oss << "repGrid: " << repGrid << '\n';
+			oss << "   view: " << view << '\n';
+		}
+	}
+
+	//! Check apron index mapping
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using ras::PadMode;
+		using PG = ras::PaddedGrid<float>;
+
+		// 4 cells: mirror is ... 3 2 1 [0 1 2 3] 2 1 0 ...
+		std::vector<std::size_t> expMirs{ 3u, 2u, 1u, 0u, 1u, 2u, 3u, 2u };
+		std::vector<std::size_t> expReps{ 0u, 0u, 0u, 0u, 1u, 2u, 3u, 3u };
+		std::vector<std::size_t> gotMirs;
+		std::vector<std::size_t> gotReps;
+		for (std::ptrdiff_t ndx{-3} ; ndx < 5 ; ++ndx)
+		{
+			gotMirs.emplace_back(PG::sourceIndexFor(ndx, 4u, PadMode::Mirror));
+			gotReps.emplace_back
+				(PG::sourceIndexFor(ndx, 4u, PadMode::Replicate));
+		}
+		// apron larger than source wraps back and forth
+		std::size_t const gotFar{ PG::sourceIndexFor(9, 4u, PadMode::Mirror) };
+		std::size_t const gotOne{ PG::sourceIndexFor(-5, 1u, PadMode::Mirror) };
+		if (! ( (expMirs == gotMirs)
+			 && (expReps == gotReps)
+			 && (3u == gotFar)
+			 && (0u == gotOne)
+			  ))
+		{
+			oss << "Failure of sourceIndexFor test\n";
+			oss << "gotFar: " << gotFar << '\n';
+			oss << "gotOne: " << gotOne << '\n';
+		}
+
+		// bilinear interpolation at interior edge uses apron values
+		ras::Grid<float> srcGrid(4u, 4u);
+		std::fill(srcGrid.begin(), srcGrid.end(), 5.f);
+		ras::PaddedGrid<float> const padGrid(srcGrid, 1u);
+		float const gotEdge{ padGrid.bilinValueAt(img::Spot{ .25, 3.5 }) };
+		float const gotDirect
+			{ ras::grid::bilinValueAt<float>(srcGrid, img::Spot{ .25, 3.5 }) };
+		if (! ((5.f == gotEdge) && (! pix::isValid(gotDirect))))
+		{
+			oss << "Failure of PaddedGrid bilinValueAt test\n";
+			oss << "gotEdge: " << gotEdge << '\n';
+			oss << "gotDirect: " << gotDirect << '\n';
+		}
+
+		// null instance
+		ras::PaddedGrid<float> const aNull{};
+		if ( aNull.isValid()
+		  || aNull.view().isValid()
+		  || (! (0u == aNull.high()))
+		   )
+		{
+			oss << "Failure of null PaddedGrid test\n";
+		}
+	}
+
+}
+
+//! Standard test case main wrapper
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
@@ -0,0 +1,226 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::ras::Pyramid
+*/
+
+
+#include "QuadLoco/rasPyramid.hpp"
+
+#include "QuadLoco/pix.hpp"
+#include "QuadLoco/rasGrid.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+
+
+namespace
+{
+	//! True if a level view can be requested from a PyrType instance
+	template <typename PyrType>
+	constexpr bool theViewsFrom
+		{ requires (PyrType && pyramid)
+			{ static_cast<PyrType &&>(pyramid).view(0u); }
+		};
+
+	//! Examples for documentation
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// source with (linear ramp) values 10*row + col
+		ras::Grid<float> srcGrid(37u, 20u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)(10u * row + col);
+			}
+		}
+
+		// [DoxyExample01]
+
+		// request 5 levels but stop before any is less than 4 cells
+		ras::Pyramid const pyramid(srcGrid, 5u, 4u);
+		std::size_t const numLevels{ pyramid.numLevels() };
+
+		// level 0 is the source, each level is about half the previous
+		ras::SizeHW const hw0{ pyramid.hwSize(0u) }; // 37 x 20
+		ras::SizeHW const hw1{ pyramid.hwSize(1u) }; // 19 x 10
+		ras::SizeHW const hw2{ pyramid.hwSize(2u) }; // 10 x 5
+
+		// coarse cell (5,3) at level 1 is near source cell (10,6)
+		ras::GridView<float> const view1{ pyramid.view(1u) };
+		float const value1{ view1(5u, 3u) }; // 10*10 + 6
+
+		// level cells map back to source (level 0) locations
+		ras::RowCol const fullRC
+			{ ras::Pyramid::fullRowColFor(2u, ras::RowCol{ 1u, 2u }) };
+
+		// [DoxyExample01]
+
+		// no pyramids over (or views into) temporaries
+		static_assert
+			(! std::is_constructible_v
+				<ras::Pyramid, ras::Grid<float> &&, std::size_t>
+			);
+		static_assert(theViewsFrom<ras::Pyramid const &>);
+		static_assert(! theViewsFrom<ras::Pyramid>);
+
+		if (! (3u == numLevels))
+		{
+			oss << "Failure of numLevels test\n";
+			oss << "exp: " << 3u << '\n';
+			oss << "got: " << numLevels << '\n';
+			oss << pyramid << '\n';
+		}
+
+		if (! ( (hw0 == srcGrid.hwSize())
+			 && (hw1 == ras::SizeHW{ 19u, 10u })
+			 && (hw2 == ras::SizeHW{ 10u, 5u })
+			 && (! pyramid.view(3u).isValid())
+			  ))
+		{
+			oss << "Failure of level size test\n";
+			oss << pyramid << '\n';
+		}
+
+		// linear ramp is preserved (away from edges)
+		float const expValue1{ 106.f };
+		if (! (expValue1 == value1))
+		{
+			oss << "Failure of decimated value test\n";
+			oss << "exp: " << expValue1 << '\n';
+			oss << "got: " << value1 << '\n';
+		}
+
+		ras::RowCol const expRC{ 4u, 8u };
+		if (! (expRC == fullRC))
+		{
+			oss << "Failure of fullRowColFor test\n";
+			oss << "exp: " << expRC << '\n';
+			oss << "got: " << fullRC << '\n';
+		}
+	}
+
+	//! Check null handling and degenerate cases
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// constant values with some nulls
+		constexpr float nan{ pix::null<float>() };
+		ras::Grid<float> srcGrid(8u, 9u);
+		std::fill(srcGrid.begin(), srcGrid.end(), 7.f);
+		srcGrid(2u, 3u) = nan;
+		// all nine values about (6,6) are null
+		for (std::size_t row{5u} ; row < 8u ; ++row)
+		{
+			for (std::size_t col{5u} ; col < 8u ; ++col)
+			{
+				srcGrid(row, col) = nan;
+			}
+		}
+
+		ras::Grid<float> const decGrid
+			{ ras::Pyramid::decimatedGridFor(ras::GridView<float>(srcGrid)) };
+		if (! (ras::SizeHW{ 4u, 5u } == decGrid.hwSize()))
+		{
+			oss << "Failure of decimated size test\n";
+			oss << "got: " << decGrid.hwSize() << '\n';
+		}
+		else
+		{
+			std::size_t numBad{ 0u };
+			for (std::size_t row{0u} ; row < decGrid.high() ; ++row)
+			{
+				for (std::size_t col{0u} ; col < decGrid.wide() ; ++col)
+				{
+					float const & got = decGrid(row, col);
+					bool const expNull{ (3u == row) && (3u == col) };
+					if (expNull)
+					{
+						numBad += pix::isValid(got) ? 1u : 0u;
+					}
+					else
+					{
+						numBad += (7.f == got) ? 0u : 1u;
+					}
+				}
+			}
+			if (! (0u == numBad))
+			{
+				oss << "Failure of decimated null value test\n";
+				oss << "numBad: " << numBad << '\n';
+			}
+		}
+
+		// null and single level instances
+		ras::Pyramid const nullPyramid{};
+		ras::Pyramid const onePyramid(srcGrid, 1u);
+		if (! ( (! isValid(nullPyramid))
+			 && (0u == nullPyramid.numLevels())
+			 && (1u == onePyramid.numLevels())
+			 && (onePyramid.view(0u).isValid())
+			  ))
+		{
+			oss << "Failure of degenerate pyramid test\n";
+		}
+	}
+
+}
+
+//! Check behavior of ras::Pyramid
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
+
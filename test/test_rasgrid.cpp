@@ -388,6 +388,225 @@ namespace
 		}
 
 	}
+
+	//! check 16-bit (uint16_t) processing functions
+	void
+	test4
+		( std::ostream & oss
+		)
+	{
+		// [DoxyExample07]
+
+		using namespace quadloco;
+
+		// e.g. 12-bit data from a machine vision camera
+		ras::Grid<uint16_t> uGrid(3u, 3u);
+		std::fill(uGrid.begin(), uGrid.end(), 0u);
+		uGrid(1u, 1u) = 1000u;
+		uGrid(1u, 2u) = 4000u;
+		uGrid(2u, 1u) = 2000u;
+		uGrid(2u, 2u) = 4095u;
+
+		// conversion to real values retains full precision
+		ras::Grid<float> const fGrid{ ras::grid::realGridOf<float>(uGrid) };
+
+		// interpolation directly from 16-bit values
+		uint16_t const gotMid
+			{ ras::grid::bilinValueAt(uGrid, img::Spot{ 1.5, 1.5 }) };
+
+		// [DoxyExample07]
+
+		if (! ((1000.f == fGrid(1u, 1u)) && (4095.f == fGrid(2u, 2u))))
+		{
+			oss << "Failure of uint16_t realGridOf test\n";
+			oss << fGrid.infoStringContents("fGrid", "%7.1f") << '\n';
+		}
+
+		// midway between four cells is their average (within truncation)
+		uint16_t const expMid{ (1000u + 4000u + 2000u + 4095u) / 4u };
+		if (! (expMid == gotMid))
+		{
+			oss << "Failure of uint16_t bilinValueAt test\n";
+			oss << "exp: " << expMid << '\n';
+			oss << "got: " << gotMid << '\n';
+		}
+
+		// null values propagate
+		ras::Grid<float> const nGrid
+			{ ras::grid::realGridOf<float>(uGrid, 4095) };
+		if (pix::isValid(nGrid(2u, 2u)) || (! pix::isValid(nGrid(1u, 1u))))
+		{
+			oss << "Failure of uint16_t realGridOf treatAsNull test\n";
+		}
+	}
+	//! check conversion of chip region (without full frame conversion)
+	void
+	test5
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		ras::Grid<uint8_t> uGrid(20u, 37u);
+		for (std::size_t row{0u} ; row < uGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < uGrid.wide() ; ++col)
+			{
+				uGrid(row, col) = (uint8_t)((7u * row + 3u * col) % 251u);
+			}
+		}
+
+		// [DoxyExample08]
+
+		// region of interest within a larger frame
+		ras::ChipSpec const chipSpec
+			{ ras::RowCol{ 3u, 5u }, ras::SizeHW{ 11u, 29u } };
+
+		// convert only the chip cells (e.g. value 65 treated as null)
+		ras::Grid<float> const gotGrid
+			{ ras::grid::realGridOf<float>(uGrid, chipSpec, 65) };
+
+		// [DoxyExample08]
+
+		ras::Grid<float> const expGrid
+			{ ras::grid::realGridOf<float>
+				(ras::grid::subGridValuesFrom<uint8_t>(uGrid, chipSpec), 65)
+			};
+		bool same{ expGrid.hwSize() == gotGrid.hwSize() };
+		std::size_t numNull{ 0u };
+		for (std::size_t row{0u} ; same && (row < expGrid.high()) ; ++row)
+		{
+			for (std::size_t col{0u} ; same && (col < expGrid.wide()) ; ++col)
+			{
+				float const & expVal = expGrid(row, col);
+				float const & gotVal = gotGrid(row, col);
+				if (pix::isValid(expVal))
+				{
+					same = (expVal == gotVal);
+				}
+				else
+				{
+					same = (! pix::isValid(gotVal));
+					++numNull;
+				}
+			}
+		}
+		if (! (same && (0u < numNull)))
+		{
+			oss << "Failure of chip realGridOf test\n";
+			oss << "numNull: " << numNull << '\n';
+			oss << "expGrid: " << expGrid << '\n';
+			oss << "gotGrid: " << gotGrid << '\n';
+		}
+
+		// chip outside of source produces null result
+		ras::ChipSpec const badSpec
+			{ ras::RowCol{ 10u, 5u }, ras::SizeHW{ 11u, 29u } };
+		ras::Grid<float> const badGrid
+			{ ras::grid::realGridOf<float>(uGrid, badSpec) };
+		if (badGrid.isValid())
+		{
+			oss << "Failure of out of bounds chip realGridOf test\n";
+		}
+	}
+
+	//! check that padded (aligned) grids produce same results as dense
+	void
+	test6
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// non power-of-two alignment is rounded up
+		ras::GridLayout const layout{ ras::GridLayout::aligned(48u) };
+		if (! (64u == layout.alignBytes()))
+		{
+			oss << "Failure of GridLayout alignBytes rounding test\n";
+			oss << "exp: " << 64u << '\n';
+			oss << "got: " << layout.alignBytes() << '\n';
+		}
+
+		// same source values in dense and in padded layouts
+		ras::SizeHW const hwSize{ 20u, 21u };
+		ras::Grid<uint8_t> uDense(hwSize);
+		ras::Grid<uint8_t> uPadded(hwSize, layout);
+		for (std::size_t row{0u} ; row < hwSize.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < hwSize.wide() ; ++col)
+			{
+				uint8_t const value
+					{ (uint8_t)(50u + ((7u * row + 3u * col) % 151u)) };
+				uDense(row, col) = value;
+				uPadded(row, col) = value;
+			}
+		}
+		ras::Grid<float> fDense{ ras::grid::realGridOf<float>(uDense) };
+		ras::Grid<float> fPadded{ ras::grid::realGridOf<float>(uPadded) };
+
+		std::size_t const gotAddr
+			{ reinterpret_cast<std::size_t>(fPadded.cbeginRow(1u)) };
+		if ( fPadded.isContiguous()
+		  || (! (0u == (gotAddr % 64u)))
+		   )
+		{
+			oss << "Failure of padded realGridOf layout test\n";
+			oss << "rowPitch: " << fPadded.rowPitch() << '\n';
+		}
+
+		// cell by cell comparison
+		auto const sameCells
+			{ [] (auto const & gridA, auto const & gridB)
+				{
+					bool same{ gridA.hwSize() == gridB.hwSize() };
+					std::size_t const high{ gridA.high() };
+					for (std::size_t row{0u} ; same && (row < high) ; ++row)
+					{
+						same = std::equal
+							( gridA.cbeginRow(row), gridA.cendRow(row)
+							, gridB.cbeginRow(row)
+							);
+					}
+					return same;
+				}
+			};
+
+		// value span (excluding pad cells)
+		val::Span const expSpan{ ras::grid::fullSpanFor(fDense) };
+		val::Span const gotSpan{ ras::grid::fullSpanFor(fPadded) };
+		if (! ( (50. == expSpan.min())
+			 && (expSpan.min() == gotSpan.min())
+			 && (expSpan.max() == gotSpan.max())
+			  ))
+		{
+			oss << "Failure of padded fullSpanFor test\n";
+			oss << "exp: " << expSpan << '\n';
+			oss << "got: " << gotSpan << '\n';
+		}
+
+		// uint8 mapping
+		ras::Grid<uint8_t> const expU8{ ras::grid::uGrid8(fDense, expSpan) };
+		ras::Grid<uint8_t> const gotU8{ ras::grid::uGrid8(fPadded, gotSpan) };
+		if (! sameCells(expU8, gotU8))
+		{
+			oss << "Failure of padded uGrid8 test\n";
+		}
+
+		// spot drawing (uses grid min/max) and border filling
+		img::Spot const spot{ 7.5, 9.5 };
+		ras::grid::drawSpot(&fDense, spot);
+		ras::grid::drawSpot(&fPadded, spot);
+		ras::grid::fillBorder(&fDense, 2u, -1.f);
+		ras::grid::fillBorder(&fPadded, 2u, -1.f);
+		// pad cells remain untouched
+		float const gotPad{ *(fPadded.cendRow(3u)) };
+		if (! (sameCells(fDense, fPadded) && (0.f == gotPad)))
+		{
+			oss << "Failure of padded drawSpot/fillBorder test\n";
+			oss << "expGrid: " << fDense << '\n';
+			oss << "gotGrid: " << fPadded << '\n';
+		}
+	}
 }
 
 //! Standard test case main wrapper
@@ -402,6 +621,9 @@ main
 	test1(oss);
 	test2(oss);
 	test3(oss);
+	test4(oss);
+	test5(oss);
+	test6(oss);
 
 	if (oss.str().empty()) // Only pass if no errors were encountered
 	{
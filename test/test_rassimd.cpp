@@ -0,0 +1,483 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::ras::simd functions
+*/
+
+
+#include "QuadLoco/rassimd.hpp"
+
+#include "QuadLoco/imgGrad.hpp"
+#include "QuadLoco/opsgrid.hpp"
+#include "QuadLoco/rasGrid.hpp"
+#include "QuadLoco/syscpu.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	//! True if values are identical (including both NaN)
+	inline
+	bool
+	sameBits
+		( float const & valA
+		, float const & valB
+		)
+	{
+		return ((valA == valB) || (std::isnan(valA) && std::isnan(valB)));
+	}
+
+	//! Check conversion at all levels (and all tail lengths) for SrcType
+	template <typename SrcType>
+	inline
+	void
+	checkConvertRow
+		( std::ostream & oss
+		, std::string const & srcName
+		)
+	{
+		using namespace quadloco;
+		using sys::cpu::SimdLevel;
+
+		// values spanning full source range
+		constexpr std::size_t maxElem{ 67u };
+		std::vector<SrcType> srcs(maxElem);
+		for (std::size_t ndx{0u} ; ndx < maxElem ; ++ndx)
+		{
+			srcs[ndx] = static_cast<SrcType>
+				(std::numeric_limits<SrcType>::max() - 37u * ndx);
+		}
+
+		std::vector<SimdLevel> const levels
+			{ SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 };
+		for (SimdLevel const & level : levels)
+		{
+			// include lengths not multiple of vector sizes
+			for (std::size_t numElem{0u} ; numElem < maxElem ; ++numElem)
+			{
+				// sentinel after end to detect overwrite
+				std::vector<float> dsts(numElem + 1u, -1.f);
+				ras::simd::convertRow
+					(srcs.data(), numElem, dsts.data(), level);
+
+				bool okay{ -1.f == dsts[numElem] };
+				for (std::size_t ndx{0u} ; okay && (ndx < numElem) ; ++ndx)
+				{
+					okay = ((float)srcs[ndx] == dsts[ndx]);
+				}
+				if (! okay)
+				{
+					oss << "Failure of convertRow test\n";
+					oss << "srcType: " << srcName << '\n';
+					oss << "level: " << sys::cpu::nameFor(level) << '\n';
+					oss << "numElem: " << numElem << '\n';
+					return;
+				}
+			}
+		}
+	}
+
+	//! Check conversion kernels
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// [DoxyExample01]
+
+		// e.g. one row of 8-bit image data
+		std::vector<std::uint8_t> const srcRow{ 0u, 17u, 255u, 128u, 3u };
+		std::vector<float> dstRow(srcRow.size());
+
+		// convert (with best available instruction set) and mark nulls
+		ras::simd::convertRow(srcRow.data(), srcRow.size(), dstRow.data());
+		ras::simd::nullifyRow
+			(srcRow.data(), srcRow.size(), dstRow.data(), std::uint8_t{ 0u });
+
+		// [DoxyExample01]
+
+		if (! ( std::isnan(dstRow[0])
+			&& (17.f == dstRow[1])
+			&& (255.f == dstRow[2])
+			&& (3.f == dstRow[4])
+			) )
+		{
+			oss << "Failure of convert/nullify example test\n";
+		}
+
+		checkConvertRow<std::uint8_t>(oss, "uint8_t");
+		checkConvertRow<std::uint16_t>(oss, "uint16_t");
+
+		// non-vectorized combinations use portable code
+		std::vector<std::uint8_t> const u8s{ 1u, 2u, 250u };
+		std::vector<double> dbls(u8s.size());
+		ras::simd::convertRow(u8s.data(), u8s.size(), dbls.data());
+		if (! ((1. == dbls[0]) && (250. == dbls[2])))
+		{
+			oss << "Failure of double convertRow test\n";
+		}
+	}
+
+	//! Check gradient kernels (consistent levels, match double version)
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using sys::cpu::SimdLevel;
+
+		// source with (pseudo random) structure
+		ras::Grid<float> srcGrid(5u, 41u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((31u*row + 17u*col*col) % 97u);
+			}
+		}
+		srcGrid(2u, 20u) = std::numeric_limits<float>::quiet_NaN();
+
+		// [DoxyExample02]
+
+		// gradients for interior of source row 2 (starting at col 1)
+		std::size_t const numElem{ srcGrid.wide() - 2u };
+		std::vector<float> gRows(numElem);
+		std::vector<float> gCols(numElem);
+		ras::simd::gradientRowBy8x
+			( &(srcGrid(1u, 0u)), &(srcGrid(2u, 0u)), &(srcGrid(3u, 0u))
+			, numElem, gRows.data(), gCols.data()
+			);
+
+		// [DoxyExample02]
+
+		// values should be within float precision of double computation
+		constexpr double tol{ 64. * std::numeric_limits<float>::epsilon() };
+		for (std::size_t ndx{0u} ; ndx < numElem ; ++ndx)
+		{
+			std::size_t const col{ ndx + 1u };
+			img::Grad const expGrad
+				{ ops::grid::responseGradientBy8x
+					(srcGrid, 1u, 2u, 3u, col - 1u, col, col + 1u)
+				};
+			img::Grad const gotGrad{ gRows[ndx], gCols[ndx] };
+			bool okay{ false };
+			if (isValid(expGrad))
+			{
+				okay = expGrad.nearlyEqualsAbs(gotGrad, tol * 97.);
+			}
+			else
+			{
+				okay = (! isValid(gotGrad));
+			}
+			if (! okay)
+			{
+				oss << "Failure of gradientRowBy8x value test\n";
+				oss << "ndx: " << ndx << '\n';
+				oss << "expGrad: " << expGrad << '\n';
+				oss << "gotGrad: " << gotGrad << '\n';
+				break;
+			}
+		}
+
+		// all instruction set levels produce identical values
+		std::vector<SimdLevel> const levels
+			{ SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 };
+		for (std::size_t num{0u} ; num < numElem ; ++num)
+		{
+			std::vector<float> expRows(num + 1u, -1.f);
+			std::vector<float> expCols(num + 1u, -1.f);
+			ras::simd::gradientRowBy8x
+				( &(srcGrid(1u, 0u)), &(srcGrid(2u, 0u)), &(srcGrid(3u, 0u))
+				, num, expRows.data(), expCols.data(), SimdLevel::Scalar
+				);
+			for (SimdLevel const & level : levels)
+			{
+				std::vector<float> gotRows(num + 1u, -1.f);
+				std::vector<float> gotCols(num + 1u, -1.f);
+				ras::simd::gradientRowBy8x
+					( &(srcGrid(1u, 0u)), &(srcGrid(2u, 0u))
+					, &(srcGrid(3u, 0u))
+					, num, gotRows.data(), gotCols.data(), level
+					);
+				bool same{ true };
+				for (std::size_t ndx{0u} ; same && (ndx <= num) ; ++ndx)
+				{
+					same = ( sameBits(expRows[ndx], gotRows[ndx])
+						&& sameBits(expCols[ndx], gotCols[ndx])
+						);
+				}
+				if (! same)
+				{
+					oss << "Failure of gradientRowBy8x level test\n";
+					oss << "level: " << sys::cpu::nameFor(level) << '\n';
+					oss << "num: " << num << '\n';
+					return;
+				}
+			}
+		}
+	}
+
+	//! Check ring pair statistics kernels (all levels identical)
+	void
+	test3
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using sys::cpu::SimdLevel;
+
+		ras::Grid<float> srcGrid(9u, 45u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((13u*row + 7u*col*col) % 23u);
+			}
+		}
+		std::ptrdiff_t const stride{ (std::ptrdiff_t)srcGrid.wide() };
+
+		// [DoxyExample03]
+
+		// (diamond) ring of pairs - linear offsets for source row stride
+		std::vector<std::ptrdiff_t> const offsets1
+			{ -2*stride, -stride + 1, 2, stride + 1 };
+		std::vector<std::ptrdiff_t> const offsets2
+			{ 2*stride, stride - 1, -2, -stride - 1 };
+
+		// statistics for rings around cells (4,2) through (4,42)
+		std::size_t const numElem{ 41u };
+		std::vector<float> mins(numElem);
+		std::vector<float> maxs(numElem);
+		std::vector<double> sumSqDifs(numElem);
+		std::vector<std::uint32_t> numNegs(numElem);
+		ras::simd::ringPairStatsRow
+			( &(srcGrid(4u, 2u)), numElem
+			, offsets1.data(), offsets2.data(), offsets1.size(), 11.f
+			, mins.data(), maxs.data(), sumSqDifs.data(), numNegs.data()
+			);
+
+		// [DoxyExample03]
+
+		// check one cell explicitly
+		float const * const src{ &(srcGrid(4u, 2u)) + 5u };
+		float expMin{ std::numeric_limits<float>::infinity() };
+		float expMax{ -expMin };
+		double expSum{ 0. };
+		std::uint32_t expNeg{ 0u };
+		for (std::size_t nn{0u} ; nn < offsets1.size() ; ++nn)
+		{
+			float const val1{ src[offsets1[nn]] - 11.f };
+			float const val2{ src[offsets2[nn]] - 11.f };
+			expMin = std::min(expMin, std::min(val1, val2));
+			expMax = std::max(expMax, std::max(val1, val2));
+			double const dif{ (double)val2 - (double)val1 };
+			expSum += dif * dif;
+			expNeg += ((val1 + val2) < 0.f) ? 1u : 0u;
+		}
+		if (! ( (expMin == mins[5u])
+			 && (expMax == maxs[5u])
+			 && (expSum == sumSqDifs[5u])
+			 && (expNeg == numNegs[5u])
+			  ))
+		{
+			oss << "Failure of ringPairStatsRow value test\n";
+			oss << "exp: " << expMin << ' ' << expMax
+				<< ' ' << expSum << ' ' << expNeg << '\n';
+			oss << "got: " << mins[5u] << ' ' << maxs[5u]
+				<< ' ' << sumSqDifs[5u] << ' ' << numNegs[5u] << '\n';
+		}
+
+		// all instruction set levels produce identical values
+		std::vector<SimdLevel> const levels
+			{ SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 };
+		for (std::size_t num{0u} ; num <= numElem ; ++num)
+		{
+			for (SimdLevel const & level : levels)
+			{
+				std::vector<float> gotMins(numElem, -1.f);
+				std::vector<float> gotMaxs(numElem, -1.f);
+				std::vector<double> gotSums(numElem, -1.);
+				std::vector<std::uint32_t> gotNegs(numElem, 99u);
+				ras::simd::ringPairStatsRow
+					( &(srcGrid(4u, 2u)), num
+					, offsets1.data(), offsets2.data(), offsets1.size(), 11.f
+					, gotMins.data(), gotMaxs.data()
+					, gotSums.data(), gotNegs.data()
+					, level
+					);
+				bool same{ true };
+				for (std::size_t ndx{0u} ; same && (ndx < num) ; ++ndx)
+				{
+					same = ( (mins[ndx] == gotMins[ndx])
+						&& (maxs[ndx] == gotMaxs[ndx])
+						&& (sumSqDifs[ndx] == gotSums[ndx])
+						&& (numNegs[ndx] == gotNegs[ndx])
+						);
+				}
+				if (same && (num < numElem))
+				{
+					same = (99u == gotNegs[num]); // no write past end
+				}
+				if (! same)
+				{
+					oss << "Failure of ringPairStatsRow level test\n";
+					oss << "level: " << sys::cpu::nameFor(level) << '\n';
+					oss << "num: " << num << '\n';
+					return;
+				}
+			}
+		}
+	}
+
+	//! Check ring pair statistics at scattered cells (same as row kernel)
+	void
+	test4
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+		using sys::cpu::SimdLevel;
+
+		ras::Grid<float> srcGrid(21u, 30u);
+		for (std::size_t row{0u} ; row < srcGrid.high() ; ++row)
+		{
+			for (std::size_t col{0u} ; col < srcGrid.wide() ; ++col)
+			{
+				srcGrid(row, col) = (float)((5u*row*row + 3u*col) % 19u);
+			}
+		}
+		std::ptrdiff_t const stride{ (std::ptrdiff_t)srcGrid.rowPitch() };
+		std::vector<std::ptrdiff_t> const offsets1
+			{ -2*stride, -stride + 1, 2, stride + 1 };
+		std::vector<std::ptrdiff_t> const offsets2
+			{ 2*stride, stride - 1, -2, -stride - 1 };
+
+		// scattered cells (at least 2 cells inside the border)
+		std::vector<std::ptrdiff_t> cellOffsets;
+		for (std::size_t nn{0u} ; nn < 29u ; ++nn)
+		{
+			std::size_t const row{ 2u + ((nn * 7u) % 17u) };
+			std::size_t const col{ 2u + ((nn * 11u) % 26u) };
+			cellOffsets.emplace_back((std::ptrdiff_t)row * stride + col);
+		}
+		std::size_t const numElem{ cellOffsets.size() };
+
+		// [DoxyExample04]
+
+		// statistics for rings about arbitrary (e.g. peak) cells
+		std::vector<float> mins(numElem);
+		std::vector<float> maxs(numElem);
+		std::vector<double> sumSqDifs(numElem);
+		std::vector<std::uint32_t> numNegs(numElem);
+		ras::simd::ringPairStatsCells
+			( &(srcGrid(0u, 0u)), cellOffsets.data(), numElem
+			, offsets1.data(), offsets2.data(), offsets1.size(), 9.f
+			, mins.data(), maxs.data(), sumSqDifs.data(), numNegs.data()
+			);
+
+		// [DoxyExample04]
+
+		std::vector<SimdLevel> const levels
+			{ SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2 };
+		for (SimdLevel const & level : levels)
+		{
+			std::vector<float> gotMins(numElem);
+			std::vector<float> gotMaxs(numElem);
+			std::vector<double> gotSums(numElem);
+			std::vector<std::uint32_t> gotNegs(numElem);
+			ras::simd::ringPairStatsCells
+				( &(srcGrid(0u, 0u)), cellOffsets.data(), numElem
+				, offsets1.data(), offsets2.data(), offsets1.size(), 9.f
+				, gotMins.data(), gotMaxs.data()
+				, gotSums.data(), gotNegs.data()
+				, level
+				);
+			std::size_t numBad{ 0u };
+			for (std::size_t ndx{0u} ; ndx < numElem ; ++ndx)
+			{
+				// same as row kernel evaluated at the one cell
+				float expMin, expMax;
+				double expSum;
+				std::uint32_t expNeg;
+				ras::simd::ringPairStatsRow
+					( &(srcGrid(0u, 0u)) + cellOffsets[ndx], 1u
+					, offsets1.data(), offsets2.data(), offsets1.size(), 9.f
+					, &expMin, &expMax, &expSum, &expNeg
+					, SimdLevel::Scalar
+					);
+				bool const same
+					{  (expMin == gotMins[ndx]) && (expMin == mins[ndx])
+					&& (expMax == gotMaxs[ndx]) && (expMax == maxs[ndx])
+					&& (expSum == gotSums[ndx]) && (expSum == sumSqDifs[ndx])
+					&& (expNeg == gotNegs[ndx]) && (expNeg == numNegs[ndx])
+					};
+				numBad += same ? 0u : 1u;
+			}
+			if (! (0u == numBad))
+			{
+				oss << "Failure of ringPairStatsCells test\n";
+				oss << "level: " << sys::cpu::nameFor(level) << '\n';
+				oss << "numBad: " << numBad << '\n';
+			}
+		}
+	}
+
+}
+
+//! Check behavior of ras::simd functions
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+	test3(oss);
+	test4(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
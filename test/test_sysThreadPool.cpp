@@ -0,0 +1,207 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::sys::ThreadPool
+*/
+
+
+#include "QuadLoco/sysThreadPool.hpp"
+
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+
+namespace
+{
+	//! Examples for documentation
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		// [DoxyExample01]
+
+		// pool with (at least) several threads (even on small machines)
+		quadloco::sys::ThreadPool pool(4u);
+
+		// process each index of a range exactly once (in bands)
+		std::size_t const numNdx{ 1000u };
+		std::vector<int> counts(numNdx, 0);
+		pool.forEachBand
+			( 0u, numNdx
+			, [&counts] (std::size_t const & beg, std::size_t const & end)
+				{
+					for (std::size_t ndx{beg} ; ndx < end ; ++ndx)
+					{
+						counts[ndx] += 1;
+					}
+				}
+			);
+
+		// the execution policy selects between caller-only and the
+		// process-wide pool (ThreadPool::shared())
+		std::vector<int> serCounts(numNdx, 0);
+		std::vector<int> parCounts(numNdx, 0);
+		auto const addOne
+			{ [] (std::vector<int> * const ptCounts)
+				{
+					return [ptCounts]
+						(std::size_t const & beg, std::size_t const & end)
+						{
+							for (std::size_t ndx{beg} ; ndx < end ; ++ndx)
+							{
+								(*ptCounts)[ndx] += 1;
+							}
+						};
+				}
+			};
+		using quadloco::sys::Exec;
+		quadloco::sys::forEachBand
+			(0u, numNdx, Exec::Serial, addOne(&serCounts));
+		quadloco::sys::forEachBand
+			(0u, numNdx, Exec::Parallel, addOne(&parCounts));
+
+		// [DoxyExample01]
+
+		if (! (4u == pool.size()))
+		{
+			oss << "Failure of pool size test\n";
+			oss << "exp: " << 4u << '\n';
+			oss << "got: " << pool.size() << '\n';
+		}
+
+		std::vector<int> const expCounts(numNdx, 1);
+		if (! (expCounts == counts))
+		{
+			oss << "Failure of pool forEachBand coverage test\n";
+		}
+		if (! (expCounts == serCounts))
+		{
+			oss << "Failure of Exec::Serial coverage test\n";
+		}
+		if (! (expCounts == parCounts))
+		{
+			oss << "Failure of Exec::Parallel coverage test\n";
+		}
+	}
+
+	//! Check nested and degenerate use
+	void
+	test2
+		( std::ostream & oss
+		)
+	{
+		quadloco::sys::ThreadPool pool(3u);
+
+		// nested bands (e.g. parallel rows each with parallel columns)
+		std::size_t const high{ 64u };
+		std::size_t const wide{ 48u };
+		std::vector<std::atomic<int>> cells(high * wide);
+		auto const incRow
+			{ [&] (std::size_t const & row)
+				{
+					pool.forEachBand
+						( 0u, wide
+						, [&] (std::size_t const & beg, std::size_t const & end)
+							{
+								for (std::size_t col{beg} ; col < end ; ++col)
+								{
+									cells[row * wide + col] += 1;
+								}
+							}
+						, 4u
+						);
+				}
+			};
+		pool.forEachBand
+			( 0u, high
+			, [&] (std::size_t const & rowBeg, std::size_t const & rowEnd)
+				{
+					for (std::size_t row{rowBeg} ; row < rowEnd ; ++row)
+					{
+						incRow(row);
+					}
+				}
+			, 1u
+			);
+		std::size_t numBad{ 0u };
+		for (std::atomic<int> const & cell : cells)
+		{
+			if (! (1 == cell.load()))
+			{
+				++numBad;
+			}
+		}
+		if (! (0u == numBad))
+		{
+			oss << "Failure of nested forEachBand test\n";
+			oss << "numBad: " << numBad << '\n';
+		}
+
+		// empty and tiny ranges
+		std::size_t numCalls{ 0u };
+		auto const countCalls
+			{ [&numCalls] (std::size_t const &, std::size_t const &)
+				{ ++numCalls; }
+			};
+		pool.forEachBand(5u, 5u, countCalls);
+		quadloco::sys::forEachBand
+			(7u, 3u, quadloco::sys::Exec::Parallel, countCalls);
+		pool.forEachBand(0u, 3u, countCalls);
+		if (! (1u == numCalls))
+		{
+			oss << "Failure of degenerate range test\n";
+			oss << "exp: " << 1u << '\n';
+			oss << "got: " << numCalls << '\n';
+		}
+	}
+
+}
+
+//! Standard test case main wrapper
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+	test2(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}
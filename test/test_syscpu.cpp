@@ -0,0 +1,109 @@
+//
+// MIT License
+//
+// Copyright (c) 2024 Stellacore Corporation
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+//
+
+/*! \file
+\brief Unit tests (and example) code for quadloco::sys::cpu functions
+*/
+
+
+#include "QuadLoco/syscpu.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+
+
+namespace
+{
+	//! Check SIMD level queries
+	void
+	test1
+		( std::ostream & oss
+		)
+	{
+		using namespace quadloco;
+
+		// [DoxyExample01]
+
+		// most capable instruction set available at runtime
+		sys::cpu::SimdLevel const level{ sys::cpu::simdLevel() };
+		std::string const name{ sys::cpu::nameFor(level) };
+
+		// [DoxyExample01]
+
+		// portable code is always supported
+		if (! sys::cpu::supports(sys::cpu::SimdLevel::Scalar))
+		{
+			oss << "Failure of Scalar support test\n";
+		}
+
+		// detected level is supported (and stable)
+		if (! ( sys::cpu::supports(level)
+			&& (level == sys::cpu::simdLevel())
+			) )
+		{
+			oss << "Failure of detected level support test\n";
+			oss << "name: " << name << '\n';
+		}
+
+#		if defined(QuadLoco_SIMD_X86)
+		// SSE2 is part of the x86-64 baseline
+		if (! sys::cpu::supports(sys::cpu::SimdLevel::SSE2))
+		{
+			oss << "Failure of x86-64 SSE2 support test\n";
+			oss << "name: " << name << '\n';
+		}
+#		endif
+
+		if (! (std::string("AVX2") == sys::cpu::nameFor
+			(sys::cpu::SimdLevel::AVX2)))
+		{
+			oss << "Failure of nameFor test\n";
+		}
+	}
+
+}
+
+//! Check behavior of sys::cpu functions
+int
+main
+	()
+{
+	int status{ 1 };
+	std::stringstream oss;
+
+	test1(oss);
+
+	if (oss.str().empty()) // Only pass if no errors were encountered
+	{
+		status = 0;
+	}
+	else
+	{
+		// else report error messages
+		std::cerr << "### FAILURE in test file: " << __FILE__ << std::endl;
+		std::cerr << oss.str();
+	}
+	return status;
+}